@@ -844,6 +844,30 @@ M_NORETURN M_INLINE void unreachable_func(void)
 #        define NO_ALIGNOF
 #        define NO_ALIGNAS
 #    endif
+#endif
+
+//! \def M_THREAD_LOCAL
+//! \brief Storage class for a variable that has a separate instance in each thread.
+//!
+//! - For C++11 and C23, it uses thread_local.
+//! - For MSVC 2005 and later, it uses __declspec(thread).
+//! - For C11, it uses _Thread_local unless the implementation defines __STDC_NO_THREADS__.
+//! - For GCC 3.3 and Clang 1.0, it uses __thread.
+//! - If no support is detected, it defines NO_THREAD_LOCAL and M_THREAD_LOCAL is empty, so the variable is shared by
+//! all threads.
+//!
+//! \note Only use this on variables with static storage duration.
+#if defined(USING_CPP11) || defined(USING_C23)
+#    define M_THREAD_LOCAL thread_local
+#elif IS_MSVC_VERSION(MSVC_2005)
+#    define M_THREAD_LOCAL __declspec(thread)
+#elif defined(USING_C11) && !defined(__STDC_NO_THREADS__)
+#    define M_THREAD_LOCAL _Thread_local
+#elif IS_GCC_VERSION(3, 3) || IS_CLANG_VERSION(1, 0)
+#    define M_THREAD_LOCAL __thread
+#else
+#    define M_THREAD_LOCAL /* thread local storage not available */
+#    define NO_THREAD_LOCAL
 #endif
 
     // Example for nullability annotations
@@ -1747,6 +1771,19 @@ M_NORETURN M_INLINE void unreachable_func(void)
         } while (0)
 #endif
 
+//! \def M_PREFETCH_READ
+//! \brief Hints to the CPU that the memory at \a addr will be read soon.
+//!
+//! This is only a hint and never faults, even if \a addr is not a valid address.
+//! Searches through large tables use this to start loading the next probe locations
+//! while the current comparison is still being evaluated.
+//! \param[in] addr address to prefetch into cache
+#if defined(HAVE_BUILT_IN_PREFETCH)
+#    define M_PREFETCH_READ(addr) __builtin_prefetch((addr), 0, 3)
+#else
+#    define M_PREFETCH_READ(addr) M_USE_UNUSED(addr)
+#endif
+
 //! \def M_LIKELY
 //! \brief Hints to the compiler that a branch is likely to be taken.
 //! \see https://clang.llvm.org/docs/AttributeReference.html#likely-and-unlikely
@@ -0,0 +1,215 @@
+// SPDX-License-Identifier: MPL-2.0
+
+//! \file hash_table.h
+//! \brief Defines a generic open addressing hash map/set for fast lookups and de-duplication where safe_lsearch would
+//! otherwise be used repeatedly.
+//!
+//! \details Keys and values are copied into the table by value. Collisions are resolved with Robin Hood linear probing
+//! and backward shift deletion so lookups touch a short run of contiguous slots and no tombstones are left behind.
+//! All memory the table releases or vacates is cleared with explicit_zeroes first so that it is safe to store
+//! sensitive keys such as serial numbers or passwords in it.
+//! \copyright
+//! Do NOT modify or remove this copyright and license
+//!
+//! Copyright (c) 2026 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//!
+//! This software is subject to the terms of the Mozilla Public License, v. 2.0.
+//! If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "code_attributes.h"
+#include "common_types.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif //__cplusplus
+
+    //! \typedef hashtablehashfn
+    //! \brief Function pointer type for hashing a key stored in a hashTable.
+    //!
+    //! \param[in] key Pointer to the key to hash.
+    //! \param[in] keysize Size of the key in bytes as given to create_Hash_Table.
+    //! \param[in] context Optional context pointer given to create_Hash_Table.
+    //! \return A 64bit hash of the key. Equal keys must produce equal hashes. The table mixes the result again so a
+    //! weak hash (such as the key value itself) is acceptable.
+    typedef uint64_t (*hashtablehashfn)(const void* M_NONNULL key, size_t keysize, void* M_NULLABLE context);
+
+    //! \typedef hashtableequalfn
+    //! \brief Function pointer type for comparing two keys stored in a hashTable for equality.
+    //!
+    //! \param[in] key1 Pointer to the first key.
+    //! \param[in] key2 Pointer to the second key.
+    //! \param[in] keysize Size of the keys in bytes as given to create_Hash_Table.
+    //! \param[in] context Optional context pointer given to create_Hash_Table.
+    //! \return true if the keys are equal, otherwise false.
+    typedef bool (*hashtableequalfn)(const void* M_NONNULL key1,
+                                     const void* M_NONNULL key2,
+                                     size_t                keysize,
+                                     void* M_NULLABLE      context);
+
+    //! \struct hashTable
+    //! \brief Opaque hash table handle. Create with create_Hash_Table and free with free_Hash_Table.
+    typedef struct shashTable hashTable;
+
+    //! \fn uint64_t hash_Table_Hash_Bytes(const void* key, size_t keysize, void* context)
+    //! \brief Default hash function used when create_Hash_Table is not given one.
+    //!
+    //! Hashes the raw bytes of the key 8 bytes at a time. Useful as a building block for custom hash functions that
+    //! need to hash part of a structure.
+    //! \param[in] key Pointer to the bytes to hash.
+    //! \param[in] keysize Number of bytes to hash.
+    //! \param[in] context Unused.
+    //! \return 64bit hash of the bytes.
+    M_NODISCARD M_PARAM_RO_SIZE(1, 2) uint64_t
+        hash_Table_Hash_Bytes(const void* M_NONNULL key, size_t keysize, void* M_NULLABLE context);
+
+    //! \fn hashTable* create_Hash_Table(size_t keysize, size_t valuesize, size_t initialCount, hashtablehashfn hash,
+    //! hashtableequalfn equal, void* context)
+    //! \brief Allocates a new, empty hash table.
+    //!
+    //! \param[in] keysize Size of each key in bytes. Must not be zero.
+    //! \param[in] valuesize Size of each value in bytes. Use zero to create a set that only stores keys.
+    //! \param[in] initialCount Number of entries to reserve space for up front. May be zero.
+    //! \param[in] hash Hash function for keys. If NULL, hash_Table_Hash_Bytes is used.
+    //! \param[in] equal Equality function for keys. If NULL, the key bytes are compared with memcmp.
+    //! \param[in] context Optional context passed to \a hash and \a equal.
+    //! \return Pointer to the new table, or M_NULLPTR if \a keysize is zero or memory could not be allocated.
+    M_NODISCARD_REASON("The returned pointer must be freed by the caller using free_Hash_Table()")
+    hashTable* M_NULLABLE create_Hash_Table(size_t                      keysize,
+                                            size_t                      valuesize,
+                                            size_t                      initialCount,
+                                            hashtablehashfn M_NULLABLE  hash,
+                                            hashtableequalfn M_NULLABLE equal,
+                                            void* M_NULLABLE            context);
+
+    //! \fn void free_Hash_Table(hashTable** table)
+    //! \brief Zeroes all stored keys and values then frees the table.
+    //! \param[in,out] table Pointer to the table to free. Set to M_NULLPTR on return.
+    void free_Hash_Table(hashTable* M_NULLABLE* M_NULLABLE table);
+
+    //! \fn errno_t hash_Table_Reserve(hashTable* table, size_t count)
+    //! \brief Grows the table so that \a count entries can be stored without rehashing.
+    //! \param[in,out] table Table to grow.
+    //! \param[in] count Number of entries to make room for.
+    //! \return Zero on success, EINVAL if \a table is NULL, ENOMEM if memory could not be allocated, or ERANGE if
+    //! \a count is too large.
+    M_PARAM_RW(1) errno_t hash_Table_Reserve(hashTable* M_NONNULL table, size_t count);
+
+    //! \fn errno_t hash_Table_Insert(hashTable* table, const void* key, const void* value, bool* existed)
+    //! \brief Inserts a key into the table or replaces the value of a key that is already present.
+    //! \param[in,out] table Table to insert into.
+    //! \param[in] key Pointer to the key to copy into the table.
+    //! \param[in] value Pointer to the value to copy into the table. Ignored for sets. May be NULL: a new key then gets
+    //! a zeroed value, and the value of a key that is already present is left unchanged. This allows adding a key
+    //! only when it is missing without overwriting what is stored.
+    //! \param[out] existed Optional. Set to true if the key was already in the table, false if it was added. Use this
+    //! to de-duplicate a list in a single pass.
+    //! \return Zero on success, EINVAL if \a table or \a key is NULL, ENOMEM if the table needed to grow and memory
+    //! could not be allocated.
+    //! \note \a key and \a value must not point into the table itself since the table may be reallocated.
+    M_PARAM_RW(1)
+    M_PARAM_RO(2)
+    M_PARAM_WO(4)
+    errno_t hash_Table_Insert(hashTable* M_NONNULL   table,
+                              const void* M_NONNULL  key,
+                              const void* M_NULLABLE value,
+                              bool* M_NULLABLE       existed);
+
+    //! \fn const void* hash_Table_Find(const hashTable* table, const void* key)
+    //! \brief Looks up a key in the table.
+    //! \param[in] table Table to search.
+    //! \param[in] key Pointer to the key to look for.
+    //! \return Pointer to the stored value, or for a set a pointer to the stored key. M_NULLPTR if the key is not in
+    //! the table. The pointer is only valid until the table is next modified. Use hash_Table_Find_Mutable to change
+    //! the value in place.
+    M_NODISCARD M_PARAM_RO(1) M_PARAM_RO(2) const void* M_NULLABLE
+        hash_Table_Find(const hashTable* M_NONNULL table, const void* M_NONNULL key);
+
+    //! \fn void* hash_Table_Find_Mutable(hashTable* table, const void* key)
+    //! \brief Looks up a key in the table and returns its value so it can be changed in place, such as incrementing
+    //! a count without a second lookup.
+    //! \param[in,out] table Table to search.
+    //! \param[in] key Pointer to the key to look for.
+    //! \return Pointer to the stored value, or M_NULLPTR if the key is not in the table or the table is a set. Keys
+    //! must never be changed through this pointer. The pointer is only valid until the table is next modified.
+    M_NODISCARD M_PARAM_RW(1) M_PARAM_RO(2) void* M_NULLABLE
+        hash_Table_Find_Mutable(hashTable* M_NONNULL table, const void* M_NONNULL key);
+
+    //! \fn bool hash_Table_Contains(const hashTable* table, const void* key)
+    //! \brief Checks if a key is in the table.
+    //! \param[in] table Table to search.
+    //! \param[in] key Pointer to the key to look for.
+    //! \return true if the key is in the table, otherwise false.
+    M_NODISCARD M_PARAM_RO(1) M_PARAM_RO(2) bool hash_Table_Contains(const hashTable* M_NONNULL table,
+                                                                     const void* M_NONNULL      key);
+
+    //! \fn bool hash_Table_Remove(hashTable* table, const void* key)
+    //! \brief Removes a key and its value from the table. The vacated storage is zeroed.
+    //! \param[in,out] table Table to remove from.
+    //! \param[in] key Pointer to the key to remove.
+    //! \return true if the key was found and removed, otherwise false.
+    M_PARAM_RW(1) M_PARAM_RO(2) bool hash_Table_Remove(hashTable* M_NONNULL table, const void* M_NONNULL key);
+
+    //! \fn void hash_Table_Clear(hashTable* table)
+    //! \brief Removes and zeroes every entry while keeping the allocated capacity.
+    //! \param[in,out] table Table to clear.
+    M_PARAM_RW(1) void hash_Table_Clear(hashTable* M_NULLABLE table);
+
+    //! \fn size_t hash_Table_Count(const hashTable* table)
+    //! \brief Gets the number of entries stored in the table.
+    //! \param[in] table Table to check.
+    //! \return Number of entries, or zero if \a table is NULL.
+    M_NODISCARD M_PARAM_RO(1) size_t hash_Table_Count(const hashTable* M_NULLABLE table);
+
+    //! \fn bool hash_Table_Next(const hashTable* table, size_t* cursor, const void** key, const void** value)
+    //! \brief Iterates over all entries in the table.
+    //!
+    //! Entries are visited in storage order, which walks the slot arrays front to back. The order is unrelated to the
+    //! order of insertion. The table must not be modified while iterating.
+    //! \code
+    //! size_t      cursor = 0;
+    //! const void* key    = M_NULLPTR;
+    //! const void* value  = M_NULLPTR;
+    //! while (hash_Table_Next(table, &cursor, &key, &value))
+    //! {
+    //!     ...
+    //! }
+    //! \endcode
+    //! \param[in] table Table to iterate.
+    //! \param[in,out] cursor Iteration position. Set to zero before the first call.
+    //! \param[out] key Optional. Receives a pointer to the stored key.
+    //! \param[out] value Optional. Receives a pointer to the stored value, or M_NULLPTR for a set. Use
+    //! hash_Table_Next_Mutable to change values while iterating.
+    //! \return true if an entry was returned, false when there are no more entries.
+    M_PARAM_RO(1)
+    M_PARAM_RW(2)
+    M_PARAM_WO(3)
+    M_PARAM_WO(4)
+    bool hash_Table_Next(const hashTable* M_NONNULL         table,
+                         size_t* M_NONNULL                  cursor,
+                         const void* M_NULLABLE* M_NULLABLE key,
+                         const void* M_NULLABLE* M_NULLABLE value);
+
+    //! \fn bool hash_Table_Next_Mutable(hashTable* table, size_t* cursor, const void** key, void** value)
+    //! \brief Iterates over all entries in the table like hash_Table_Next, returning values that can be changed in
+    //! place. Keys must never be changed through the returned pointers, and no entries may be added or removed while
+    //! iterating.
+    //! \param[in,out] table Table to iterate.
+    //! \param[in,out] cursor Iteration position. Set to zero before the first call.
+    //! \param[out] key Optional. Receives a pointer to the stored key.
+    //! \param[out] value Optional. Receives a pointer to the stored value, or M_NULLPTR for a set.
+    //! \return true if an entry was returned, false when there are no more entries.
+    M_PARAM_RW(1)
+    M_PARAM_RW(2)
+    M_PARAM_WO(3)
+    M_PARAM_WO(4)
+    bool hash_Table_Next_Mutable(hashTable* M_NONNULL               table,
+                                 size_t* M_NONNULL                  cursor,
+                                 const void* M_NULLABLE* M_NULLABLE key,
+                                 void* M_NULLABLE* M_NULLABLE       value);
+
+#if defined(__cplusplus)
+}
+#endif //__cplusplus
@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: MPL-2.0
+
+//! \file impl_simd.h
+//! \brief This is an internal header with the SIMD intrinsic includes and small helpers shared by the vectorized
+//! string and search loops.
+//!
+//!        Do NOT include this outside of the library sources. Nothing here is part of the public API.
+//! \copyright
+//! Do NOT modify or remove this copyright and license
+//!
+//! Copyright (c) 2024-2026 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//!
+//! This software is subject to the terms of the Mozilla Public License, v. 2.0.
+//! If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "code_attributes.h"
+#include "common_types.h"
+
+#if defined(HAVE_SSE2)
+#    include <emmintrin.h>
+#elif defined(HAVE_NEON)
+#    include <arm_neon.h>
+#endif
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+#if defined(HAVE_NEON)
+    //! \fn static M_INLINE bool neon_any_lane_set(uint8x16_t compared)
+    //! \brief Checks if any byte of a NEON compare result is nonzero. This is the NEON equivalent of checking
+    //! _mm_movemask_epi8 for a nonzero mask.
+    //! \param[in] compared result of a vector compare, where each byte is either 0 or 0xFF
+    //! \return true if any byte is set
+    static M_INLINE bool neon_any_lane_set(uint8x16_t compared)
+    {
+#    if defined(HAVE_NEON_A64)
+        return vmaxvq_u8(compared) != 0;
+#    else
+        uint8x8_t folded = vorr_u8(vget_low_u8(compared), vget_high_u8(compared));
+        return vget_lane_u64(vreinterpret_u64_u8(folded), 0) != 0;
+#    endif
+    }
+#endif
+
+#if defined(__cplusplus)
+}
+#endif
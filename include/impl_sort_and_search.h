@@ -486,6 +486,1036 @@ extern "C"
         // clang-format on
         ;
 
+    //! \fn errno_t safe_lfind_uint16_impl(uint16_t key, const uint16_t* base, rsize_t count, rsize_t* index, const
+    //! char* file, const char* function, int line, const char* expression)
+    //!
+    //! \brief Searches an array of uint16_t linearly for the first element equal to \a key with bounds checking.
+    //!
+    //! This function compares \a key against several elements at once using SIMD instructions when available.
+    //!
+    //! \param[in] key Value to search for.
+    //! \param[in] base Pointer to the array to be searched.
+    //! \param[in] count Number of elements in the array.
+    //! \param[out] index Receives the index of the first matching element, or \a count if no element matches.
+    //! \param[in] file The source file name where this function is called.
+    //! \param[in] function The function name where this function is called.
+    //! \param[in] line The line number where this function is called.
+    //! \param[in] expression The expression being evaluated.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a index is a null pointer
+    //!
+    //! - \a count > RSIZE_T_C(0) && \a base == M_NULLPTR
+    //!
+    //! - \a count > RSIZE_MAX
+    M_PARAM_RO(2)
+    M_PARAM_WO(4)
+    CONSTRAINT_NO_DISCARD errno_t safe_lfind_uint16_impl(uint16_t                  key,
+                                                         const uint16_t* M_NONNULL base,
+                                                         rsize_t                   count,
+                                                         rsize_t* M_NONNULL        index,
+                                                         const char* M_NULLABLE    file,
+                                                         const char* M_NULLABLE    function,
+                                                         int                       line,
+                                                         const char* M_NULLABLE    expression)
+        // clang-format off
+        M_DIAG_ERROR(M_IS_NULL_ALG_RSIZE_T(index), "index is NULL")
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_ALG_CONST_VOID(base), "base is NULL and count > 0")
+        M_DIAG_ERROR(count > RSIZE_MAX, "count > RSIZE_MAX")
+        // clang-format on
+        ;
+
+    //! \fn errno_t safe_lfind_uint32_impl(uint32_t key, const uint32_t* base, rsize_t count, rsize_t* index, const
+    //! char* file, const char* function, int line, const char* expression)
+    //!
+    //! \brief Searches an array of uint32_t linearly for the first element equal to \a key with bounds checking.
+    //!
+    //! This function compares \a key against several elements at once using SIMD instructions when available.
+    //!
+    //! \param[in] key Value to search for.
+    //! \param[in] base Pointer to the array to be searched.
+    //! \param[in] count Number of elements in the array.
+    //! \param[out] index Receives the index of the first matching element, or \a count if no element matches.
+    //! \param[in] file The source file name where this function is called.
+    //! \param[in] function The function name where this function is called.
+    //! \param[in] line The line number where this function is called.
+    //! \param[in] expression The expression being evaluated.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a index is a null pointer
+    //!
+    //! - \a count > RSIZE_T_C(0) && \a base == M_NULLPTR
+    //!
+    //! - \a count > RSIZE_MAX
+    M_PARAM_RO(2)
+    M_PARAM_WO(4)
+    CONSTRAINT_NO_DISCARD errno_t safe_lfind_uint32_impl(uint32_t                  key,
+                                                         const uint32_t* M_NONNULL base,
+                                                         rsize_t                   count,
+                                                         rsize_t* M_NONNULL        index,
+                                                         const char* M_NULLABLE    file,
+                                                         const char* M_NULLABLE    function,
+                                                         int                       line,
+                                                         const char* M_NULLABLE    expression)
+        // clang-format off
+        M_DIAG_ERROR(M_IS_NULL_ALG_RSIZE_T(index), "index is NULL")
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_ALG_CONST_VOID(base), "base is NULL and count > 0")
+        M_DIAG_ERROR(count > RSIZE_MAX, "count > RSIZE_MAX")
+        // clang-format on
+        ;
+
+    //! \fn errno_t safe_lfind_uint64_impl(uint64_t key, const uint64_t* base, rsize_t count, rsize_t* index, const
+    //! char* file, const char* function, int line, const char* expression)
+    //!
+    //! \brief Searches an array of uint64_t linearly for the first element equal to \a key with bounds checking.
+    //!
+    //! This function compares \a key against several elements at once using SIMD instructions when available.
+    //!
+    //! \param[in] key Value to search for.
+    //! \param[in] base Pointer to the array to be searched.
+    //! \param[in] count Number of elements in the array.
+    //! \param[out] index Receives the index of the first matching element, or \a count if no element matches.
+    //! \param[in] file The source file name where this function is called.
+    //! \param[in] function The function name where this function is called.
+    //! \param[in] line The line number where this function is called.
+    //! \param[in] expression The expression being evaluated.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a index is a null pointer
+    //!
+    //! - \a count > RSIZE_T_C(0) && \a base == M_NULLPTR
+    //!
+    //! - \a count > RSIZE_MAX
+    M_PARAM_RO(2)
+    M_PARAM_WO(4)
+    CONSTRAINT_NO_DISCARD errno_t safe_lfind_uint64_impl(uint64_t                  key,
+                                                         const uint64_t* M_NONNULL base,
+                                                         rsize_t                   count,
+                                                         rsize_t* M_NONNULL        index,
+                                                         const char* M_NULLABLE    file,
+                                                         const char* M_NULLABLE    function,
+                                                         int                       line,
+                                                         const char* M_NULLABLE    expression)
+        // clang-format off
+        M_DIAG_ERROR(M_IS_NULL_ALG_RSIZE_T(index), "index is NULL")
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_ALG_CONST_VOID(base), "base is NULL and count > 0")
+        M_DIAG_ERROR(count > RSIZE_MAX, "count > RSIZE_MAX")
+        // clang-format on
+        ;
+
+    //! \fn errno_t safe_lower_bound_impl(const void* key, const void* ptr, rsize_t count, rsize_t size, comparefn
+    //! compare, rsize_t* index, const char* file, const char* function, int line, const char* expression)
+    //!
+    //! \brief Finds the first element not less than a key in a sorted array with bounds checking.
+    //!
+    //! This function finds the index of the first element in a sorted array of \a count elements, each of \a size
+    //! bytes, that does not compare less than \a key. If all elements are less than \a key, the index is \a count.
+    //! The search loop is branchless and prefetches both possible next probe locations so it performs well on large
+    //! tables.
+    //!
+    //! \param[in] key Pointer to the key to search for.
+    //! \param[in] ptr Pointer to the sorted array to be searched.
+    //! \param[in] count Number of elements in the array.
+    //! \param[in] size Size of each element in the array.
+    //! \param[in] compare Comparison function to determine the order of the elements.
+    //! \param[out] index Receives the index of the found position.
+    //! \param[in] file The source file name where this function is called.
+    //! \param[in] function The function name where this function is called.
+    //! \param[in] line The line number where this function is called.
+    //! \param[in] expression The expression being evaluated.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a count or \a size is > RSIZE_MAX
+    //!
+    //! - \a key or \a ptr or \a compare is a null pointer (unless count is zero)
+    //!
+    //! - \a index is a null pointer
+    M_PARAM_RO(1)
+    M_PARAM_RO(2)
+    M_PARAM_WO(6)
+    CONSTRAINT_NO_DISCARD errno_t safe_lower_bound_impl(const void* M_NONNULL  key,
+                                                        const void* M_NONNULL  ptr,
+                                                        rsize_t                count,
+                                                        rsize_t                size,
+                                                        comparefn M_NONNULL    compare,
+                                                        rsize_t* M_NONNULL     index,
+                                                        const char* M_NULLABLE file,
+                                                        const char* M_NULLABLE function,
+                                                        int                    line,
+                                                        const char* M_NULLABLE expression)
+        // clang-format off
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_ALG_CONST_VOID(ptr), "ptr is NULL and count > 0")
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_COMPARE(compare), "compare function is NULL and count > 0")
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_ALG_CONST_VOID(key), "count > 0 and NULL key")
+        M_DIAG_ERROR(M_IS_NULL_ALG_RSIZE_T(index), "index is NULL")
+        M_DIAG_ERROR(count > RSIZE_MAX, "count > RSIZE_MAX")
+        M_DIAG_ERROR(size > RSIZE_MAX, "size > RSIZE_MAX")
+        // clang-format on
+        ;
+
+    //! \fn errno_t safe_lower_bound_context_impl(const void* key, const void* ptr, rsize_t count, rsize_t size,
+    //! ctxcomparefn compare, void* context, rsize_t* index, const char* file, const char* function, int line, const
+    //! char* expression)
+    //!
+    //! \brief Finds the first element not less than a key in a sorted array with bounds checking and an optional
+    //! context parameter.
+    //!
+    //! This function finds the index of the first element in a sorted array of \a count elements, each of \a size
+    //! bytes, that does not compare less than \a key. If all elements are less than \a key, the index is \a count.
+    //! The search loop is branchless and prefetches both possible next probe locations so it performs well on large
+    //! tables.
+    //!
+    //! \param[in] key Pointer to the key to search for.
+    //! \param[in] ptr Pointer to the sorted array to be searched.
+    //! \param[in] count Number of elements in the array.
+    //! \param[in] size Size of each element in the array.
+    //! \param[in] compare Comparison function to determine the order of the elements.
+    //! \param[in] context Optional context parameter for the comparison function.
+    //! \param[out] index Receives the index of the found position.
+    //! \param[in] file The source file name where this function is called.
+    //! \param[in] function The function name where this function is called.
+    //! \param[in] line The line number where this function is called.
+    //! \param[in] expression The expression being evaluated.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a count or \a size is > RSIZE_MAX
+    //!
+    //! - \a key or \a ptr or \a compare is a null pointer (unless count is zero)
+    //!
+    //! - \a index is a null pointer
+    M_PARAM_RO(1)
+    M_PARAM_RO(2)
+    M_PARAM_WO(7)
+    CONSTRAINT_NO_DISCARD errno_t safe_lower_bound_context_impl(const void* M_NONNULL  key,
+                                                                const void* M_NONNULL  ptr,
+                                                                rsize_t                count,
+                                                                rsize_t                size,
+                                                                ctxcomparefn M_NONNULL compare,
+                                                                void* M_NULLABLE       context,
+                                                                rsize_t* M_NONNULL     index,
+                                                                const char* M_NULLABLE file,
+                                                                const char* M_NULLABLE function,
+                                                                int                    line,
+                                                                const char* M_NULLABLE expression)
+        // clang-format off
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_ALG_CONST_VOID(ptr), "ptr is NULL and count > 0")
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_CTXCOMPARE(compare), "compare function is NULL and count > 0")
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_ALG_CONST_VOID(key), "count > 0 and NULL key")
+        M_DIAG_ERROR(M_IS_NULL_ALG_RSIZE_T(index), "index is NULL")
+        M_DIAG_ERROR(count > RSIZE_MAX, "count > RSIZE_MAX")
+        M_DIAG_ERROR(size > RSIZE_MAX, "size > RSIZE_MAX")
+        // clang-format on
+        ;
+
+    //! \fn errno_t safe_upper_bound_impl(const void* key, const void* ptr, rsize_t count, rsize_t size, comparefn
+    //! compare, rsize_t* index, const char* file, const char* function, int line, const char* expression)
+    //!
+    //! \brief Finds the first element greater than a key in a sorted array with bounds checking.
+    //!
+    //! This function finds the index of the first element in a sorted array of \a count elements, each of \a size
+    //! bytes, that compares greater than \a key. If no element is greater than \a key, the index is \a count.
+    //! The search loop is branchless and prefetches both possible next probe locations so it performs well on large
+    //! tables.
+    //!
+    //! \param[in] key Pointer to the key to search for.
+    //! \param[in] ptr Pointer to the sorted array to be searched.
+    //! \param[in] count Number of elements in the array.
+    //! \param[in] size Size of each element in the array.
+    //! \param[in] compare Comparison function to determine the order of the elements.
+    //! \param[out] index Receives the index of the found position.
+    //! \param[in] file The source file name where this function is called.
+    //! \param[in] function The function name where this function is called.
+    //! \param[in] line The line number where this function is called.
+    //! \param[in] expression The expression being evaluated.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a count or \a size is > RSIZE_MAX
+    //!
+    //! - \a key or \a ptr or \a compare is a null pointer (unless count is zero)
+    //!
+    //! - \a index is a null pointer
+    M_PARAM_RO(1)
+    M_PARAM_RO(2)
+    M_PARAM_WO(6)
+    CONSTRAINT_NO_DISCARD errno_t safe_upper_bound_impl(const void* M_NONNULL  key,
+                                                        const void* M_NONNULL  ptr,
+                                                        rsize_t                count,
+                                                        rsize_t                size,
+                                                        comparefn M_NONNULL    compare,
+                                                        rsize_t* M_NONNULL     index,
+                                                        const char* M_NULLABLE file,
+                                                        const char* M_NULLABLE function,
+                                                        int                    line,
+                                                        const char* M_NULLABLE expression)
+        // clang-format off
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_ALG_CONST_VOID(ptr), "ptr is NULL and count > 0")
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_COMPARE(compare), "compare function is NULL and count > 0")
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_ALG_CONST_VOID(key), "count > 0 and NULL key")
+        M_DIAG_ERROR(M_IS_NULL_ALG_RSIZE_T(index), "index is NULL")
+        M_DIAG_ERROR(count > RSIZE_MAX, "count > RSIZE_MAX")
+        M_DIAG_ERROR(size > RSIZE_MAX, "size > RSIZE_MAX")
+        // clang-format on
+        ;
+
+    //! \fn errno_t safe_upper_bound_context_impl(const void* key, const void* ptr, rsize_t count, rsize_t size,
+    //! ctxcomparefn compare, void* context, rsize_t* index, const char* file, const char* function, int line, const
+    //! char* expression)
+    //!
+    //! \brief Finds the first element greater than a key in a sorted array with bounds checking and an optional context
+    //! parameter.
+    //!
+    //! This function finds the index of the first element in a sorted array of \a count elements, each of \a size
+    //! bytes, that compares greater than \a key. If no element is greater than \a key, the index is \a count.
+    //! The search loop is branchless and prefetches both possible next probe locations so it performs well on large
+    //! tables.
+    //!
+    //! \param[in] key Pointer to the key to search for.
+    //! \param[in] ptr Pointer to the sorted array to be searched.
+    //! \param[in] count Number of elements in the array.
+    //! \param[in] size Size of each element in the array.
+    //! \param[in] compare Comparison function to determine the order of the elements.
+    //! \param[in] context Optional context parameter for the comparison function.
+    //! \param[out] index Receives the index of the found position.
+    //! \param[in] file The source file name where this function is called.
+    //! \param[in] function The function name where this function is called.
+    //! \param[in] line The line number where this function is called.
+    //! \param[in] expression The expression being evaluated.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a count or \a size is > RSIZE_MAX
+    //!
+    //! - \a key or \a ptr or \a compare is a null pointer (unless count is zero)
+    //!
+    //! - \a index is a null pointer
+    M_PARAM_RO(1)
+    M_PARAM_RO(2)
+    M_PARAM_WO(7)
+    CONSTRAINT_NO_DISCARD errno_t safe_upper_bound_context_impl(const void* M_NONNULL  key,
+                                                                const void* M_NONNULL  ptr,
+                                                                rsize_t                count,
+                                                                rsize_t                size,
+                                                                ctxcomparefn M_NONNULL compare,
+                                                                void* M_NULLABLE       context,
+                                                                rsize_t* M_NONNULL     index,
+                                                                const char* M_NULLABLE file,
+                                                                const char* M_NULLABLE function,
+                                                                int                    line,
+                                                                const char* M_NULLABLE expression)
+        // clang-format off
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_ALG_CONST_VOID(ptr), "ptr is NULL and count > 0")
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_CTXCOMPARE(compare), "compare function is NULL and count > 0")
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_ALG_CONST_VOID(key), "count > 0 and NULL key")
+        M_DIAG_ERROR(M_IS_NULL_ALG_RSIZE_T(index), "index is NULL")
+        M_DIAG_ERROR(count > RSIZE_MAX, "count > RSIZE_MAX")
+        M_DIAG_ERROR(size > RSIZE_MAX, "size > RSIZE_MAX")
+        // clang-format on
+        ;
+
+    //! \fn errno_t safe_equal_range_impl(const void* key, const void* ptr, rsize_t count, rsize_t size, comparefn
+    //! compare, rsize_t* first, rsize_t* last, const char* file, const char* function, int line, const char*
+    //! expression)
+    //!
+    //! \brief Finds the range of elements equal to a key in a sorted array with bounds checking.
+    //!
+    //! This function finds the range of elements in a sorted array of \a count elements, each of \a size bytes,
+    //! that compare equal to \a key. The range is returned as a half-open range [\a first, \a last). If no elements
+    //! match, \a first equals \a last and both are the position where \a key would be inserted.
+    //!
+    //! \param[in] key Pointer to the key to search for.
+    //! \param[in] ptr Pointer to the sorted array to be searched.
+    //! \param[in] count Number of elements in the array.
+    //! \param[in] size Size of each element in the array.
+    //! \param[in] compare Comparison function to determine the order of the elements.
+    //! \param[out] first Receives the index of the first element equal to \a key.
+    //! \param[out] last Receives the index one past the last element equal to \a key.
+    //! \param[in] file The source file name where this function is called.
+    //! \param[in] function The function name where this function is called.
+    //! \param[in] line The line number where this function is called.
+    //! \param[in] expression The expression being evaluated.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a count or \a size is > RSIZE_MAX
+    //!
+    //! - \a key or \a ptr or \a compare is a null pointer (unless count is zero)
+    //!
+    //! - \a first or \a last is a null pointer
+    M_PARAM_RO(1)
+    M_PARAM_RO(2)
+    M_PARAM_WO(6)
+    M_PARAM_WO(7)
+    CONSTRAINT_NO_DISCARD errno_t safe_equal_range_impl(const void* M_NONNULL  key,
+                                                        const void* M_NONNULL  ptr,
+                                                        rsize_t                count,
+                                                        rsize_t                size,
+                                                        comparefn M_NONNULL    compare,
+                                                        rsize_t* M_NONNULL     first,
+                                                        rsize_t* M_NONNULL     last,
+                                                        const char* M_NULLABLE file,
+                                                        const char* M_NULLABLE function,
+                                                        int                    line,
+                                                        const char* M_NULLABLE expression)
+        // clang-format off
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_ALG_CONST_VOID(ptr), "ptr is NULL and count > 0")
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_COMPARE(compare), "compare function is NULL and count > 0")
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_ALG_CONST_VOID(key), "count > 0 and NULL key")
+        M_DIAG_ERROR(M_IS_NULL_ALG_RSIZE_T(first), "first is NULL")
+        M_DIAG_ERROR(M_IS_NULL_ALG_RSIZE_T(last), "last is NULL")
+        M_DIAG_ERROR(count > RSIZE_MAX, "count > RSIZE_MAX")
+        M_DIAG_ERROR(size > RSIZE_MAX, "size > RSIZE_MAX")
+        // clang-format on
+        ;
+
+    //! \fn errno_t safe_equal_range_context_impl(const void* key, const void* ptr, rsize_t count, rsize_t size,
+    //! ctxcomparefn compare, void* context, rsize_t* first, rsize_t* last, const char* file, const char* function, int
+    //! line, const char* expression)
+    //!
+    //! \brief Finds the range of elements equal to a key in a sorted array with bounds checking and an optional context
+    //! parameter.
+    //!
+    //! This function finds the range of elements in a sorted array of \a count elements, each of \a size bytes,
+    //! that compare equal to \a key. The range is returned as a half-open range [\a first, \a last). If no elements
+    //! match, \a first equals \a last and both are the position where \a key would be inserted.
+    //!
+    //! \param[in] key Pointer to the key to search for.
+    //! \param[in] ptr Pointer to the sorted array to be searched.
+    //! \param[in] count Number of elements in the array.
+    //! \param[in] size Size of each element in the array.
+    //! \param[in] compare Comparison function to determine the order of the elements.
+    //! \param[in] context Optional context parameter for the comparison function.
+    //! \param[out] first Receives the index of the first element equal to \a key.
+    //! \param[out] last Receives the index one past the last element equal to \a key.
+    //! \param[in] file The source file name where this function is called.
+    //! \param[in] function The function name where this function is called.
+    //! \param[in] line The line number where this function is called.
+    //! \param[in] expression The expression being evaluated.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a count or \a size is > RSIZE_MAX
+    //!
+    //! - \a key or \a ptr or \a compare is a null pointer (unless count is zero)
+    //!
+    //! - \a first or \a last is a null pointer
+    M_PARAM_RO(1)
+    M_PARAM_RO(2)
+    M_PARAM_WO(7)
+    M_PARAM_WO(8)
+    CONSTRAINT_NO_DISCARD errno_t safe_equal_range_context_impl(const void* M_NONNULL  key,
+                                                                const void* M_NONNULL  ptr,
+                                                                rsize_t                count,
+                                                                rsize_t                size,
+                                                                ctxcomparefn M_NONNULL compare,
+                                                                void* M_NULLABLE       context,
+                                                                rsize_t* M_NONNULL     first,
+                                                                rsize_t* M_NONNULL     last,
+                                                                const char* M_NULLABLE file,
+                                                                const char* M_NULLABLE function,
+                                                                int                    line,
+                                                                const char* M_NULLABLE expression)
+        // clang-format off
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_ALG_CONST_VOID(ptr), "ptr is NULL and count > 0")
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_CTXCOMPARE(compare), "compare function is NULL and count > 0")
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_ALG_CONST_VOID(key), "count > 0 and NULL key")
+        M_DIAG_ERROR(M_IS_NULL_ALG_RSIZE_T(first), "first is NULL")
+        M_DIAG_ERROR(M_IS_NULL_ALG_RSIZE_T(last), "last is NULL")
+        M_DIAG_ERROR(count > RSIZE_MAX, "count > RSIZE_MAX")
+        M_DIAG_ERROR(size > RSIZE_MAX, "size > RSIZE_MAX")
+        // clang-format on
+        ;
+
+    //! \fn errno_t safe_eytzinger_layout_impl(void* dest, const void* src, rsize_t count, rsize_t size, const char*
+    //! file, const char* function, int line, const char* expression)
+    //!
+    //! \brief Copies a sorted array into Eytzinger (breadth first search) order with bounds checking.
+    //!
+    //! Element \a i of the Eytzinger order is the root of an implicit binary search tree whose children are at
+    //! 2*i+1 and 2*i+2. Use safe_eytzinger_lower_bound to search the result. This is intended for read-mostly
+    //! tables that are searched many more times than they are modified.
+    //!
+    //! \param[out] dest Pointer to the array to receive \a count elements in Eytzinger order.
+    //! \param[in] src Pointer to the sorted array to copy from. Must not overlap \a dest.
+    //! \param[in] count Number of elements in the array.
+    //! \param[in] size Size of each element in the array.
+    //! \param[in] file The source file name where this function is called.
+    //! \param[in] function The function name where this function is called.
+    //! \param[in] line The line number where this function is called.
+    //! \param[in] expression The expression being evaluated.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a count or \a size is > RSIZE_MAX
+    //!
+    //! - \a dest or \a src is a null pointer (unless count is zero)
+    //!
+    //! - \a dest and \a src overlap
+    M_PARAM_WO(1)
+    M_PARAM_RO(2)
+    CONSTRAINT_NO_DISCARD errno_t safe_eytzinger_layout_impl(void* M_NONNULL        dest,
+                                                             const void* M_NONNULL  src,
+                                                             rsize_t                count,
+                                                             rsize_t                size,
+                                                             const char* M_NULLABLE file,
+                                                             const char* M_NULLABLE function,
+                                                             int                    line,
+                                                             const char* M_NULLABLE expression)
+        // clang-format off
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_ALG_VOID(dest), "dest is NULL and count > 0")
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_ALG_CONST_VOID(src), "src is NULL and count > 0")
+        M_DIAG_ERROR(count > RSIZE_MAX, "count > RSIZE_MAX")
+        M_DIAG_ERROR(size > RSIZE_MAX, "size > RSIZE_MAX")
+        // clang-format on
+        ;
+
+    //! \fn errno_t safe_eytzinger_lower_bound_impl(const void* key, const void* ptr, rsize_t count, rsize_t size,
+    //! comparefn compare, rsize_t* index, const char* file, const char* function, int line, const char* expression)
+    //!
+    //! \brief Finds the first element not less than a key in an Eytzinger ordered array with bounds checking.
+    //!
+    //! This function searches an array that was rearranged with safe_eytzinger_layout for the first element (in
+    //! sorted order) that does not compare less than \a key. The Eytzinger (breadth first) order places the
+    //! elements visited by a search next to each other in memory, so large, read-mostly tables that are searched
+    //! many times have far fewer cache misses than the same table searched in sorted order.
+    //!
+    //! \param[in] key Pointer to the key to search for.
+    //! \param[in] ptr Pointer to the Eytzinger ordered array to be searched.
+    //! \param[in] count Number of elements in the array.
+    //! \param[in] size Size of each element in the array.
+    //! \param[in] compare Comparison function to determine the order of the elements.
+    //! \param[out] index Receives the index into \a ptr of the found element, or \a count if every element is less
+    //! than \a key.
+    //! \param[in] file The source file name where this function is called.
+    //! \param[in] function The function name where this function is called.
+    //! \param[in] line The line number where this function is called.
+    //! \param[in] expression The expression being evaluated.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a count or \a size is > RSIZE_MAX
+    //!
+    //! - \a key or \a ptr or \a compare is a null pointer (unless count is zero)
+    //!
+    //! - \a index is a null pointer
+    M_PARAM_RO(1)
+    M_PARAM_RO(2)
+    M_PARAM_WO(6)
+    CONSTRAINT_NO_DISCARD errno_t safe_eytzinger_lower_bound_impl(const void* M_NONNULL  key,
+                                                                  const void* M_NONNULL  ptr,
+                                                                  rsize_t                count,
+                                                                  rsize_t                size,
+                                                                  comparefn M_NONNULL    compare,
+                                                                  rsize_t* M_NONNULL     index,
+                                                                  const char* M_NULLABLE file,
+                                                                  const char* M_NULLABLE function,
+                                                                  int                    line,
+                                                                  const char* M_NULLABLE expression)
+        // clang-format off
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_ALG_CONST_VOID(ptr), "ptr is NULL and count > 0")
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_COMPARE(compare), "compare function is NULL and count > 0")
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_ALG_CONST_VOID(key), "count > 0 and NULL key")
+        M_DIAG_ERROR(M_IS_NULL_ALG_RSIZE_T(index), "index is NULL")
+        M_DIAG_ERROR(count > RSIZE_MAX, "count > RSIZE_MAX")
+        M_DIAG_ERROR(size > RSIZE_MAX, "size > RSIZE_MAX")
+        // clang-format on
+        ;
+
+    //! \fn errno_t safe_eytzinger_lower_bound_context_impl(const void* key, const void* ptr, rsize_t count, rsize_t
+    //! size, ctxcomparefn compare, void* context, rsize_t* index, const char* file, const char* function, int line,
+    //! const char* expression)
+    //!
+    //! \brief Finds the first element not less than a key in an Eytzinger ordered array with bounds checking and an
+    //! optional context parameter.
+    //!
+    //! This function searches an array that was rearranged with safe_eytzinger_layout for the first element (in
+    //! sorted order) that does not compare less than \a key. The Eytzinger (breadth first) order places the
+    //! elements visited by a search next to each other in memory, so large, read-mostly tables that are searched
+    //! many times have far fewer cache misses than the same table searched in sorted order.
+    //!
+    //! \param[in] key Pointer to the key to search for.
+    //! \param[in] ptr Pointer to the Eytzinger ordered array to be searched.
+    //! \param[in] count Number of elements in the array.
+    //! \param[in] size Size of each element in the array.
+    //! \param[in] compare Comparison function to determine the order of the elements.
+    //! \param[in] context Optional context parameter for the comparison function.
+    //! \param[out] index Receives the index into \a ptr of the found element, or \a count if every element is less
+    //! than \a key.
+    //! \param[in] file The source file name where this function is called.
+    //! \param[in] function The function name where this function is called.
+    //! \param[in] line The line number where this function is called.
+    //! \param[in] expression The expression being evaluated.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a count or \a size is > RSIZE_MAX
+    //!
+    //! - \a key or \a ptr or \a compare is a null pointer (unless count is zero)
+    //!
+    //! - \a index is a null pointer
+    M_PARAM_RO(1)
+    M_PARAM_RO(2)
+    M_PARAM_WO(7)
+    CONSTRAINT_NO_DISCARD errno_t safe_eytzinger_lower_bound_context_impl(const void* M_NONNULL  key,
+                                                                          const void* M_NONNULL  ptr,
+                                                                          rsize_t                count,
+                                                                          rsize_t                size,
+                                                                          ctxcomparefn M_NONNULL compare,
+                                                                          void* M_NULLABLE       context,
+                                                                          rsize_t* M_NONNULL     index,
+                                                                          const char* M_NULLABLE file,
+                                                                          const char* M_NULLABLE function,
+                                                                          int                    line,
+                                                                          const char* M_NULLABLE expression)
+        // clang-format off
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_ALG_CONST_VOID(ptr), "ptr is NULL and count > 0")
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_CTXCOMPARE(compare), "compare function is NULL and count > 0")
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_ALG_CONST_VOID(key), "count > 0 and NULL key")
+        M_DIAG_ERROR(M_IS_NULL_ALG_RSIZE_T(index), "index is NULL")
+        M_DIAG_ERROR(count > RSIZE_MAX, "count > RSIZE_MAX")
+        M_DIAG_ERROR(size > RSIZE_MAX, "size > RSIZE_MAX")
+        // clang-format on
+        ;
+
+    //! \fn errno_t safe_lower_bound_batch_impl(const void* keys, rsize_t keycount, rsize_t keysize, const void* ptr,
+    //! rsize_t count, rsize_t size, comparefn compare, bool keysSorted, rsize_t* results, const char* file, const char*
+    //! function, int line, const char* expression)
+    //!
+    //! \brief Finds the lower bound of many keys in one sorted array with bounds checking.
+    //!
+    //! This function stores in \a results the index of the first element of the sorted array \a ptr that does not
+    //! compare less than each key in \a keys. When \a keysSorted is true, each search gallops forward from the
+    //! result of the previous key. Otherwise groups of keys are searched in lockstep so their cache misses overlap.
+    //!
+    //! \param[in] keys Pointer to the array of keys to search for.
+    //! \param[in] keycount Number of keys in \a keys.
+    //! \param[in] keysize Size of each key in \a keys.
+    //! \param[in] ptr Pointer to the sorted array to be searched.
+    //! \param[in] count Number of elements in the array.
+    //! \param[in] size Size of each element in the array.
+    //! \param[in] compare Comparison function that compares a key to an array element.
+    //! \param[in] keysSorted Set to true if \a keys is sorted in the same order as \a ptr.
+    //! \param[out] results Pointer to an array of \a keycount indexes to receive the result for each key.
+    //! \param[in] file The source file name where this function is called.
+    //! \param[in] function The function name where this function is called.
+    //! \param[in] line The line number where this function is called.
+    //! \param[in] expression The expression being evaluated.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a keycount, \a keysize, \a count or \a size is > RSIZE_MAX
+    //!
+    //! - \a keys or \a results is a null pointer (unless keycount is zero)
+    //!
+    //! - \a ptr or \a compare is a null pointer (unless count is zero)
+    M_PARAM_RO(1)
+    M_PARAM_RO(4)
+    M_PARAM_WO(9)
+    CONSTRAINT_NO_DISCARD errno_t safe_lower_bound_batch_impl(const void* M_NONNULL  keys,
+                                                              rsize_t                keycount,
+                                                              rsize_t                keysize,
+                                                              const void* M_NONNULL  ptr,
+                                                              rsize_t                count,
+                                                              rsize_t                size,
+                                                              comparefn M_NONNULL    compare,
+                                                              bool                   keysSorted,
+                                                              rsize_t* M_NONNULL     results,
+                                                              const char* M_NULLABLE file,
+                                                              const char* M_NULLABLE function,
+                                                              int                    line,
+                                                              const char* M_NULLABLE expression)
+        // clang-format off
+        M_DIAG_ERROR(keycount > RSIZE_T_C(0) && M_IS_NULL_ALG_CONST_VOID(keys), "keys is NULL and keycount > 0")
+        M_DIAG_ERROR(keycount > RSIZE_T_C(0) && M_IS_NULL_ALG_RSIZE_T(results), "results is NULL and keycount > 0")
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_ALG_CONST_VOID(ptr), "ptr is NULL and count > 0")
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_COMPARE(compare), "compare function is NULL and count > 0")
+        M_DIAG_ERROR(keycount > RSIZE_MAX, "keycount > RSIZE_MAX")
+        M_DIAG_ERROR(keysize > RSIZE_MAX, "keysize > RSIZE_MAX")
+        M_DIAG_ERROR(count > RSIZE_MAX, "count > RSIZE_MAX")
+        M_DIAG_ERROR(size > RSIZE_MAX, "size > RSIZE_MAX")
+        // clang-format on
+        ;
+
+    //! \fn errno_t safe_lower_bound_batch_context_impl(const void* keys, rsize_t keycount, rsize_t keysize, const void*
+    //! ptr, rsize_t count, rsize_t size, ctxcomparefn compare, void* context, bool keysSorted, rsize_t* results, const
+    //! char* file, const char* function, int line, const char* expression)
+    //!
+    //! \brief Finds the lower bound of many keys in one sorted array with bounds checking and an optional context
+    //! parameter.
+    //!
+    //! This function stores in \a results the index of the first element of the sorted array \a ptr that does not
+    //! compare less than each key in \a keys. When \a keysSorted is true, each search gallops forward from the
+    //! result of the previous key. Otherwise groups of keys are searched in lockstep so their cache misses overlap.
+    //!
+    //! \param[in] keys Pointer to the array of keys to search for.
+    //! \param[in] keycount Number of keys in \a keys.
+    //! \param[in] keysize Size of each key in \a keys.
+    //! \param[in] ptr Pointer to the sorted array to be searched.
+    //! \param[in] count Number of elements in the array.
+    //! \param[in] size Size of each element in the array.
+    //! \param[in] compare Comparison function that compares a key to an array element.
+    //! \param[in] context Optional context parameter for the comparison function.
+    //! \param[in] keysSorted Set to true if \a keys is sorted in the same order as \a ptr.
+    //! \param[out] results Pointer to an array of \a keycount indexes to receive the result for each key.
+    //! \param[in] file The source file name where this function is called.
+    //! \param[in] function The function name where this function is called.
+    //! \param[in] line The line number where this function is called.
+    //! \param[in] expression The expression being evaluated.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a keycount, \a keysize, \a count or \a size is > RSIZE_MAX
+    //!
+    //! - \a keys or \a results is a null pointer (unless keycount is zero)
+    //!
+    //! - \a ptr or \a compare is a null pointer (unless count is zero)
+    M_PARAM_RO(1)
+    M_PARAM_RO(4)
+    M_PARAM_WO(10)
+    CONSTRAINT_NO_DISCARD errno_t safe_lower_bound_batch_context_impl(const void* M_NONNULL  keys,
+                                                                      rsize_t                keycount,
+                                                                      rsize_t                keysize,
+                                                                      const void* M_NONNULL  ptr,
+                                                                      rsize_t                count,
+                                                                      rsize_t                size,
+                                                                      ctxcomparefn M_NONNULL compare,
+                                                                      void* M_NULLABLE       context,
+                                                                      bool                   keysSorted,
+                                                                      rsize_t* M_NONNULL     results,
+                                                                      const char* M_NULLABLE file,
+                                                                      const char* M_NULLABLE function,
+                                                                      int                    line,
+                                                                      const char* M_NULLABLE expression)
+        // clang-format off
+        M_DIAG_ERROR(keycount > RSIZE_T_C(0) && M_IS_NULL_ALG_CONST_VOID(keys), "keys is NULL and keycount > 0")
+        M_DIAG_ERROR(keycount > RSIZE_T_C(0) && M_IS_NULL_ALG_RSIZE_T(results), "results is NULL and keycount > 0")
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_ALG_CONST_VOID(ptr), "ptr is NULL and count > 0")
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_CTXCOMPARE(compare), "compare function is NULL and count > 0")
+        M_DIAG_ERROR(keycount > RSIZE_MAX, "keycount > RSIZE_MAX")
+        M_DIAG_ERROR(keysize > RSIZE_MAX, "keysize > RSIZE_MAX")
+        M_DIAG_ERROR(count > RSIZE_MAX, "count > RSIZE_MAX")
+        M_DIAG_ERROR(size > RSIZE_MAX, "size > RSIZE_MAX")
+        // clang-format on
+        ;
+
+    //! \fn errno_t safe_nth_element_impl(void* ptr, rsize_t count, rsize_t size, rsize_t nth, comparefn compare, const
+    //! char* file, const char* function, int line, const char* expression)
+    //!
+    //! \brief Partially sorts an array so that one element is in its sorted position with bounds checking.
+    //!
+    //! After this function returns, the element at index \a nth is the element that would be there if the whole array
+    //! were sorted. Every element before it compares less than or equal to it and every element after it compares
+    //! greater than or equal to it. The order within each side is unspecified.
+    //!
+    //! \param[in,out] ptr Pointer to the array.
+    //! \param[in] count Number of elements in the array.
+    //! \param[in] size Size of each element in the array.
+    //! \param[in] nth Index of the element to place in its sorted position.
+    //! \param[in] compare Comparison function to determine the order of the elements.
+    //! \param[in] file The source file name where this function is called.
+    //! \param[in] function The function name where this function is called.
+    //! \param[in] line The line number where this function is called.
+    //! \param[in] expression The expression being evaluated.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a count or \a size is > RSIZE_MAX
+    //!
+    //! - \a ptr or \a compare is a null pointer (unless count is zero)
+    //!
+    //! - \a nth >= \a count (unless count is zero)
+    M_PARAM_RW(1)
+    CONSTRAINT_NO_DISCARD errno_t safe_nth_element_impl(void* M_NONNULL        ptr,
+                                                        rsize_t                count,
+                                                        rsize_t                size,
+                                                        rsize_t                nth,
+                                                        comparefn M_NONNULL    compare,
+                                                        const char* M_NULLABLE file,
+                                                        const char* M_NULLABLE function,
+                                                        int                    line,
+                                                        const char* M_NULLABLE expression)
+        // clang-format off
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_ALG_VOID(ptr), "ptr is NULL and count > 0")
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_COMPARE(compare), "compare function is NULL and count > 0")
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && nth >= count, "nth >= count")
+        M_DIAG_ERROR(count > RSIZE_MAX, "count > RSIZE_MAX")
+        M_DIAG_ERROR(size > RSIZE_MAX, "size > RSIZE_MAX")
+        // clang-format on
+        ;
+
+    //! \fn errno_t safe_partial_sort_impl(void* ptr, rsize_t count, rsize_t size, rsize_t middle, comparefn compare,
+    //! const char* file, const char* function, int line, const char* expression)
+    //!
+    //! \brief Sorts the smallest elements of an array into its beginning with bounds checking.
+    //!
+    //! After this function returns, the first \a middle elements of the array are the smallest \a middle elements in
+    //! sorted order. The order of the remaining elements is unspecified.
+    //!
+    //! \param[in,out] ptr Pointer to the array.
+    //! \param[in] count Number of elements in the array.
+    //! \param[in] size Size of each element in the array.
+    //! \param[in] middle Number of elements to sort into the beginning of the array.
+    //! \param[in] compare Comparison function to determine the order of the elements.
+    //! \param[in] file The source file name where this function is called.
+    //! \param[in] function The function name where this function is called.
+    //! \param[in] line The line number where this function is called.
+    //! \param[in] expression The expression being evaluated.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a count or \a size is > RSIZE_MAX
+    //!
+    //! - \a ptr or \a compare is a null pointer (unless count is zero)
+    //!
+    //! - \a middle > \a count
+    M_PARAM_RW(1)
+    CONSTRAINT_NO_DISCARD errno_t safe_partial_sort_impl(void* M_NONNULL        ptr,
+                                                         rsize_t                count,
+                                                         rsize_t                size,
+                                                         rsize_t                middle,
+                                                         comparefn M_NONNULL    compare,
+                                                         const char* M_NULLABLE file,
+                                                         const char* M_NULLABLE function,
+                                                         int                    line,
+                                                         const char* M_NULLABLE expression)
+        // clang-format off
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_ALG_VOID(ptr), "ptr is NULL and count > 0")
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_COMPARE(compare), "compare function is NULL and count > 0")
+        M_DIAG_ERROR(middle > count, "middle > count")
+        M_DIAG_ERROR(count > RSIZE_MAX, "count > RSIZE_MAX")
+        M_DIAG_ERROR(size > RSIZE_MAX, "size > RSIZE_MAX")
+        // clang-format on
+        ;
+
+    //! \fn errno_t safe_top_k_impl(void* dest, rsize_t k, const void* ptr, rsize_t count, rsize_t size, comparefn
+    //! compare, const char* file, const char* function, int line, const char* expression)
+    //!
+    //! \brief Copies the largest elements of an array into another array in descending order with bounds checking.
+    //!
+    //! The source array is not modified. \a dest is used as a min-heap of the \a k largest elements seen so far while
+    //! the source is read once from start to end, so this runs in O(count log k) and works well when \a k is much
+    //! smaller than \a count. To get the smallest elements instead, pass a comparison function that reverses the order.
+    //!
+    //! \param[out] dest Pointer to an array of at least \a k elements that receives the result, largest first.
+    //! \param[in] k Number of elements to select.
+    //! \param[in] ptr Pointer to the source array.
+    //! \param[in] count Number of elements in the source array.
+    //! \param[in] size Size of each element in the arrays.
+    //! \param[in] compare Comparison function to determine the order of the elements.
+    //! \param[in] file The source file name where this function is called.
+    //! \param[in] function The function name where this function is called.
+    //! \param[in] line The line number where this function is called.
+    //! \param[in] expression The expression being evaluated.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a k, \a count or \a size is > RSIZE_MAX
+    //!
+    //! - \a k * \a size is > RSIZE_MAX
+    //!
+    //! - \a dest, \a ptr or \a compare is a null pointer (unless k is zero)
+    //!
+    //! - \a k > \a count
+    //!
+    //! - \a dest overlaps \a ptr
+    M_PARAM_WO(1)
+    M_PARAM_RO(3)
+    CONSTRAINT_NO_DISCARD errno_t safe_top_k_impl(void* M_NONNULL        dest,
+                                                  rsize_t                k,
+                                                  const void* M_NONNULL  ptr,
+                                                  rsize_t                count,
+                                                  rsize_t                size,
+                                                  comparefn M_NONNULL    compare,
+                                                  const char* M_NULLABLE file,
+                                                  const char* M_NULLABLE function,
+                                                  int                    line,
+                                                  const char* M_NULLABLE expression)
+        // clang-format off
+        M_DIAG_ERROR(k > RSIZE_T_C(0) && M_IS_NULL_ALG_VOID(dest), "dest is NULL and k > 0")
+        M_DIAG_ERROR(k > RSIZE_T_C(0) && M_IS_NULL_ALG_CONST_VOID(ptr), "ptr is NULL and k > 0")
+        M_DIAG_ERROR(k > RSIZE_T_C(0) && M_IS_NULL_COMPARE(compare), "compare function is NULL and k > 0")
+        M_DIAG_ERROR(k > count, "k > count")
+        M_DIAG_ERROR(count > RSIZE_MAX, "count > RSIZE_MAX")
+        M_DIAG_ERROR(size > RSIZE_MAX, "size > RSIZE_MAX")
+        // clang-format on
+        ;
+
+    //! \fn errno_t safe_nth_element_context_impl(void* ptr, rsize_t count, rsize_t size, rsize_t nth, ctxcomparefn
+    //! compare, void* context, const char* file, const char* function, int line, const char* expression)
+    //!
+    //! \brief Partially sorts an array so that one element is in its sorted position with bounds checking and an
+    //! optional context parameter.
+    //!
+    //! After this function returns, the element at index \a nth is the element that would be there if the whole array
+    //! were sorted. Every element before it compares less than or equal to it and every element after it compares
+    //! greater than or equal to it. The order within each side is unspecified.
+    //!
+    //! \param[in,out] ptr Pointer to the array.
+    //! \param[in] count Number of elements in the array.
+    //! \param[in] size Size of each element in the array.
+    //! \param[in] nth Index of the element to place in its sorted position.
+    //! \param[in] compare Comparison function to determine the order of the elements.
+    //! \param[in] context Optional context parameter for the comparison function.
+    //! \param[in] file The source file name where this function is called.
+    //! \param[in] function The function name where this function is called.
+    //! \param[in] line The line number where this function is called.
+    //! \param[in] expression The expression being evaluated.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a count or \a size is > RSIZE_MAX
+    //!
+    //! - \a ptr or \a compare is a null pointer (unless count is zero)
+    //!
+    //! - \a nth >= \a count (unless count is zero)
+    M_PARAM_RW(1)
+    CONSTRAINT_NO_DISCARD errno_t safe_nth_element_context_impl(void* M_NONNULL        ptr,
+                                                                rsize_t                count,
+                                                                rsize_t                size,
+                                                                rsize_t                nth,
+                                                                ctxcomparefn M_NONNULL compare,
+                                                                void* M_NULLABLE       context,
+                                                                const char* M_NULLABLE file,
+                                                                const char* M_NULLABLE function,
+                                                                int                    line,
+                                                                const char* M_NULLABLE expression)
+        // clang-format off
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_ALG_VOID(ptr), "ptr is NULL and count > 0")
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_CTXCOMPARE(compare), "compare function is NULL and count > 0")
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && nth >= count, "nth >= count")
+        M_DIAG_ERROR(count > RSIZE_MAX, "count > RSIZE_MAX")
+        M_DIAG_ERROR(size > RSIZE_MAX, "size > RSIZE_MAX")
+        // clang-format on
+        ;
+
+    //! \fn errno_t safe_partial_sort_context_impl(void* ptr, rsize_t count, rsize_t size, rsize_t middle, ctxcomparefn
+    //! compare, void* context, const char* file, const char* function, int line, const char* expression)
+    //!
+    //! \brief Sorts the smallest elements of an array into its beginning with bounds checking and an optional context
+    //! parameter.
+    //!
+    //! After this function returns, the first \a middle elements of the array are the smallest \a middle elements in
+    //! sorted order. The order of the remaining elements is unspecified.
+    //!
+    //! \param[in,out] ptr Pointer to the array.
+    //! \param[in] count Number of elements in the array.
+    //! \param[in] size Size of each element in the array.
+    //! \param[in] middle Number of elements to sort into the beginning of the array.
+    //! \param[in] compare Comparison function to determine the order of the elements.
+    //! \param[in] context Optional context parameter for the comparison function.
+    //! \param[in] file The source file name where this function is called.
+    //! \param[in] function The function name where this function is called.
+    //! \param[in] line The line number where this function is called.
+    //! \param[in] expression The expression being evaluated.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a count or \a size is > RSIZE_MAX
+    //!
+    //! - \a ptr or \a compare is a null pointer (unless count is zero)
+    //!
+    //! - \a middle > \a count
+    M_PARAM_RW(1)
+    CONSTRAINT_NO_DISCARD errno_t safe_partial_sort_context_impl(void* M_NONNULL        ptr,
+                                                                 rsize_t                count,
+                                                                 rsize_t                size,
+                                                                 rsize_t                middle,
+                                                                 ctxcomparefn M_NONNULL compare,
+                                                                 void* M_NULLABLE       context,
+                                                                 const char* M_NULLABLE file,
+                                                                 const char* M_NULLABLE function,
+                                                                 int                    line,
+                                                                 const char* M_NULLABLE expression)
+        // clang-format off
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_ALG_VOID(ptr), "ptr is NULL and count > 0")
+        M_DIAG_ERROR(count > RSIZE_T_C(0) && M_IS_NULL_CTXCOMPARE(compare), "compare function is NULL and count > 0")
+        M_DIAG_ERROR(middle > count, "middle > count")
+        M_DIAG_ERROR(count > RSIZE_MAX, "count > RSIZE_MAX")
+        M_DIAG_ERROR(size > RSIZE_MAX, "size > RSIZE_MAX")
+        // clang-format on
+        ;
+
+    //! \fn errno_t safe_top_k_context_impl(void* dest, rsize_t k, const void* ptr, rsize_t count, rsize_t size,
+    //! ctxcomparefn compare, void* context, const char* file, const char* function, int line, const char* expression)
+    //!
+    //! \brief Copies the largest elements of an array into another array in descending order with bounds checking and
+    //! an optional context parameter.
+    //!
+    //! The source array is not modified. \a dest is used as a min-heap of the \a k largest elements seen so far while
+    //! the source is read once from start to end, so this runs in O(count log k) and works well when \a k is much
+    //! smaller than \a count. To get the smallest elements instead, pass a comparison function that reverses the order.
+    //!
+    //! \param[out] dest Pointer to an array of at least \a k elements that receives the result, largest first.
+    //! \param[in] k Number of elements to select.
+    //! \param[in] ptr Pointer to the source array.
+    //! \param[in] count Number of elements in the source array.
+    //! \param[in] size Size of each element in the arrays.
+    //! \param[in] compare Comparison function to determine the order of the elements.
+    //! \param[in] context Optional context parameter for the comparison function.
+    //! \param[in] file The source file name where this function is called.
+    //! \param[in] function The function name where this function is called.
+    //! \param[in] line The line number where this function is called.
+    //! \param[in] expression The expression being evaluated.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a k, \a count or \a size is > RSIZE_MAX
+    //!
+    //! - \a k * \a size is > RSIZE_MAX
+    //!
+    //! - \a dest, \a ptr or \a compare is a null pointer (unless k is zero)
+    //!
+    //! - \a k > \a count
+    //!
+    //! - \a dest overlaps \a ptr
+    M_PARAM_WO(1)
+    M_PARAM_RO(3)
+    CONSTRAINT_NO_DISCARD errno_t safe_top_k_context_impl(void* M_NONNULL        dest,
+                                                          rsize_t                k,
+                                                          const void* M_NONNULL  ptr,
+                                                          rsize_t                count,
+                                                          rsize_t                size,
+                                                          ctxcomparefn M_NONNULL compare,
+                                                          void* M_NULLABLE       context,
+                                                          const char* M_NULLABLE file,
+                                                          const char* M_NULLABLE function,
+                                                          int                    line,
+                                                          const char* M_NULLABLE expression)
+        // clang-format off
+        M_DIAG_ERROR(k > RSIZE_T_C(0) && M_IS_NULL_ALG_VOID(dest), "dest is NULL and k > 0")
+        M_DIAG_ERROR(k > RSIZE_T_C(0) && M_IS_NULL_ALG_CONST_VOID(ptr), "ptr is NULL and k > 0")
+        M_DIAG_ERROR(k > RSIZE_T_C(0) && M_IS_NULL_CTXCOMPARE(compare), "compare function is NULL and k > 0")
+        M_DIAG_ERROR(k > count, "k > count")
+        M_DIAG_ERROR(count > RSIZE_MAX, "count > RSIZE_MAX")
+        M_DIAG_ERROR(size > RSIZE_MAX, "size > RSIZE_MAX")
+        // clang-format on
+        ;
+
 #if defined(__cplusplus)
 }
 #endif
@@ -1091,7 +1091,9 @@ extern "C"
     };
 
 // These safe string to long conversion functions check for NULL ptr on str and value.
-// They properly check errno for range errors, and detect invalid conversions too
+// They properly check errno for range errors, and detect invalid conversions too.
+// The integer conversions parse the text themselves rather than calling strtol and friends, so they behave as strtol
+// does in the "C" locale regardless of the current locale.
 #if defined(DEV_ENVIRONMENT)
     //! \fn errno_t safe_strtol(long* value, const char* M_RESTRICT str, char** M_RESTRICT endp, int base)
     //! \brief Converts a string to a long integer with bounds checking.
@@ -1736,6 +1738,77 @@ extern "C"
         safe_atof_impl(value, str, __FILE__, __func__, __LINE__, "safe_atof(" #value ", " #str ")")
 #endif
 
+    //! \fn errno_t parse_Integer_List_uint64(const char* buffer, size_t length, const char* delimiters, int base,
+    //! uint64_t* values, size_t capacity, size_t* count, size_t* consumed)
+    //! \brief Parses a list of unsigned integers such as a CSV row into an array in one call.
+    //!
+    //! Each value is read the same way as safe_strtoull in the "C" locale, without the overhead of a separate call
+    //! per value. Whitespace around values is skipped. Values are separated by whitespace, by one of the characters
+    //! in \a delimiters, or both. Two delimiters in a row are an empty field, which is an error. A trailing delimiter
+    //! is allowed. Parsing ends at \a length, at a null terminator, or when \a capacity values have been stored.
+    //! \code
+    //! uint64_t lbas[64];
+    //! size_t   lbaCount = 0;
+    //! errno_t  result   = parse_Integer_List_uint64(line, lineLength, ",", BASE_0_AUTO, lbas, 64, &lbaCount, NULL);
+    //! \endcode
+    //! \param[in] buffer characters to parse. Does not need to be null terminated.
+    //! \param[in] length number of characters in \a buffer
+    //! \param[in] delimiters null terminated list of characters that separate values. May be empty to only allow
+    //! whitespace.
+    //! \param[in] base base of the values, as for safe_strtoull
+    //! \param[out] values array to store the values in
+    //! \param[in] capacity number of values \a values can hold
+    //! \param[out] count number of values stored
+    //! \param[out] consumed optional. Offset in \a buffer where parsing stopped. When \a capacity was reached, this is
+    //! where to continue from. On an error, this is the start of the field that could not be parsed.
+    //! \return 0 on success, EINVAL if a pointer is NULL, \a base is invalid, or a field is not a number, or ERANGE if
+    //! a value is negative or too large for uint64_t
+    M_PARAM_RO_SIZE(1, 2)
+    M_PARAM_RO(3)
+    M_NULL_TERM_STRING(3)
+    M_PARAM_WO_SIZE(5, 6)
+    M_PARAM_WO(7)
+    M_PARAM_WO(8)
+    errno_t parse_Integer_List_uint64(const char* M_NONNULL buffer,
+                                      size_t                length,
+                                      const char* M_NONNULL delimiters,
+                                      int                   base,
+                                      uint64_t* M_NONNULL   values,
+                                      size_t                capacity,
+                                      size_t* M_NONNULL     count,
+                                      size_t* M_NULLABLE    consumed);
+
+    //! \fn errno_t parse_Integer_List_int64(const char* buffer, size_t length, const char* delimiters, int base,
+    //! int64_t* values, size_t capacity, size_t* count, size_t* consumed)
+    //! \brief Parses a list of signed integers into an array in one call. Values are read like safe_strtoll.
+    //!
+    //! Delimiters and errors are handled the same as parse_Integer_List_uint64. A delimiter should not be '+' or '-'
+    //! since those are read as signs.
+    //! \param[in] buffer characters to parse. Does not need to be null terminated.
+    //! \param[in] length number of characters in \a buffer
+    //! \param[in] delimiters null terminated list of characters that separate values
+    //! \param[in] base base of the values, as for safe_strtoll
+    //! \param[out] values array to store the values in
+    //! \param[in] capacity number of values \a values can hold
+    //! \param[out] count number of values stored
+    //! \param[out] consumed optional. Offset in \a buffer where parsing stopped.
+    //! \return 0 on success, EINVAL if a pointer is NULL, \a base is invalid, or a field is not a number, or ERANGE if
+    //! a value does not fit in int64_t
+    M_PARAM_RO_SIZE(1, 2)
+    M_PARAM_RO(3)
+    M_NULL_TERM_STRING(3)
+    M_PARAM_WO_SIZE(5, 6)
+    M_PARAM_WO(7)
+    M_PARAM_WO(8)
+    errno_t parse_Integer_List_int64(const char* M_NONNULL buffer,
+                                     size_t                length,
+                                     const char* M_NONNULL delimiters,
+                                     int                   base,
+                                     int64_t* M_NONNULL    values,
+                                     size_t                capacity,
+                                     size_t* M_NONNULL     count,
+                                     size_t* M_NULLABLE    consumed);
+
     //! \fn errno_t checked_fputs(const char* nofmt, FILE* out)
     //! \brief calls fputs and checks for EOF on error. Will output an error to stderr
     //!        if the error can be translated successfully.
@@ -20,19 +20,49 @@ extern "C"
 {
 #endif
 
-    //! \fn eReturnValues fill_Random_Pattern_In_Buffer(uint8_t* ptrData, uint32_t dataLength)
+    //! \fn eReturnValues fill_Random_Pattern_At_Offset(uint64_t seed, uint64_t streamOffset, uint8_t* ptrData,
+    //!                                                 size_t dataLength)
+    //! \brief Fills user provided buffer with part of a repeatable random byte stream.
+    //!
+    //! The stream is defined only by \a seed, and each byte of it depends only on its offset in the stream. Any part of
+    //! it can be generated on its own, in any order, and the result is the same as slicing one large fill. The byte
+    //! order is the same on every platform. This makes it possible to write random data to a device and later
+    //! regenerate the expected data for any LBA to check what was read back.
+    //! \code
+    //! // data for an LBA range written with one seed across the whole device
+    //! fill_Random_Pattern_At_Offset(seed, lba * logicalSectorSize, buffer, sectorCount * logicalSectorSize);
+    //! \endcode
+    //! \param[in] seed selects the stream
+    //! \param[in] streamOffset offset in the stream, in bytes, of the first byte to write to \a ptrData
+    //! \param[out] ptrData pointer to the databuffer to fill with random data
+    //! \param[in] dataLength size of buffer pointer to by \a ptrData
+    //! \return SUCCESS is successful. BAD_PARAMETER is invalid parameter value.
+    M_PARAM_WO_SIZE(3, 4)
+    eReturnValues fill_Random_Pattern_At_Offset(uint64_t           seed,
+                                                uint64_t           streamOffset,
+                                                uint8_t* M_NONNULL ptrData,
+                                                size_t             dataLength)
+        // clang-format off
+    M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
+        // clang-format on
+        ;
+
+    //! \fn eReturnValues fill_Random_Pattern_In_Buffer(uint8_t* ptrData, size_t dataLength)
     //! \brief Fills user provided buffer with random data
+    //!
+    //! Each call uses a new seed taken from the calling thread's get_Thread_PRNG_State stream. Use
+    //! fill_Random_Pattern_At_Offset when the data needs to be regenerated later.
     //! \param[out] ptrData pointer to the databuffer to fill with random data
     //! \param[in] dataLength size of buffer pointer to by \a ptrData
     //! \return SUCCESS is successful. BAD_PARAMETER is invalid parameter value.
     M_PARAM_WO_SIZE(1, 2)
-    eReturnValues fill_Random_Pattern_In_Buffer(uint8_t* M_NONNULL ptrData, uint32_t dataLength)
+    eReturnValues fill_Random_Pattern_In_Buffer(uint8_t* M_NONNULL ptrData, size_t dataLength)
         // clang-format off
     M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
         // clang-format on
         ;
 
-    //! \fn eReturnValues fill_Hex_Pattern_In_Buffer(uint32_t hexPattern, uint8_t* ptrData, uint32_t dataLength)
+    //! \fn eReturnValues fill_Hex_Pattern_In_Buffer(uint32_t hexPattern, uint8_t* ptrData, size_t dataLength)
     //! \brief Fills user provided buffer with provided hexadecimal pattern
     //! to the entire buffer
     //! \param[in] hexPattern pattern to write to \a ptrData
@@ -40,13 +70,13 @@ extern "C"
     //! \param[in] dataLength size of buffer pointer to by \a ptrData
     //! \return SUCCESS is successful. BAD_PARAMETER is invalid parameter value.
     M_PARAM_WO_SIZE(2, 3)
-    eReturnValues fill_Hex_Pattern_In_Buffer(uint32_t hexPattern, uint8_t* M_NONNULL ptrData, uint32_t dataLength)
+    eReturnValues fill_Hex_Pattern_In_Buffer(uint32_t hexPattern, uint8_t* M_NONNULL ptrData, size_t dataLength)
         // clang-format off
     M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
         // clang-format on
         ;
 
-    //! \fn eReturnValues fill_Incrementing_Pattern_In_Buffer(uint8_t incrementStartValue, uint8_t* ptrData, uint32_t
+    //! \fn eReturnValues fill_Incrementing_Pattern_In_Buffer(uint8_t incrementStartValue, uint8_t* ptrData, size_t
     //! dataLength)
     //! \brief Fills user provided buffer with an incrementing pattern from a given start point
     //! \param[in] incrementStartValue starting value to use for incrementing pattern
@@ -57,14 +87,14 @@ extern "C"
     M_PARAM_WO_SIZE(2, 3)
     eReturnValues fill_Incrementing_Pattern_In_Buffer(uint8_t            incrementStartValue,
                                                       uint8_t* M_NONNULL ptrData,
-                                                      uint32_t           dataLength)
+                                                      size_t             dataLength)
         // clang-format off
     M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
         // clang-format on
         ;
 
-    //! \fn eReturnValues fill_ASCII_Pattern_In_Buffer(const char* asciiPattern, uint32_t patternLength,
-    //!                                                uint8_t* ptrData, uint32_t dataLength)
+    //! \fn eReturnValues fill_ASCII_Pattern_In_Buffer(const char* asciiPattern, size_t patternLength,
+    //!                                                uint8_t* ptrData, size_t dataLength)
     //! \brief Fills user provided buffer with an ASCII pattern (string)
     //! \param[in] asciiPattern ASCII pattern to use when filling buffer
     //! \param[in] patternLength length of ASCII string to use. Allows for truncating input string if desired
@@ -74,18 +104,18 @@ extern "C"
     M_PARAM_RO_SIZE(1, 2)
     M_PARAM_WO_SIZE(3, 4)
     eReturnValues fill_ASCII_Pattern_In_Buffer(const char* M_NONNULL asciiPattern,
-                                               uint32_t              patternLength,
+                                               size_t                patternLength,
                                                uint8_t* M_NONNULL    ptrData,
-                                               uint32_t              dataLength)
+                                               size_t                dataLength)
         // clang-format off
     M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
         // clang-format on
         ;
 
     //! \fn eReturnValues fill_Pattern_Buffer_Into_Another_Buffer(uint8_t* inPattern,
-    //!                                                           uint32_t inpatternLength,
+    //!                                                           size_t inpatternLength,
     //!                                                           uint8_t* ptrData,
-    //!                                                           uint32_t dataLength)
+    //!                                                           size_t dataLength)
     //! \brief   Fills a buffer from a pattern memory buffer and will
     //! repeat the pattern to fill the out buffer.
     //!
@@ -103,15 +133,433 @@ extern "C"
     M_PARAM_RO_SIZE(1, 2)
     M_PARAM_WO_SIZE(3, 4)
     eReturnValues fill_Pattern_Buffer_Into_Another_Buffer(uint8_t* M_NONNULL inPattern,
-                                                          uint32_t           inpatternLength,
+                                                          size_t             inpatternLength,
                                                           uint8_t* M_NONNULL ptrData,
-                                                          uint32_t           dataLength)
+                                                          size_t             dataLength)
+        // clang-format off
+    M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
+    M_DIAG_ERROR(inpatternLength == 0, "inpatternLength must be non-zero")
+        // clang-format on
+        ;
+
+    //! \enum ePatternType
+    //! \brief Kinds of pattern a patternFill can describe.
+    typedef enum ePatternTypeEnum
+    {
+        PATTERN_TYPE_HEX,           /*!< same result as fill_Hex_Pattern_In_Buffer */
+        PATTERN_TYPE_INCREMENTING,  /*!< same result as fill_Incrementing_Pattern_In_Buffer */
+        PATTERN_TYPE_ASCII,         /*!< same result as fill_ASCII_Pattern_In_Buffer */
+        PATTERN_TYPE_BUFFER,        /*!< same result as fill_Pattern_Buffer_Into_Another_Buffer */
+        PATTERN_TYPE_RANDOM,        /*!< same result as fill_Random_Pattern_At_Offset */
+        PATTERN_TYPE_DATA_REDUCTION /*!< random data with a chosen amount of compressible and duplicate data */
+    } ePatternType;
+
+    //! \struct patternFill
+    //! \brief Describes a pattern so that any part of a buffer can be filled on its own.
+    //!
+    //! Only the fields used by \a type need to be set.
+    //!
+    //! PATTERN_TYPE_DATA_REDUCTION generates data for testing devices that compress or deduplicate. The stream is cut
+    //! into blocks of \a blockSize bytes. \a dedupPercent of the blocks, picked at random, repeat content from a pool
+    //! of PATTERN_DEDUP_POOL_SIZE blocks, and every other block is unique. Within each block the first
+    //! 100 - \a compressPercent percent of the bytes are random and the rest repeat a single byte. To target a
+    //! compression ratio of R:1 use compressPercent = 100 - 100 / R, and likewise for a dedup ratio. For example 2:1
+    //! is 50 and 4:1 is 75. The ratio reached by a real device also depends on its own block size and algorithm.
+    //! Every byte is derived from \a seed and its offset, so the same data can be generated again in any order.
+    typedef struct spatternFill
+    {
+        ePatternType   type;                /*!< pattern to generate */
+        uint32_t       hexPattern;          /*!< PATTERN_TYPE_HEX: value repeated through the buffer */
+        uint8_t        incrementStartValue; /*!< PATTERN_TYPE_INCREMENTING: value of the first byte */
+        const uint8_t* pattern;             /*!< PATTERN_TYPE_ASCII and PATTERN_TYPE_BUFFER: bytes to repeat */
+        size_t         patternLength;       /*!< PATTERN_TYPE_ASCII and PATTERN_TYPE_BUFFER: length of \a pattern */
+        uint64_t       seed;                /*!< PATTERN_TYPE_RANDOM and PATTERN_TYPE_DATA_REDUCTION: data seed */
+        uint64_t       streamOffset;        /*!< PATTERN_TYPE_RANDOM and PATTERN_TYPE_DATA_REDUCTION: stream offset */
+        size_t         blockSize;           /*!< PATTERN_TYPE_DATA_REDUCTION: size of each block, such as 4096 */
+        uint8_t        compressPercent;     /*!< PATTERN_TYPE_DATA_REDUCTION: compressible part of each block, 0-100 */
+        uint8_t        dedupPercent;        /*!< PATTERN_TYPE_DATA_REDUCTION: share of duplicate blocks, 0-100 */
+    } patternFill;
+
+    //! \def PATTERN_DEDUP_POOL_SIZE
+    //! \brief Number of different block contents shared by the duplicate blocks of PATTERN_TYPE_DATA_REDUCTION.
+#define PATTERN_DEDUP_POOL_SIZE UINT64_C(256)
+
+    //! \def PATTERN_FILL_MIN_CHUNK_SIZE
+    //! \brief Smallest amount of data worth giving to its own thread. Smaller buffers are filled as one chunk.
+#define PATTERN_FILL_MIN_CHUNK_SIZE (SIZE_T_C(1024) * SIZE_T_C(1024))
+
+    //! \fn uint32_t get_Pattern_Fill_Chunk_Count(size_t dataLength, uint32_t threadCount)
+    //! \brief Decides how many chunks to split a pattern fill into.
+    //!
+    //! The result is at most \a threadCount, and is reduced so that each chunk is at least PATTERN_FILL_MIN_CHUNK_SIZE.
+    //! Below that size the result is 1 and the fill should be done on the calling thread.
+    //! \param[in] dataLength size of the buffer that will be filled
+    //! \param[in] threadCount number of threads available. 0 is treated as 1.
+    //! \return number of chunks to pass to fill_Pattern_Chunk_In_Buffer. Always at least 1.
+    M_NODISCARD uint32_t get_Pattern_Fill_Chunk_Count(size_t dataLength, uint32_t threadCount);
+
+    //! \fn eReturnValues fill_Pattern_Chunk_In_Buffer(const patternFill* fill, uint8_t* ptrData, size_t dataLength,
+    //!                                                 uint32_t chunkCount, uint32_t chunkIndex)
+    //! \brief Fills one chunk of a buffer with a pattern.
+    //!
+    //! The buffer is split into \a chunkCount chunks that start on page boundaries (get_System_Pagesize) measured from
+    //! \a ptrData. Each chunk is generated from its position alone, so chunks can be filled by different threads in
+    //! any order and the buffer ends up identical to a fill_Pattern_In_Buffer call. Chunks never share a page, so
+    //! threads do not contend for the same cache lines when \a ptrData is page aligned.
+    //! \code
+    //! uint32_t chunks = get_Pattern_Fill_Chunk_Count(dataLength, threadCount);
+    //! // run on each worker thread with its own chunkIndex from 0 to chunks - 1
+    //! fill_Pattern_Chunk_In_Buffer(&fill, ptrData, dataLength, chunks, chunkIndex);
+    //! \endcode
+    //! \param[in] fill pattern to generate
+    //! \param[out] ptrData pointer to the start of the whole buffer. Only the chunk's bytes are written.
+    //! \param[in] dataLength size of the whole buffer pointed to by \a ptrData
+    //! \param[in] chunkCount number of chunks the buffer is split into
+    //! \param[in] chunkIndex chunk to fill, from 0 to \a chunkCount - 1
+    //! \return SUCCESS is successful. BAD_PARAMETER is invalid parameter value.
+    M_PARAM_RO(1)
+    M_PARAM_WO_SIZE(2, 3)
+    eReturnValues fill_Pattern_Chunk_In_Buffer(const patternFill* M_NONNULL fill,
+                                               uint8_t* M_NONNULL           ptrData,
+                                               size_t                       dataLength,
+                                               uint32_t                     chunkCount,
+                                               uint32_t                     chunkIndex)
+        // clang-format off
+    M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
+    M_DIAG_ERROR(chunkIndex >= chunkCount, "chunkIndex must be less than chunkCount")
+        // clang-format on
+        ;
+
+    //! \fn eReturnValues fill_Pattern_In_Buffer(const patternFill* fill, uint8_t* ptrData, size_t dataLength)
+    //! \brief Fills a whole buffer with a pattern on the calling thread.
+    //! \param[in] fill pattern to generate
+    //! \param[out] ptrData pointer to the databuffer to fill
+    //! \param[in] dataLength size of buffer pointer to by \a ptrData
+    //! \return SUCCESS is successful. BAD_PARAMETER is invalid parameter value.
+    M_PARAM_RO(1)
+    M_PARAM_WO_SIZE(2, 3)
+    eReturnValues fill_Pattern_In_Buffer(const patternFill* M_NONNULL fill,
+                                         uint8_t* M_NONNULL           ptrData,
+                                         size_t                       dataLength)
+        // clang-format off
+    M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
+        // clang-format on
+        ;
+
+    //! \struct patternMismatchRange
+    //! \brief A run of consecutive bytes that did not match the expected pattern.
+    typedef struct spatternMismatchRange
+    {
+        size_t offset; /*!< offset of the first mismatching byte of the run */
+        size_t length; /*!< number of mismatching bytes in the run */
+    } patternMismatchRange;
+
+    //! \struct patternVerifyResult
+    //! \brief Details of the differences found by the verify_*_Pattern functions.
+    //!
+    //! Set \a ranges and \a rangeCapacity before calling to collect mismatching ranges, or set them to NULL and 0 to
+    //! only count mismatches. The remaining fields are filled in by the verify function.
+    typedef struct spatternVerifyResult
+    {
+        size_t                firstMismatch;   /*!< offset of the first mismatching byte. dataLength when all match. */
+        size_t                mismatchCount;   /*!< total number of mismatching bytes */
+        patternMismatchRange* ranges;          /*!< caller provided array for mismatching ranges. May be NULL. */
+        size_t                rangeCapacity;   /*!< number of entries \a ranges can hold */
+        size_t                rangeCount;      /*!< number of entries written to \a ranges */
+        bool                  rangesTruncated; /*!< true when some mismatches did not fit in \a ranges */
+    } patternVerifyResult;
+
+    //! \fn eReturnValues verify_Pattern_In_Buffer(const patternFill* fill, const uint8_t* ptrData, size_t dataLength,
+    //!                                             patternVerifyResult* result)
+    //! \brief Checks that a buffer holds the pattern that fill_Pattern_In_Buffer would write.
+    //!
+    //! The expected data is regenerated a block at a time and compared with memcmp, so a matching buffer is checked at
+    //! close to memory bandwidth. Blocks that differ are scanned a word at a time to count and locate the mismatches.
+    //! \param[in] fill pattern the buffer should hold
+    //! \param[in] ptrData pointer to the databuffer to check
+    //! \param[in] dataLength size of buffer pointer to by \a ptrData
+    //! \param[in,out] result optional details of the mismatches. When NULL the check stops at the first mismatch.
+    //! \return SUCCESS if every byte matches. VALIDATION_FAILURE if any byte differs. BAD_PARAMETER is invalid
+    //! parameter value.
+    M_PARAM_RO(1)
+    M_PARAM_RO_SIZE(2, 3)
+    eReturnValues verify_Pattern_In_Buffer(const patternFill* M_NONNULL    fill,
+                                           const uint8_t* M_NONNULL        ptrData,
+                                           size_t                          dataLength,
+                                           patternVerifyResult* M_NULLABLE result)
+        // clang-format off
+    M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
+        // clang-format on
+        ;
+
+    //! \fn eReturnValues verify_Hex_Pattern_In_Buffer(uint32_t hexPattern, const uint8_t* ptrData, size_t dataLength,
+    //!                                                 patternVerifyResult* result)
+    //! \brief Checks a buffer filled by fill_Hex_Pattern_In_Buffer. See verify_Pattern_In_Buffer.
+    //! \param[in] hexPattern pattern the buffer should hold
+    //! \param[in] ptrData pointer to the databuffer to check
+    //! \param[in] dataLength size of buffer pointer to by \a ptrData
+    //! \param[in,out] result optional details of the mismatches
+    //! \return SUCCESS if every byte matches. VALIDATION_FAILURE if any byte differs. BAD_PARAMETER is invalid
+    //! parameter value.
+    M_PARAM_RO_SIZE(2, 3)
+    eReturnValues verify_Hex_Pattern_In_Buffer(uint32_t                        hexPattern,
+                                               const uint8_t* M_NONNULL        ptrData,
+                                               size_t                          dataLength,
+                                               patternVerifyResult* M_NULLABLE result)
+        // clang-format off
+    M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
+        // clang-format on
+        ;
+
+    //! \fn eReturnValues verify_Incrementing_Pattern_In_Buffer(uint8_t incrementStartValue, const uint8_t* ptrData,
+    //!                                                          size_t dataLength, patternVerifyResult* result)
+    //! \brief Checks a buffer filled by fill_Incrementing_Pattern_In_Buffer. See verify_Pattern_In_Buffer.
+    //! \param[in] incrementStartValue value the first byte should hold
+    //! \param[in] ptrData pointer to the databuffer to check
+    //! \param[in] dataLength size of buffer pointer to by \a ptrData
+    //! \param[in,out] result optional details of the mismatches
+    //! \return SUCCESS if every byte matches. VALIDATION_FAILURE if any byte differs. BAD_PARAMETER is invalid
+    //! parameter value.
+    M_PARAM_RO_SIZE(2, 3)
+    eReturnValues verify_Incrementing_Pattern_In_Buffer(uint8_t                         incrementStartValue,
+                                                        const uint8_t* M_NONNULL        ptrData,
+                                                        size_t                          dataLength,
+                                                        patternVerifyResult* M_NULLABLE result)
+        // clang-format off
+    M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
+        // clang-format on
+        ;
+
+    //! \fn eReturnValues verify_ASCII_Pattern_In_Buffer(const char* asciiPattern, size_t patternLength,
+    //!                                                   const uint8_t* ptrData, size_t dataLength,
+    //!                                                   patternVerifyResult* result)
+    //! \brief Checks a buffer filled by fill_ASCII_Pattern_In_Buffer. See verify_Pattern_In_Buffer.
+    //! \param[in] asciiPattern ASCII pattern the buffer should hold
+    //! \param[in] patternLength length of \a asciiPattern that was used
+    //! \param[in] ptrData pointer to the databuffer to check
+    //! \param[in] dataLength size of buffer pointer to by \a ptrData
+    //! \param[in,out] result optional details of the mismatches
+    //! \return SUCCESS if every byte matches. VALIDATION_FAILURE if any byte differs. BAD_PARAMETER is invalid
+    //! parameter value.
+    M_PARAM_RO_SIZE(1, 2)
+    M_PARAM_RO_SIZE(3, 4)
+    eReturnValues verify_ASCII_Pattern_In_Buffer(const char* M_NONNULL           asciiPattern,
+                                                 size_t                          patternLength,
+                                                 const uint8_t* M_NONNULL        ptrData,
+                                                 size_t                          dataLength,
+                                                 patternVerifyResult* M_NULLABLE result)
+        // clang-format off
+    M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
+        // clang-format on
+        ;
+
+    //! \fn eReturnValues verify_Pattern_Buffer_In_Another_Buffer(const uint8_t* inPattern, size_t inpatternLength,
+    //!                                                            const uint8_t* ptrData, size_t dataLength,
+    //!                                                            patternVerifyResult* result)
+    //! \brief Checks a buffer filled by fill_Pattern_Buffer_Into_Another_Buffer. See verify_Pattern_In_Buffer.
+    //! \param[in] inPattern pattern the buffer should hold
+    //! \param[in] inpatternLength length of \a inPattern
+    //! \param[in] ptrData pointer to the databuffer to check
+    //! \param[in] dataLength size of buffer pointer to by \a ptrData
+    //! \param[in,out] result optional details of the mismatches
+    //! \return SUCCESS if every byte matches. VALIDATION_FAILURE if any byte differs. BAD_PARAMETER is invalid
+    //! parameter value.
+    M_PARAM_RO_SIZE(1, 2)
+    M_PARAM_RO_SIZE(3, 4)
+    eReturnValues verify_Pattern_Buffer_In_Another_Buffer(const uint8_t* M_NONNULL        inPattern,
+                                                          size_t                          inpatternLength,
+                                                          const uint8_t* M_NONNULL        ptrData,
+                                                          size_t                          dataLength,
+                                                          patternVerifyResult* M_NULLABLE result)
         // clang-format off
     M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
     M_DIAG_ERROR(inpatternLength == 0, "inpatternLength must be non-zero")
         // clang-format on
         ;
 
+    //! \fn eReturnValues verify_Random_Pattern_At_Offset(uint64_t seed, uint64_t streamOffset, const uint8_t* ptrData,
+    //!                                                    size_t dataLength, patternVerifyResult* result)
+    //! \brief Checks a buffer filled by fill_Random_Pattern_At_Offset. See verify_Pattern_In_Buffer.
+    //! \param[in] seed seed the buffer was filled with
+    //! \param[in] streamOffset stream offset of the first byte of \a ptrData
+    //! \param[in] ptrData pointer to the databuffer to check
+    //! \param[in] dataLength size of buffer pointer to by \a ptrData
+    //! \param[in,out] result optional details of the mismatches
+    //! \return SUCCESS if every byte matches. VALIDATION_FAILURE if any byte differs. BAD_PARAMETER is invalid
+    //! parameter value.
+    M_PARAM_RO_SIZE(3, 4)
+    eReturnValues verify_Random_Pattern_At_Offset(uint64_t                        seed,
+                                                  uint64_t                        streamOffset,
+                                                  const uint8_t* M_NONNULL        ptrData,
+                                                  size_t                          dataLength,
+                                                  patternVerifyResult* M_NULLABLE result)
+        // clang-format off
+    M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
+        // clang-format on
+        ;
+
+    //! \def LBA_STAMP_HEADER_SIZE
+    //! \brief Size of the header at the start of each LBA stamped sector.
+    //!
+    //! All fields are little endian: bytes 0-3 LBA_STAMP_MAGIC, 4-7 sector size, 8-15 LBA, 16-23 sequence number,
+    //! 24-31 timestamp.
+#define LBA_STAMP_HEADER_SIZE SIZE_T_C(32)
+
+    //! \def LBA_STAMP_TRAILER_SIZE
+    //! \brief Size of the little endian 64bit checksum at the end of each LBA stamped sector. It covers every byte of
+    //! the sector before it.
+#define LBA_STAMP_TRAILER_SIZE SIZE_T_C(8)
+
+    //! \def LBA_STAMP_MAGIC
+    //! \brief First 4 bytes of every LBA stamped sector ("LBST").
+#define LBA_STAMP_MAGIC UINT32_C(0x5453424C)
+
+    //! \def LBA_STAMP_ERROR_MAGIC
+    //! \brief The sector does not start with LBA_STAMP_MAGIC and the expected sector size.
+#define LBA_STAMP_ERROR_MAGIC UINT32_C(0x01)
+    //! \def LBA_STAMP_ERROR_CHECKSUM
+    //! \brief The trailer checksum does not match the rest of the sector.
+#define LBA_STAMP_ERROR_CHECKSUM UINT32_C(0x02)
+    //! \def LBA_STAMP_ERROR_LBA
+    //! \brief The header holds a different LBA. With a good checksum this means a misdirected read or write.
+#define LBA_STAMP_ERROR_LBA UINT32_C(0x04)
+    //! \def LBA_STAMP_ERROR_SEQUENCE
+    //! \brief The header holds a different sequence number. With a good checksum this means stale data.
+#define LBA_STAMP_ERROR_SEQUENCE UINT32_C(0x08)
+    //! \def LBA_STAMP_ERROR_PAYLOAD
+    //! \brief The bytes between the header and trailer do not match the payload pattern.
+#define LBA_STAMP_ERROR_PAYLOAD UINT32_C(0x10)
+
+    //! \struct lbaStamp
+    //! \brief Describes the sectors written by fill_LBA_Stamped_Pattern_In_Buffer.
+    //!
+    //! Each sector holds a header identifying it, then payload bytes, then a checksum. The payload byte at offset N
+    //! of a sector is the byte at offset LBA * sectorSize + N of \a payload, as if the whole device had been filled
+    //! with \a payload, so every sector's payload can be regenerated on its own.
+    typedef struct slbaStamp
+    {
+        uint32_t    sectorSize; /*!< bytes per sector (512, 4096, 4160, ...). Must hold the header and trailer. */
+        uint64_t    startLBA;   /*!< LBA of the first sector in the buffer */
+        uint64_t    sequence;   /*!< pass or write ID. Lets a verify tell current data from data of an earlier pass. */
+        uint64_t    timestamp;  /*!< stored in each header for diagnostics. Not checked when verifying. */
+        patternFill payload;    /*!< pattern for the bytes between the header and trailer */
+    } lbaStamp;
+
+    //! \struct lbaStampMismatch
+    //! \brief A sector that failed verification.
+    typedef struct slbaStampMismatch
+    {
+        uint64_t lba;           /*!< LBA the sector was read from */
+        uint64_t foundLBA;      /*!< LBA stored in the sector's header */
+        uint64_t foundSequence; /*!< sequence number stored in the sector's header */
+        uint32_t errors;        /*!< LBA_STAMP_ERROR_* flags */
+    } lbaStampMismatch;
+
+    //! \struct lbaStampVerifyResult
+    //! \brief Sectors that failed verification.
+    //!
+    //! Set \a mismatches and \a mismatchCapacity before calling to collect failing sectors, or set them to NULL and
+    //! 0 to only count them. The remaining fields are filled in by the verify function.
+    typedef struct slbaStampVerifyResult
+    {
+        uint64_t          badSectorCount;      /*!< number of sectors that failed */
+        lbaStampMismatch* mismatches;          /*!< caller provided array for failing sectors. May be NULL. */
+        size_t            mismatchCapacity;    /*!< number of entries \a mismatches can hold */
+        size_t            mismatchCount;       /*!< number of entries written to \a mismatches */
+        bool              mismatchesTruncated; /*!< true when some failing sectors did not fit in \a mismatches */
+    } lbaStampVerifyResult;
+
+    //! \fn eReturnValues fill_LBA_Stamped_Chunk_In_Buffer(const lbaStamp* stamp, uint8_t* ptrData, size_t dataLength,
+    //!                                                     uint32_t chunkCount, uint32_t chunkIndex)
+    //! \brief Writes LBA stamped sectors to one chunk of a buffer.
+    //!
+    //! The buffer is split into \a chunkCount chunks of whole sectors. Chunks can be filled by different threads in
+    //! any order with the same result as fill_LBA_Stamped_Pattern_In_Buffer. See get_Pattern_Fill_Chunk_Count.
+    //! \param[in] stamp description of the sectors to write
+    //! \param[out] ptrData pointer to the start of the whole buffer. Only the chunk's sectors are written.
+    //! \param[in] dataLength size of the whole buffer. Must be a multiple of the sector size.
+    //! \param[in] chunkCount number of chunks the buffer is split into
+    //! \param[in] chunkIndex chunk to fill, from 0 to \a chunkCount - 1
+    //! \return SUCCESS is successful. BAD_PARAMETER is invalid parameter value.
+    M_PARAM_RO(1)
+    M_PARAM_WO_SIZE(2, 3)
+    eReturnValues fill_LBA_Stamped_Chunk_In_Buffer(const lbaStamp* M_NONNULL stamp,
+                                                   uint8_t* M_NONNULL        ptrData,
+                                                   size_t                    dataLength,
+                                                   uint32_t                  chunkCount,
+                                                   uint32_t                  chunkIndex)
+        // clang-format off
+    M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
+    M_DIAG_ERROR(chunkIndex >= chunkCount, "chunkIndex must be less than chunkCount")
+        // clang-format on
+        ;
+
+    //! \fn eReturnValues fill_LBA_Stamped_Pattern_In_Buffer(const lbaStamp* stamp, uint8_t* ptrData,
+    //!                                                       size_t dataLength)
+    //! \brief Fills a buffer with LBA stamped sectors, starting at stamp->startLBA.
+    //! \param[in] stamp description of the sectors to write
+    //! \param[out] ptrData pointer to the databuffer to fill
+    //! \param[in] dataLength size of buffer pointer to by \a ptrData. Must be a multiple of the sector size.
+    //! \return SUCCESS is successful. BAD_PARAMETER is invalid parameter value.
+    M_PARAM_RO(1)
+    M_PARAM_WO_SIZE(2, 3)
+    eReturnValues fill_LBA_Stamped_Pattern_In_Buffer(const lbaStamp* M_NONNULL stamp,
+                                                     uint8_t* M_NONNULL        ptrData,
+                                                     size_t                    dataLength)
+        // clang-format off
+    M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
+        // clang-format on
+        ;
+
+    //! \fn eReturnValues verify_LBA_Stamped_Chunk_In_Buffer(const lbaStamp* stamp, const uint8_t* ptrData,
+    //!                                                       size_t dataLength, uint32_t chunkCount,
+    //!                                                       uint32_t chunkIndex, lbaStampVerifyResult* result)
+    //! \brief Checks the LBA stamped sectors in one chunk of a buffer.
+    //!
+    //! Chunks are split the same way as fill_LBA_Stamped_Chunk_In_Buffer. Give each thread its own \a result.
+    //! \param[in] stamp description of the sectors that were written
+    //! \param[in] ptrData pointer to the start of the whole buffer
+    //! \param[in] dataLength size of the whole buffer. Must be a multiple of the sector size.
+    //! \param[in] chunkCount number of chunks the buffer is split into
+    //! \param[in] chunkIndex chunk to check, from 0 to \a chunkCount - 1
+    //! \param[in,out] result optional list of failing sectors. When NULL the check stops at the first bad sector.
+    //! \return SUCCESS if every sector is correct. VALIDATION_FAILURE if any sector is wrong. BAD_PARAMETER is
+    //! invalid parameter value.
+    M_PARAM_RO(1)
+    M_PARAM_RO_SIZE(2, 3)
+    eReturnValues verify_LBA_Stamped_Chunk_In_Buffer(const lbaStamp* M_NONNULL        stamp,
+                                                     const uint8_t* M_NONNULL         ptrData,
+                                                     size_t                           dataLength,
+                                                     uint32_t                         chunkCount,
+                                                     uint32_t                         chunkIndex,
+                                                     lbaStampVerifyResult* M_NULLABLE result)
+        // clang-format off
+    M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
+    M_DIAG_ERROR(chunkIndex >= chunkCount, "chunkIndex must be less than chunkCount")
+        // clang-format on
+        ;
+
+    //! \fn eReturnValues verify_LBA_Stamped_Pattern_In_Buffer(const lbaStamp* stamp, const uint8_t* ptrData,
+    //!                                                         size_t dataLength, lbaStampVerifyResult* result)
+    //! \brief Checks that every sector of a buffer holds its own LBA, the expected sequence number, a good checksum
+    //! and the expected payload.
+    //! \param[in] stamp description of the sectors that were written
+    //! \param[in] ptrData pointer to the databuffer to check
+    //! \param[in] dataLength size of buffer pointer to by \a ptrData. Must be a multiple of the sector size.
+    //! \param[in,out] result optional list of failing sectors. When NULL the check stops at the first bad sector.
+    //! \return SUCCESS if every sector is correct. VALIDATION_FAILURE if any sector is wrong. BAD_PARAMETER is
+    //! invalid parameter value.
+    M_PARAM_RO(1)
+    M_PARAM_RO_SIZE(2, 3)
+    eReturnValues verify_LBA_Stamped_Pattern_In_Buffer(const lbaStamp* M_NONNULL        stamp,
+                                                       const uint8_t* M_NONNULL         ptrData,
+                                                       size_t                           dataLength,
+                                                       lbaStampVerifyResult* M_NULLABLE result)
+        // clang-format off
+    M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
+        // clang-format on
+        ;
+
 #if defined(__cplusplus)
 }
 #endif
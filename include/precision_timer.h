@@ -17,6 +17,8 @@
 #include "common_types.h"
 #include "memory_safety.h"
 
+#include <stdio.h>
+
 #if defined(__cplusplus)
 extern "C"
 {
@@ -51,6 +53,25 @@ extern "C"
         safe_free_core(M_REINTERPRET_CAST(void**, timer));
     }
 
+    //! \enum eTimerSource
+    //! \brief Clock that start_Timer and stop_Timer read.
+    typedef enum eTimerSourceEnum
+    {
+        TIMER_SOURCE_OS_CLOCK,   /*!< clock_gettime(CLOCK_MONOTONIC) or QueryPerformanceCounter */
+        TIMER_SOURCE_CPU_COUNTER /*!< invariant TSC on x86 or the generic timer count (cntvct_el0) on AArch64 */
+    } eTimerSource;
+
+    //! \fn eTimerSource get_Timer_Source(void)
+    //! \brief Gets the clock used by the timer functions.
+    //!
+    //! The clock is chosen once, on the first call to this function, start_Timer or stop_Timer. The CPU counter is read
+    //! without a system call, so it is much cheaper when timing millions of short operations. It is used on x86 when
+    //! the CPU reports an invariant TSC, after measuring its rate against the OS clock for about 5 milliseconds, and
+    //! on AArch64 using the rate the CPU reports. Otherwise the OS clock is used. Define DISABLE_CPU_TIMER when
+    //! building to always use the OS clock.
+    //! \return clock in use
+    M_NODISCARD eTimerSource get_Timer_Source(void);
+
     //! \fn void start_Timer(seatimer_t* timer)
     //! \brief start the timer
     //! \param[in,out] timer pointer to seatimer to start
@@ -65,49 +86,155 @@ extern "C"
     //! \brief get the number of nanoseconds elapsed between timer start and stop
     //! \param[in] timer timer with valid start and stop times to get the number of nanoseconds from
     //! \return uint64_t number of elapsed nanoseconds
-    M_NODISCARD M_CONST_FUNC uint64_t get_Nano_Seconds(seatimer_t timer)
+    M_NODISCARD uint64_t get_Nano_Seconds(seatimer_t timer)
         // clang-format off
     M_DIAG_ERROR(timer.timerStop < timer.timerStart, "timer stop time is before start time")
     M_DIAG_ERROR(timer.timerStart == UINT64_C(0), "timer was never started")
     M_DIAG_ERROR(timer.timerStop == UINT64_C(0), "timer was never stopped")
         // clang-format on
-        M_UNSEQUENCED;
+        ;
 
     //! \fn double get_Micro_Seconds(seatimer_t timer)
     //! \brief get the number of microseconds elapsed between timer start and stop
     //! \param[in] timer timer with valid start and stop times to get the number of microseconds from
     //! \return double number of elapsed microseconds
-    M_NODISCARD M_CONST_FUNC double get_Micro_Seconds(seatimer_t timer)
+    M_NODISCARD double get_Micro_Seconds(seatimer_t timer)
         // clang-format off
     M_DIAG_ERROR(timer.timerStop < timer.timerStart, "timer stop time is before start time")
     M_DIAG_ERROR(timer.timerStart == UINT64_C(0), "timer was never started")
     M_DIAG_ERROR(timer.timerStop == UINT64_C(0), "timer was never stopped")
         // clang-format on
-        M_UNSEQUENCED;
+        ;
 
     //! \fn double get_Milli_Seconds(seatimer_t timer)
     //! \brief get the number of milliseconds elapsed between timer start and stop
     //! \param[in] timer timer with valid start and stop times to get the number of milliseconds from
     //! \return double number of elapsed milliseconds
-    M_NODISCARD M_CONST_FUNC double get_Milli_Seconds(seatimer_t timer)
+    M_NODISCARD double get_Milli_Seconds(seatimer_t timer)
         // clang-format off
     M_DIAG_ERROR(timer.timerStop < timer.timerStart, "timer stop time is before start time")
     M_DIAG_ERROR(timer.timerStart == UINT64_C(0), "timer was never started")
     M_DIAG_ERROR(timer.timerStop == UINT64_C(0), "timer was never stopped")
         // clang-format on
-        M_UNSEQUENCED;
+        ;
 
     //! \fn double get_Seconds(seatimer_t timer)
     //! \brief get the number of sseconds elapsed between timer start and stop
     //! \param[in] timer timer with valid start and stop times to get the number of seconds from
     //! \return double number of elapsed seconds
-    M_CONST_FUNC double get_Seconds(seatimer_t timer)
+    double get_Seconds(seatimer_t timer)
         // clang-format off
     M_DIAG_ERROR(timer.timerStop < timer.timerStart, "timer stop time is before start time")
     M_DIAG_ERROR(timer.timerStart == UINT64_C(0), "timer was never started")
     M_DIAG_ERROR(timer.timerStop == UINT64_C(0), "timer was never stopped")
         // clang-format on
-        M_UNSEQUENCED;
+        ;
+
+    //! \struct latencyHistogram
+    //! \brief Opaque latency histogram handle. Create with create_Latency_Histogram and free with
+    //! free_Latency_Histogram.
+    //!
+    //! Values, normally nanoseconds, are counted in log-linear buckets like HdrHistogram: values below
+    //! 2^significantBits each get their own bucket, and every power of 2 above that is split into
+    //! 2^(significantBits - 1) equal buckets. Memory is fixed at creation, recording a value is a few instructions,
+    //! and any value reported back is within 2^(1 - significantBits) of the recorded value. For example 7 bits keeps
+    //! results within 1.6% and 10 bits within 0.2%.
+    //!
+    //! A histogram is not thread safe. Give each thread its own histogram with the same settings and combine them with
+    //! latency_Histogram_Merge.
+    typedef struct slatencyHistogram latencyHistogram;
+
+    //! \enum eLatencyHistogramFormat
+    //! \brief Output formats for print_Latency_Histogram.
+    typedef enum eLatencyHistogramFormatEnum
+    {
+        LATENCY_HISTOGRAM_TEXT, /*!< summary with count, min, mean, max and a table of common percentiles */
+        LATENCY_HISTOGRAM_CSV   /*!< one row per non-empty bucket with its count and cumulative percentile */
+    } eLatencyHistogramFormat;
+
+    //! \fn latencyHistogram* create_Latency_Histogram(uint8_t significantBits, uint64_t maxValue)
+    //! \brief Allocates a new, empty latency histogram.
+    //! \param[in] significantBits precision of the buckets, from 2 to 16. See latencyHistogram.
+    //! \param[in] maxValue largest value to track. Larger values are counted as \a maxValue. 0 tracks every value.
+    //! Smaller limits use less memory: with 7 bits, up to 1 hour in nanoseconds needs about 19KiB.
+    //! \return Pointer to the new histogram, or M_NULLPTR if \a significantBits is out of range or memory could not
+    //! be allocated.
+    M_NODISCARD_REASON("The returned pointer must be freed by the caller using free_Latency_Histogram()")
+    latencyHistogram* M_NULLABLE create_Latency_Histogram(uint8_t significantBits, uint64_t maxValue);
+
+    //! \fn void free_Latency_Histogram(latencyHistogram** histogram)
+    //! \brief Frees a latency histogram.
+    //! \param[in,out] histogram Pointer to the histogram to free. Set to M_NULLPTR on return.
+    void free_Latency_Histogram(latencyHistogram* M_NULLABLE* M_NULLABLE histogram);
+
+    //! \fn void latency_Histogram_Reset(latencyHistogram* histogram)
+    //! \brief Removes every recorded value, keeping the settings.
+    //! \param[in,out] histogram histogram to clear
+    M_PARAM_RW(1) void latency_Histogram_Reset(latencyHistogram* M_NONNULL histogram);
+
+    //! \fn void latency_Histogram_Record(latencyHistogram* histogram, uint64_t value)
+    //! \brief Counts one value.
+    //! \param[in,out] histogram histogram to add to
+    //! \param[in] value value to count, normally in nanoseconds
+    M_PARAM_RW(1) void latency_Histogram_Record(latencyHistogram* M_NONNULL histogram, uint64_t value);
+
+    //! \fn void latency_Histogram_Record_Timer(latencyHistogram* histogram, seatimer_t timer)
+    //! \brief Counts the nanoseconds between a timer's start and stop, as given by get_Nano_Seconds.
+    //! \param[in,out] histogram histogram to add to
+    //! \param[in] timer started and stopped timer
+    M_PARAM_RW(1) void latency_Histogram_Record_Timer(latencyHistogram* M_NONNULL histogram, seatimer_t timer);
+
+    //! \fn errno_t latency_Histogram_Merge(latencyHistogram* destination, const latencyHistogram* source)
+    //! \brief Adds every value counted in one histogram to another.
+    //! \param[in,out] destination histogram to add to
+    //! \param[in] source histogram to add from. Must have been created with the same settings.
+    //! \return 0 on success, EINVAL if a pointer is NULL or the histograms were created with different settings
+    M_PARAM_RW(1) M_PARAM_RO(2) errno_t latency_Histogram_Merge(latencyHistogram* M_NONNULL       destination,
+                                                                const latencyHistogram* M_NONNULL source);
+
+    //! \fn uint64_t latency_Histogram_Count(const latencyHistogram* histogram)
+    //! \brief Gets the number of values recorded.
+    //! \param[in] histogram histogram to read
+    //! \return number of values recorded
+    M_NODISCARD M_PARAM_RO(1) uint64_t latency_Histogram_Count(const latencyHistogram* M_NONNULL histogram);
+
+    //! \fn uint64_t latency_Histogram_Min(const latencyHistogram* histogram)
+    //! \brief Gets the smallest value recorded.
+    //! \param[in] histogram histogram to read
+    //! \return smallest value recorded, exactly, or 0 when empty
+    M_NODISCARD M_PARAM_RO(1) uint64_t latency_Histogram_Min(const latencyHistogram* M_NONNULL histogram);
+
+    //! \fn uint64_t latency_Histogram_Max(const latencyHistogram* histogram)
+    //! \brief Gets the largest value recorded.
+    //! \param[in] histogram histogram to read
+    //! \return largest value recorded, exactly unless it was above the histogram's maxValue, or 0 when empty
+    M_NODISCARD M_PARAM_RO(1) uint64_t latency_Histogram_Max(const latencyHistogram* M_NONNULL histogram);
+
+    //! \fn double latency_Histogram_Mean(const latencyHistogram* histogram)
+    //! \brief Gets the average of the recorded values, using the middle of each bucket.
+    //! \param[in] histogram histogram to read
+    //! \return mean value, or 0 when empty
+    M_NODISCARD M_PARAM_RO(1) double latency_Histogram_Mean(const latencyHistogram* M_NONNULL histogram);
+
+    //! \fn uint64_t latency_Histogram_Percentile(const latencyHistogram* histogram, double percentile)
+    //! \brief Gets the value that \a percentile percent of the recorded values are less than or equal to.
+    //! \param[in] histogram histogram to read
+    //! \param[in] percentile percentile from 0 to 100, such as 50, 99 or 99.9. 100 gives the maximum.
+    //! \return largest value that falls in the same bucket as the percentile, or 0 when empty
+    M_NODISCARD M_PARAM_RO(1) uint64_t latency_Histogram_Percentile(const latencyHistogram* M_NONNULL histogram,
+                                                                    double                            percentile);
+
+    //! \fn errno_t print_Latency_Histogram(const latencyHistogram* histogram, FILE* stream,
+    //!                                      eLatencyHistogramFormat format)
+    //! \brief Writes the histogram as a text summary or as CSV. Values are printed as recorded, normally nanoseconds.
+    //! \param[in] histogram histogram to print
+    //! \param[in] stream stream to write to, such as stdout or a file opened with safe_fopen
+    //! \param[in] format output format
+    //! \return 0 on success, EINVAL if a pointer is NULL or \a format is not a known value, EIO if writing failed
+    M_PARAM_RO(1)
+    errno_t print_Latency_Histogram(const latencyHistogram* M_NONNULL histogram,
+                                    FILE* M_NONNULL                   stream,
+                                    eLatencyHistogramFormat           format);
 
 #if defined(__cplusplus)
 }
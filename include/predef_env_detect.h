@@ -1079,12 +1079,19 @@ extern "C"
 #    if __has_builtin(__builtin___clear_cache)
 #        define HAS_BUILT_IN_CLEAR_CACHE
 #    endif
+#    if __has_builtin(__builtin_prefetch)
+#        define HAVE_BUILT_IN_PREFETCH
+#    endif
 #endif //__has_builtin
 
 #if !defined(HAVE_BUILT_IN_OBJ_SIZE) && IS_GCC_VERSION(4, 1)
 #    define HAVE_BUILT_IN_OBJ_SIZE
 #endif
 
+#if !defined(HAVE_BUILT_IN_PREFETCH) && IS_GCC_VERSION(3, 1)
+#    define HAVE_BUILT_IN_PREFETCH
+#endif
+
 #if IS_GCC_VERSION(3, 4)
 #    if !defined(HAVE_BUILT_IN_CLZ)
 #        define HAVE_BUILT_IN_CLZ
@@ -1158,6 +1165,35 @@ extern "C"
 #    define HAS_STRICT_ALIGNMENT 0
 #endif
 
+//! \def HAVE_SSE2
+//! \brief Defined when SSE2 intrinsics from emmintrin.h can be used without any additional compiler options.
+//! \details SSE2 is part of the x86_64 baseline so this is always defined for 64bit x86 builds. 32bit x86 builds
+//! only get this when the compiler has been told it may use SSE2. Define DISABLE_SIMD to force the portable code
+//! paths everywhere.
+#if !defined(HAVE_SSE2) && !defined(DISABLE_SIMD)
+#    if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#        define HAVE_SSE2
+#    endif
+#endif
+
+//! \def HAVE_NEON
+//! \brief Defined when ARM NEON (Advanced SIMD) intrinsics from arm_neon.h can be used without any additional
+//! compiler options.
+//! \details NEON is part of the AArch64 baseline. 32bit ARM only defines this when the compiler was told to use
+//! NEON.
+#if !defined(HAVE_NEON) && !defined(DISABLE_SIMD)
+#    if defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#        define HAVE_NEON
+#    endif
+#endif
+
+//! \def HAVE_NEON_A64
+//! \brief Defined when the AArch64 only NEON intrinsics (such as across vector reductions and 64bit lane compares)
+//! are also available.
+#if defined(HAVE_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+#    define HAVE_NEON_A64
+#endif
+
 #if defined(__cplusplus)
 }
 #endif
@@ -2,7 +2,8 @@
 
 //! \file prng.h
 //! \brief Implements psuedo random number generation functionality.
-//! Currently implemented using XOR shift+
+//! The global seed_32/seed_64 generators are implemented using XOR shift+. The prngState API provides independent
+//! streams using xoshiro256** or SplitMix64.
 //! \copyright
 //! Do NOT modify or remove this copyright and license
 //!
@@ -66,6 +67,212 @@ extern "C"
         // clang-format on
         ;
 
+    //! \enum ePRNGEngine
+    //! \brief Algorithms available to a prngState.
+    typedef enum ePRNGEngineEnum
+    {
+        PRNG_ENGINE_XOSHIRO256_STAR_STAR, /*!< xoshiro256**. Period of 2^256 - 1. Good general purpose choice. */
+        PRNG_ENGINE_SPLITMIX64 /*!< SplitMix64. Period of 2^64. Smallest and fastest to seed. */
+    } ePRNGEngine;
+
+    //! \struct prngState
+    //! \brief State of one pseudo random number stream.
+    //!
+    //! Unlike xorshiftplus32 and xorshiftplus64, which share one global state, each prngState is independent. Give
+    //! each thread its own state, either from get_Thread_PRNG_State or by jumping a copy of a common state with
+    //! prng_State_Jump so the streams never overlap.
+    //! \code
+    //! prngState workers[WORKER_COUNT];
+    //! init_PRNG_State(&workers[0], PRNG_ENGINE_XOSHIRO256_STAR_STAR, seed);
+    //! for (size_t worker = 1; worker < WORKER_COUNT; ++worker)
+    //! {
+    //!     workers[worker] = workers[worker - 1];
+    //!     prng_State_Jump(&workers[worker]);
+    //! }
+    //! \endcode
+    typedef struct sprngState
+    {
+        uint64_t    state[4]; /*!< generator state. SplitMix64 only uses the first entry. */
+        ePRNGEngine engine;   /*!< algorithm this state is used with */
+    } prngState;
+
+    //! \fn errno_t init_PRNG_State(prngState* prng, ePRNGEngine engine, uint64_t seed)
+    //! \brief Sets up a random number stream with the chosen algorithm.
+    //! \param[out] prng state to initialize
+    //! \param[in] engine algorithm to use
+    //! \param[in] seed starting value. Every seed, including zero, gives a usable stream.
+    //! \return 0 on success, EINVAL if \a prng is NULL or \a engine is not a known value
+    M_PARAM_WO(1) errno_t init_PRNG_State(prngState* M_NONNULL prng, ePRNGEngine engine, uint64_t seed);
+
+    //! \fn void prng_State_Seed(prngState* prng, uint64_t seed)
+    //! \brief Restarts a stream from a new seed, keeping its algorithm.
+    //! \param[in,out] prng state to reseed
+    //! \param[in] seed starting value
+    M_PARAM_RW(1) void prng_State_Seed(prngState* M_NONNULL prng, uint64_t seed);
+
+    //! \fn uint64_t prng_State_Next_64(prngState* prng)
+    //! \brief Generates the next 64 bits of a stream.
+    //! \param[in,out] prng state to advance
+    //! \return random 64bit unsigned integer
+    M_PARAM_RW(1) uint64_t prng_State_Next_64(prngState* M_NONNULL prng);
+
+    //! \fn uint32_t prng_State_Next_32(prngState* prng)
+    //! \brief Generates the next 32 bits of a stream, taken from the upper half of prng_State_Next_64.
+    //! \param[in,out] prng state to advance
+    //! \return random 32bit unsigned integer
+    M_PARAM_RW(1) uint32_t prng_State_Next_32(prngState* M_NONNULL prng);
+
+    //! \fn void prng_State_Jump(prngState* prng)
+    //! \brief Advances a stream far enough that the output before and after the jump will never overlap.
+    //!
+    //! xoshiro256** advances 2^128 values, which allows 2^128 streams. SplitMix64 advances 2^48 values, which allows
+    //! 2^16 streams of 2^48 values each.
+    //! \param[in,out] prng state to advance
+    M_PARAM_RW(1) void prng_State_Jump(prngState* M_NONNULL prng);
+
+    //! \def PRNG_COUNTER_GAMMA
+    //! \brief Odd increment that spaces counter values apart before mixing. Same constant SplitMix64 uses.
+#define PRNG_COUNTER_GAMMA UINT64_C(0x9E3779B97F4A7C15)
+
+    //! \fn uint64_t prng_Mix_64(uint64_t value)
+    //! \brief SplitMix64 finalizer. Maps every 64bit value to a different, well scrambled 64bit value.
+    //! \param[in] value value to scramble
+    //! \return scrambled value
+    static M_INLINE uint64_t prng_Mix_64(uint64_t value)
+    {
+        value = (value ^ (value >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+        value = (value ^ (value >> 27)) * UINT64_C(0x94D049BB133111EB);
+        return value ^ (value >> 31);
+    }
+
+    //! \fn uint64_t prng_Counter_Key(uint64_t seed)
+    //! \brief Turns a seed into the key used by prng_Counter_64.
+    //!
+    //! Compute this once per seed and reuse it for every counter value.
+    //! \param[in] seed seed of the counter based stream. Every seed, including zero, is usable.
+    //! \return key for prng_Counter_64
+    static M_INLINE uint64_t prng_Counter_Key(uint64_t seed)
+    {
+        return prng_Mix_64(seed ^ UINT64_C(0x6A09E667F3BCC909));
+    }
+
+    //! \fn uint64_t prng_Counter_64(uint64_t key, uint64_t counter)
+    //! \brief Counter based random numbers. Gives the 64bit value at position \a counter of the stream for \a key.
+    //!
+    //! Unlike prngState there is no state to advance: any position can be computed directly, in any order, and
+    //! always gives the same value. Use this when data has to be regenerated later from its position alone, such as
+    //! checking a buffer that was written earlier.
+    //! \param[in] key value from prng_Counter_Key
+    //! \param[in] counter position in the stream
+    //! \return random 64bit unsigned integer
+    static M_INLINE uint64_t prng_Counter_64(uint64_t key, uint64_t counter)
+    {
+        return prng_Mix_64(key + counter * PRNG_COUNTER_GAMMA);
+    }
+
+    //! \fn prngState* get_Thread_PRNG_State(void)
+    //! \brief Gets the calling thread's default random number stream.
+    //!
+    //! Each thread gets its own xoshiro256** state, seeded on first use from the time and the address of the state
+    //! so that threads do not produce the same values. Use prng_State_Seed on the result for a repeatable sequence.
+    //! \return pointer to the calling thread's stream. Never NULL.
+    //! \note If the compiler has no thread local storage, NO_THREAD_LOCAL is defined and all threads share one state.
+    M_NODISCARD prngState* M_NONNULL get_Thread_PRNG_State(void);
+
+    //! \fn errno_t prng_State_Fill_Range_32(prngState* prng, uint32_t rangeMin, uint32_t rangeMax, uint32_t step,
+    //!                                        uint32_t* values, size_t count)
+    //! \brief Fills an array with uniformly distributed values from rangeMin, rangeMin + step, ... up to rangeMax.
+    //!
+    //! Uses Lemire's multiply and shift method, which needs no division for almost every value and rejects the few
+    //! draws that would bias the result. The full range 0 to UINT32_MAX is supported.
+    //! \param[in,out] prng stream to draw from
+    //! \param[in] rangeMin smallest value to generate
+    //! \param[in] rangeMax largest value to generate. Rounded down to rangeMin plus a multiple of \a step.
+    //! \param[in] step distance between possible values, such as 8 for LBAs aligned to 8 sectors. Must not be 0.
+    //! \param[out] values array to fill
+    //! \param[in] count number of values to write to \a values
+    //! \return 0 on success, EINVAL if a pointer is NULL, \a step is 0 or \a rangeMax is less than \a rangeMin
+    M_PARAM_RW(1)
+    M_PARAM_WO_SIZE(5, 6)
+    errno_t prng_State_Fill_Range_32(prngState* M_NONNULL prng,
+                                     uint32_t             rangeMin,
+                                     uint32_t             rangeMax,
+                                     uint32_t             step,
+                                     uint32_t* M_NONNULL  values,
+                                     size_t               count);
+
+    //! \fn errno_t prng_State_Fill_Range_64(prngState* prng, uint64_t rangeMin, uint64_t rangeMax, uint64_t step,
+    //!                                        uint64_t* values, size_t count)
+    //! \brief Fills an array with uniformly distributed values from rangeMin, rangeMin + step, ... up to rangeMax.
+    //!
+    //! 64bit version of prng_State_Fill_Range_32. The full range 0 to UINT64_MAX is supported.
+    //! \param[in,out] prng stream to draw from
+    //! \param[in] rangeMin smallest value to generate
+    //! \param[in] rangeMax largest value to generate. Rounded down to rangeMin plus a multiple of \a step.
+    //! \param[in] step distance between possible values, such as 8 for LBAs aligned to 8 sectors. Must not be 0.
+    //! \param[out] values array to fill
+    //! \param[in] count number of values to write to \a values
+    //! \return 0 on success, EINVAL if a pointer is NULL, \a step is 0 or \a rangeMax is less than \a rangeMin
+    M_PARAM_RW(1)
+    M_PARAM_WO_SIZE(5, 6)
+    errno_t prng_State_Fill_Range_64(prngState* M_NONNULL prng,
+                                     uint64_t             rangeMin,
+                                     uint64_t             rangeMax,
+                                     uint64_t             step,
+                                     uint64_t* M_NONNULL  values,
+                                     size_t               count);
+
+    //! \struct prngPermutation
+    //! \brief Visits every value of a range exactly once, in a random order, without storing the range.
+    //!
+    //! The order comes from a Feistel network keyed by the seed, applied to the index of each value. Indexes that
+    //! land outside the range are passed through the network again until they land inside it, which takes fewer than
+    //! 4 passes on average. Any position in the order can be computed directly with prng_Permutation_At.
+    typedef struct sprngPermutation
+    {
+        uint64_t     rangeMin;  /*!< first value of the range */
+        uint64_t     step;      /*!< distance between values */
+        uint64_t     lastIndex; /*!< number of values in the range minus one */
+        uint64_t     position;  /*!< index of the next value returned by prng_Permutation_Fill */
+        bool         finished;  /*!< true once every value has been returned */
+        unsigned int halfBits;  /*!< bits in each half of the Feistel network */
+        uint64_t     keys[4];   /*!< round keys */
+    } prngPermutation;
+
+    //! \fn errno_t init_PRNG_Permutation(prngPermutation* permutation, uint64_t rangeMin, uint64_t rangeMax,
+    //!                                     uint64_t step, uint64_t seed)
+    //! \brief Sets up a random order of rangeMin, rangeMin + step, ... up to rangeMax.
+    //! \param[out] permutation permutation to initialize
+    //! \param[in] rangeMin first value of the range
+    //! \param[in] rangeMax last value of the range. Rounded down to rangeMin plus a multiple of \a step.
+    //! \param[in] step distance between values. Must not be 0.
+    //! \param[in] seed selects the order. The same seed always gives the same order.
+    //! \return 0 on success, EINVAL if \a permutation is NULL, \a step is 0 or \a rangeMax is less than \a rangeMin
+    M_PARAM_WO(1)
+    errno_t init_PRNG_Permutation(prngPermutation* M_NONNULL permutation,
+                                  uint64_t                   rangeMin,
+                                  uint64_t                   rangeMax,
+                                  uint64_t                   step,
+                                  uint64_t                   seed);
+
+    //! \fn uint64_t prng_Permutation_At(const prngPermutation* permutation, uint64_t index)
+    //! \brief Gets the value at a position of the random order.
+    //! \param[in] permutation permutation to read
+    //! \param[in] index position in the order, from 0 to permutation->lastIndex
+    //! \return value at \a index. Returns permutation->rangeMin if \a index is past the end.
+    M_PARAM_RO(1)
+    M_NODISCARD uint64_t prng_Permutation_At(const prngPermutation* M_NONNULL permutation, uint64_t index);
+
+    //! \fn size_t prng_Permutation_Fill(prngPermutation* permutation, uint64_t* values, size_t count)
+    //! \brief Writes the next values of the random order to an array.
+    //! \param[in,out] permutation permutation to advance
+    //! \param[out] values array to fill
+    //! \param[in] count size of \a values
+    //! \return number of values written. Less than \a count once every value of the range has been returned.
+    M_PARAM_RW(1)
+    M_PARAM_WO_SIZE(2, 3)
+    size_t prng_Permutation_Fill(prngPermutation* M_NONNULL permutation, uint64_t* M_NONNULL values, size_t count);
+
 #if defined(__cplusplus)
 }
 #endif
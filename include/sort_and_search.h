@@ -603,6 +603,1420 @@ extern "C"
                                 ", " #context ")")
 #endif
 
+    //! \fn int compare_uint16(const void* a, const void* b)
+    //!
+    //! \brief Compares two uint16_t values for sorting and searching.
+    //!
+    //! \param[in] a Pointer to the first uint16_t value.
+    //! \param[in] b Pointer to the second uint16_t value.
+    //! \return -1, 0, or 1 if \a a is less than, equal to, or greater than \a b.
+    //!
+    //! \note Passing this function with a width of sizeof(uint16_t) to safe_lfind or safe_lsearch lets those functions
+    //! recognize a plain equality search and use safe_lfind_uint16 instead of calling the comparison per element.
+    M_NODISCARD int compare_uint16(const void* M_NONNULL a, const void* M_NONNULL b);
+
+    //! \fn int compare_uint32(const void* a, const void* b)
+    //!
+    //! \brief Compares two uint32_t values for sorting and searching.
+    //!
+    //! \param[in] a Pointer to the first uint32_t value.
+    //! \param[in] b Pointer to the second uint32_t value.
+    //! \return -1, 0, or 1 if \a a is less than, equal to, or greater than \a b.
+    //!
+    //! \note Passing this function with a width of sizeof(uint32_t) to safe_lfind or safe_lsearch lets those functions
+    //! recognize a plain equality search and use safe_lfind_uint32 instead of calling the comparison per element.
+    M_NODISCARD int compare_uint32(const void* M_NONNULL a, const void* M_NONNULL b);
+
+    //! \fn int compare_uint64(const void* a, const void* b)
+    //!
+    //! \brief Compares two uint64_t values for sorting and searching.
+    //!
+    //! \param[in] a Pointer to the first uint64_t value.
+    //! \param[in] b Pointer to the second uint64_t value.
+    //! \return -1, 0, or 1 if \a a is less than, equal to, or greater than \a b.
+    //!
+    //! \note Passing this function with a width of sizeof(uint64_t) to safe_lfind or safe_lsearch lets those functions
+    //! recognize a plain equality search and use safe_lfind_uint64 instead of calling the comparison per element.
+    M_NODISCARD int compare_uint64(const void* M_NONNULL a, const void* M_NONNULL b);
+
+#if defined(DEV_ENVIRONMENT)
+    //! \fn errno_t safe_lfind_uint16(uint16_t key, const uint16_t* base, rsize_t count, rsize_t* index)
+    //!
+    //! \brief Searches an array of uint16_t linearly for the first element equal to \a key with bounds checking.
+    //!
+    //! This function compares \a key against several elements at once using SIMD instructions when they are available,
+    //! which is much faster than calling a comparison function for each element for small lookup tables such as lists
+    //! of supported opcodes or log pages.
+    //!
+    //! \param[in] key Value to search for.
+    //! \param[in] base Pointer to the array to be searched.
+    //! \param[in] count Number of elements in the array.
+    //! \param[out] index Receives the index of the first matching element, or \a count if no element matches.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a index is a null pointer
+    //!
+    //! - \a count > RSIZE_T_C(0) && \a base == M_NULLPTR
+    //!
+    //! - \a count > RSIZE_MAX
+    M_INLINE errno_t safe_lfind_uint16(uint16_t key, const uint16_t* base, rsize_t count, rsize_t* index)
+    {
+        return safe_lfind_uint16_impl(key, base, count, index, __FILE__, __func__, __LINE__,
+                                      "safe_lfind_uint16(key, base, count, index)");
+    }
+#else
+//! \def safe_lfind_uint16
+//!
+//! \brief Searches an array of uint16_t linearly for the first element equal to \a key with bounds checking.
+//!
+//! This function compares \a key against several elements at once using SIMD instructions when they are available,
+//! which is much faster than calling a comparison function for each element for small lookup tables such as lists of
+//! supported opcodes or log pages.
+//!
+//! \param[in] key Value to search for.
+//! \param[in] base Pointer to the array to be searched.
+//! \param[in] count Number of elements in the array.
+//! \param[out] index Receives the index of the first matching element, or \a count if no element matches.
+//! \return Zero on success, or an error code on failure.
+//!
+//! \note The following errors are detected at runtime and call the installed constraint handler:
+//!
+//! - \a index is a null pointer
+//!
+//! - \a count > RSIZE_T_C(0) && \a base == M_NULLPTR
+//!
+//! - \a count > RSIZE_MAX
+#    define safe_lfind_uint16(key, base, count, index)                                                                 \
+        safe_lfind_uint16_impl(key, base, count, index, __FILE__, __func__, __LINE__,                                  \
+                               "safe_lfind_uint16(" #key ", " #base ", " #count ", " #index ")")
+#endif
+
+#if defined(DEV_ENVIRONMENT)
+    //! \fn errno_t safe_lfind_uint32(uint32_t key, const uint32_t* base, rsize_t count, rsize_t* index)
+    //!
+    //! \brief Searches an array of uint32_t linearly for the first element equal to \a key with bounds checking.
+    //!
+    //! This function compares \a key against several elements at once using SIMD instructions when they are available,
+    //! which is much faster than calling a comparison function for each element for small lookup tables such as lists
+    //! of supported opcodes or log pages.
+    //!
+    //! \param[in] key Value to search for.
+    //! \param[in] base Pointer to the array to be searched.
+    //! \param[in] count Number of elements in the array.
+    //! \param[out] index Receives the index of the first matching element, or \a count if no element matches.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a index is a null pointer
+    //!
+    //! - \a count > RSIZE_T_C(0) && \a base == M_NULLPTR
+    //!
+    //! - \a count > RSIZE_MAX
+    M_INLINE errno_t safe_lfind_uint32(uint32_t key, const uint32_t* base, rsize_t count, rsize_t* index)
+    {
+        return safe_lfind_uint32_impl(key, base, count, index, __FILE__, __func__, __LINE__,
+                                      "safe_lfind_uint32(key, base, count, index)");
+    }
+#else
+//! \def safe_lfind_uint32
+//!
+//! \brief Searches an array of uint32_t linearly for the first element equal to \a key with bounds checking.
+//!
+//! This function compares \a key against several elements at once using SIMD instructions when they are available,
+//! which is much faster than calling a comparison function for each element for small lookup tables such as lists of
+//! supported opcodes or log pages.
+//!
+//! \param[in] key Value to search for.
+//! \param[in] base Pointer to the array to be searched.
+//! \param[in] count Number of elements in the array.
+//! \param[out] index Receives the index of the first matching element, or \a count if no element matches.
+//! \return Zero on success, or an error code on failure.
+//!
+//! \note The following errors are detected at runtime and call the installed constraint handler:
+//!
+//! - \a index is a null pointer
+//!
+//! - \a count > RSIZE_T_C(0) && \a base == M_NULLPTR
+//!
+//! - \a count > RSIZE_MAX
+#    define safe_lfind_uint32(key, base, count, index)                                                                 \
+        safe_lfind_uint32_impl(key, base, count, index, __FILE__, __func__, __LINE__,                                  \
+                               "safe_lfind_uint32(" #key ", " #base ", " #count ", " #index ")")
+#endif
+
+#if defined(DEV_ENVIRONMENT)
+    //! \fn errno_t safe_lfind_uint64(uint64_t key, const uint64_t* base, rsize_t count, rsize_t* index)
+    //!
+    //! \brief Searches an array of uint64_t linearly for the first element equal to \a key with bounds checking.
+    //!
+    //! This function compares \a key against several elements at once using SIMD instructions when they are available,
+    //! which is much faster than calling a comparison function for each element for small lookup tables such as lists
+    //! of supported opcodes or log pages.
+    //!
+    //! \param[in] key Value to search for.
+    //! \param[in] base Pointer to the array to be searched.
+    //! \param[in] count Number of elements in the array.
+    //! \param[out] index Receives the index of the first matching element, or \a count if no element matches.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a index is a null pointer
+    //!
+    //! - \a count > RSIZE_T_C(0) && \a base == M_NULLPTR
+    //!
+    //! - \a count > RSIZE_MAX
+    M_INLINE errno_t safe_lfind_uint64(uint64_t key, const uint64_t* base, rsize_t count, rsize_t* index)
+    {
+        return safe_lfind_uint64_impl(key, base, count, index, __FILE__, __func__, __LINE__,
+                                      "safe_lfind_uint64(key, base, count, index)");
+    }
+#else
+//! \def safe_lfind_uint64
+//!
+//! \brief Searches an array of uint64_t linearly for the first element equal to \a key with bounds checking.
+//!
+//! This function compares \a key against several elements at once using SIMD instructions when they are available,
+//! which is much faster than calling a comparison function for each element for small lookup tables such as lists of
+//! supported opcodes or log pages.
+//!
+//! \param[in] key Value to search for.
+//! \param[in] base Pointer to the array to be searched.
+//! \param[in] count Number of elements in the array.
+//! \param[out] index Receives the index of the first matching element, or \a count if no element matches.
+//! \return Zero on success, or an error code on failure.
+//!
+//! \note The following errors are detected at runtime and call the installed constraint handler:
+//!
+//! - \a index is a null pointer
+//!
+//! - \a count > RSIZE_T_C(0) && \a base == M_NULLPTR
+//!
+//! - \a count > RSIZE_MAX
+#    define safe_lfind_uint64(key, base, count, index)                                                                 \
+        safe_lfind_uint64_impl(key, base, count, index, __FILE__, __func__, __LINE__,                                  \
+                               "safe_lfind_uint64(" #key ", " #base ", " #count ", " #index ")")
+#endif
+
+#if defined(DEV_ENVIRONMENT)
+    //! \fn errno_t safe_lower_bound(const void* key, const void* ptr, rsize_t count, rsize_t size, comparefn compare,
+    //! rsize_t* index)
+    //!
+    //! \brief Finds the first element not less than a key in a sorted array with bounds checking.
+    //!
+    //! This function finds the index of the first element in a sorted array of \a count elements, each of \a size
+    //! bytes, that does not compare less than \a key, using the comparison function \a compare. If all elements are
+    //! less than \a key, \a index is set to \a count.
+    //!
+    //! \param[in] key Pointer to the key to search for.
+    //! \param[in] ptr Pointer to the sorted array to be searched.
+    //! \param[in] count Number of elements in the array.
+    //! \param[in] size Size of each element in the array.
+    //! \param[in] compare Comparison function to determine the order of the elements.
+    //! \param[out] index Receives the index of the found position.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a count or \a size is > RSIZE_MAX
+    //!
+    //! - \a key or \a ptr or \a compare is a null pointer (unless count is zero)
+    //!
+    //! - \a index is a null pointer
+    M_INLINE errno_t safe_lower_bound(const void* key,
+                                      const void* ptr,
+                                      rsize_t     count,
+                                      rsize_t     size,
+                                      comparefn   compare,
+                                      rsize_t*    index)
+    {
+        return safe_lower_bound_impl(key, ptr, count, size, compare, index, __FILE__, __func__, __LINE__,
+                                     "safe_lower_bound(key, ptr, count, size, compare, index)");
+    }
+#else
+//! \def safe_lower_bound
+//!
+//! \brief Finds the first element not less than a key in a sorted array with bounds checking.
+//!
+//! This function finds the index of the first element in a sorted array of \a count elements, each of \a size bytes,
+//! that does not compare less than \a key, using the comparison function \a compare. If all elements are less than \a
+//! key, \a index is set to \a count.
+//!
+//! \param[in] key Pointer to the key to search for.
+//! \param[in] ptr Pointer to the sorted array to be searched.
+//! \param[in] count Number of elements in the array.
+//! \param[in] size Size of each element in the array.
+//! \param[in] compare Comparison function to determine the order of the elements.
+//! \param[out] index Receives the index of the found position.
+//! \return Zero on success, or an error code on failure.
+//!
+//! \note The following errors are detected at runtime and call the installed constraint handler:
+//!
+//! - \a count or \a size is > RSIZE_MAX
+//!
+//! - \a key or \a ptr or \a compare is a null pointer (unless count is zero)
+//!
+//! - \a index is a null pointer
+#    define safe_lower_bound(key, ptr, count, size, compare, index)                                                    \
+        safe_lower_bound_impl(key, ptr, count, size, compare, index, __FILE__, __func__, __LINE__,                     \
+                              "safe_lower_bound(" #key ", " #ptr ", " #count ", " #size ", " #compare ", " #index ")")
+#endif
+
+#if defined(DEV_ENVIRONMENT)
+    //! \fn errno_t safe_lower_bound_context(const void* key, const void* ptr, rsize_t count, rsize_t size, ctxcomparefn
+    //! compare, void* context, rsize_t* index)
+    //!
+    //! \brief Finds the first element not less than a key in a sorted array with bounds checking and an optional
+    //! context parameter.
+    //!
+    //! This function finds the index of the first element in a sorted array of \a count elements, each of \a size
+    //! bytes, that does not compare less than \a key, using the comparison function \a compare and an optional context
+    //! parameter \a context. If all elements are less than \a key, \a index is set to \a count.
+    //!
+    //! \param[in] key Pointer to the key to search for.
+    //! \param[in] ptr Pointer to the sorted array to be searched.
+    //! \param[in] count Number of elements in the array.
+    //! \param[in] size Size of each element in the array.
+    //! \param[in] compare Comparison function to determine the order of the elements.
+    //! \param[in] context Optional context parameter for the comparison function.
+    //! \param[out] index Receives the index of the found position.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a count or \a size is > RSIZE_MAX
+    //!
+    //! - \a key or \a ptr or \a compare is a null pointer (unless count is zero)
+    //!
+    //! - \a index is a null pointer
+    M_INLINE errno_t safe_lower_bound_context(const void*  key,
+                                              const void*  ptr,
+                                              rsize_t      count,
+                                              rsize_t      size,
+                                              ctxcomparefn compare,
+                                              void*        context,
+                                              rsize_t*     index)
+    {
+        return safe_lower_bound_context_impl(key, ptr, count, size, compare, context, index, __FILE__, __func__,
+                                             __LINE__,
+                                             "safe_lower_bound_context(key, ptr, count, size, compare, context, "
+                                             "index)");
+    }
+#else
+//! \def safe_lower_bound_context
+//!
+//! \brief Finds the first element not less than a key in a sorted array with bounds checking and an optional context
+//! parameter.
+//!
+//! This function finds the index of the first element in a sorted array of \a count elements, each of \a size bytes,
+//! that does not compare less than \a key, using the comparison function \a compare and an optional context parameter
+//! \a context. If all elements are less than \a key, \a index is set to \a count.
+//!
+//! \param[in] key Pointer to the key to search for.
+//! \param[in] ptr Pointer to the sorted array to be searched.
+//! \param[in] count Number of elements in the array.
+//! \param[in] size Size of each element in the array.
+//! \param[in] compare Comparison function to determine the order of the elements.
+//! \param[in] context Optional context parameter for the comparison function.
+//! \param[out] index Receives the index of the found position.
+//! \return Zero on success, or an error code on failure.
+//!
+//! \note The following errors are detected at runtime and call the installed constraint handler:
+//!
+//! - \a count or \a size is > RSIZE_MAX
+//!
+//! - \a key or \a ptr or \a compare is a null pointer (unless count is zero)
+//!
+//! - \a index is a null pointer
+#    define safe_lower_bound_context(key, ptr, count, size, compare, context, index)                                   \
+        safe_lower_bound_context_impl(key, ptr, count, size, compare, context, index, __FILE__, __func__, __LINE__,    \
+                                      "safe_lower_bound_context(" #key ", " #ptr ", " #count ", " #size                \
+                                      ", " #compare ", " #context ", " #index ")")
+#endif
+
+#if defined(DEV_ENVIRONMENT)
+    //! \fn errno_t safe_upper_bound(const void* key, const void* ptr, rsize_t count, rsize_t size, comparefn compare,
+    //! rsize_t* index)
+    //!
+    //! \brief Finds the first element greater than a key in a sorted array with bounds checking.
+    //!
+    //! This function finds the index of the first element in a sorted array of \a count elements, each of \a size
+    //! bytes, that compares greater than \a key, using the comparison function \a compare. If no element is greater
+    //! than \a key, \a index is set to \a count.
+    //!
+    //! \param[in] key Pointer to the key to search for.
+    //! \param[in] ptr Pointer to the sorted array to be searched.
+    //! \param[in] count Number of elements in the array.
+    //! \param[in] size Size of each element in the array.
+    //! \param[in] compare Comparison function to determine the order of the elements.
+    //! \param[out] index Receives the index of the found position.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a count or \a size is > RSIZE_MAX
+    //!
+    //! - \a key or \a ptr or \a compare is a null pointer (unless count is zero)
+    //!
+    //! - \a index is a null pointer
+    M_INLINE errno_t safe_upper_bound(const void* key,
+                                      const void* ptr,
+                                      rsize_t     count,
+                                      rsize_t     size,
+                                      comparefn   compare,
+                                      rsize_t*    index)
+    {
+        return safe_upper_bound_impl(key, ptr, count, size, compare, index, __FILE__, __func__, __LINE__,
+                                     "safe_upper_bound(key, ptr, count, size, compare, index)");
+    }
+#else
+//! \def safe_upper_bound
+//!
+//! \brief Finds the first element greater than a key in a sorted array with bounds checking.
+//!
+//! This function finds the index of the first element in a sorted array of \a count elements, each of \a size bytes,
+//! that compares greater than \a key, using the comparison function \a compare. If no element is greater than \a key,
+//! \a index is set to \a count.
+//!
+//! \param[in] key Pointer to the key to search for.
+//! \param[in] ptr Pointer to the sorted array to be searched.
+//! \param[in] count Number of elements in the array.
+//! \param[in] size Size of each element in the array.
+//! \param[in] compare Comparison function to determine the order of the elements.
+//! \param[out] index Receives the index of the found position.
+//! \return Zero on success, or an error code on failure.
+//!
+//! \note The following errors are detected at runtime and call the installed constraint handler:
+//!
+//! - \a count or \a size is > RSIZE_MAX
+//!
+//! - \a key or \a ptr or \a compare is a null pointer (unless count is zero)
+//!
+//! - \a index is a null pointer
+#    define safe_upper_bound(key, ptr, count, size, compare, index)                                                    \
+        safe_upper_bound_impl(key, ptr, count, size, compare, index, __FILE__, __func__, __LINE__,                     \
+                              "safe_upper_bound(" #key ", " #ptr ", " #count ", " #size ", " #compare ", " #index ")")
+#endif
+
+#if defined(DEV_ENVIRONMENT)
+    //! \fn errno_t safe_upper_bound_context(const void* key, const void* ptr, rsize_t count, rsize_t size, ctxcomparefn
+    //! compare, void* context, rsize_t* index)
+    //!
+    //! \brief Finds the first element greater than a key in a sorted array with bounds checking and an optional context
+    //! parameter.
+    //!
+    //! This function finds the index of the first element in a sorted array of \a count elements, each of \a size
+    //! bytes, that compares greater than \a key, using the comparison function \a compare and an optional context
+    //! parameter \a context. If no element is greater than \a key, \a index is set to \a count.
+    //!
+    //! \param[in] key Pointer to the key to search for.
+    //! \param[in] ptr Pointer to the sorted array to be searched.
+    //! \param[in] count Number of elements in the array.
+    //! \param[in] size Size of each element in the array.
+    //! \param[in] compare Comparison function to determine the order of the elements.
+    //! \param[in] context Optional context parameter for the comparison function.
+    //! \param[out] index Receives the index of the found position.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a count or \a size is > RSIZE_MAX
+    //!
+    //! - \a key or \a ptr or \a compare is a null pointer (unless count is zero)
+    //!
+    //! - \a index is a null pointer
+    M_INLINE errno_t safe_upper_bound_context(const void*  key,
+                                              const void*  ptr,
+                                              rsize_t      count,
+                                              rsize_t      size,
+                                              ctxcomparefn compare,
+                                              void*        context,
+                                              rsize_t*     index)
+    {
+        return safe_upper_bound_context_impl(key, ptr, count, size, compare, context, index, __FILE__, __func__,
+                                             __LINE__,
+                                             "safe_upper_bound_context(key, ptr, count, size, compare, context, "
+                                             "index)");
+    }
+#else
+//! \def safe_upper_bound_context
+//!
+//! \brief Finds the first element greater than a key in a sorted array with bounds checking and an optional context
+//! parameter.
+//!
+//! This function finds the index of the first element in a sorted array of \a count elements, each of \a size bytes,
+//! that compares greater than \a key, using the comparison function \a compare and an optional context parameter \a
+//! context. If no element is greater than \a key, \a index is set to \a count.
+//!
+//! \param[in] key Pointer to the key to search for.
+//! \param[in] ptr Pointer to the sorted array to be searched.
+//! \param[in] count Number of elements in the array.
+//! \param[in] size Size of each element in the array.
+//! \param[in] compare Comparison function to determine the order of the elements.
+//! \param[in] context Optional context parameter for the comparison function.
+//! \param[out] index Receives the index of the found position.
+//! \return Zero on success, or an error code on failure.
+//!
+//! \note The following errors are detected at runtime and call the installed constraint handler:
+//!
+//! - \a count or \a size is > RSIZE_MAX
+//!
+//! - \a key or \a ptr or \a compare is a null pointer (unless count is zero)
+//!
+//! - \a index is a null pointer
+#    define safe_upper_bound_context(key, ptr, count, size, compare, context, index)                                   \
+        safe_upper_bound_context_impl(key, ptr, count, size, compare, context, index, __FILE__, __func__, __LINE__,    \
+                                      "safe_upper_bound_context(" #key ", " #ptr ", " #count ", " #size                \
+                                      ", " #compare ", " #context ", " #index ")")
+#endif
+
+#if defined(DEV_ENVIRONMENT)
+    //! \fn errno_t safe_equal_range(const void* key, const void* ptr, rsize_t count, rsize_t size, comparefn compare,
+    //! rsize_t* first, rsize_t* last)
+    //!
+    //! \brief Finds the range of elements equal to a key in a sorted array with bounds checking.
+    //!
+    //! This function finds the half-open range [\a first, \a last) of elements in a sorted array of \a count elements,
+    //! each of \a size bytes, that compare equal to \a key, using the comparison function \a compare. If no elements
+    //! match, \a first equals \a last and both are the position where \a key would be inserted.
+    //!
+    //! \param[in] key Pointer to the key to search for.
+    //! \param[in] ptr Pointer to the sorted array to be searched.
+    //! \param[in] count Number of elements in the array.
+    //! \param[in] size Size of each element in the array.
+    //! \param[in] compare Comparison function to determine the order of the elements.
+    //! \param[out] first Receives the index of the first element equal to \a key.
+    //! \param[out] last Receives the index one past the last element equal to \a key.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a count or \a size is > RSIZE_MAX
+    //!
+    //! - \a key or \a ptr or \a compare is a null pointer (unless count is zero)
+    //!
+    //! - \a first or \a last is a null pointer
+    M_INLINE errno_t safe_equal_range(const void* key,
+                                      const void* ptr,
+                                      rsize_t     count,
+                                      rsize_t     size,
+                                      comparefn   compare,
+                                      rsize_t*    first,
+                                      rsize_t*    last)
+    {
+        return safe_equal_range_impl(key, ptr, count, size, compare, first, last, __FILE__, __func__, __LINE__,
+                                     "safe_equal_range(key, ptr, count, size, compare, first, last)");
+    }
+#else
+//! \def safe_equal_range
+//!
+//! \brief Finds the range of elements equal to a key in a sorted array with bounds checking.
+//!
+//! This function finds the half-open range [\a first, \a last) of elements in a sorted array of \a count elements, each
+//! of \a size bytes, that compare equal to \a key, using the comparison function \a compare. If no elements match, \a
+//! first equals \a last and both are the position where \a key would be inserted.
+//!
+//! \param[in] key Pointer to the key to search for.
+//! \param[in] ptr Pointer to the sorted array to be searched.
+//! \param[in] count Number of elements in the array.
+//! \param[in] size Size of each element in the array.
+//! \param[in] compare Comparison function to determine the order of the elements.
+//! \param[out] first Receives the index of the first element equal to \a key.
+//! \param[out] last Receives the index one past the last element equal to \a key.
+//! \return Zero on success, or an error code on failure.
+//!
+//! \note The following errors are detected at runtime and call the installed constraint handler:
+//!
+//! - \a count or \a size is > RSIZE_MAX
+//!
+//! - \a key or \a ptr or \a compare is a null pointer (unless count is zero)
+//!
+//! - \a first or \a last is a null pointer
+#    define safe_equal_range(key, ptr, count, size, compare, first, last)                                              \
+        safe_equal_range_impl(key, ptr, count, size, compare, first, last, __FILE__, __func__, __LINE__,               \
+                              "safe_equal_range(" #key ", " #ptr ", " #count ", " #size ", " #compare                  \
+                              ", " #first ", " #last ")")
+#endif
+
+#if defined(DEV_ENVIRONMENT)
+    //! \fn errno_t safe_equal_range_context(const void* key, const void* ptr, rsize_t count, rsize_t size, ctxcomparefn
+    //! compare, void* context, rsize_t* first, rsize_t* last)
+    //!
+    //! \brief Finds the range of elements equal to a key in a sorted array with bounds checking and an optional context
+    //! parameter.
+    //!
+    //! This function finds the half-open range [\a first, \a last) of elements in a sorted array of \a count elements,
+    //! each of \a size bytes, that compare equal to \a key, using the comparison function \a compare and an optional
+    //! context parameter \a context. If no elements match, \a first equals \a last and both are the position where \a
+    //! key would be inserted.
+    //!
+    //! \param[in] key Pointer to the key to search for.
+    //! \param[in] ptr Pointer to the sorted array to be searched.
+    //! \param[in] count Number of elements in the array.
+    //! \param[in] size Size of each element in the array.
+    //! \param[in] compare Comparison function to determine the order of the elements.
+    //! \param[in] context Optional context parameter for the comparison function.
+    //! \param[out] first Receives the index of the first element equal to \a key.
+    //! \param[out] last Receives the index one past the last element equal to \a key.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a count or \a size is > RSIZE_MAX
+    //!
+    //! - \a key or \a ptr or \a compare is a null pointer (unless count is zero)
+    //!
+    //! - \a first or \a last is a null pointer
+    M_INLINE errno_t safe_equal_range_context(const void*  key,
+                                              const void*  ptr,
+                                              rsize_t      count,
+                                              rsize_t      size,
+                                              ctxcomparefn compare,
+                                              void*        context,
+                                              rsize_t*     first,
+                                              rsize_t*     last)
+    {
+        return safe_equal_range_context_impl(key, ptr, count, size, compare, context, first, last, __FILE__, __func__,
+                                             __LINE__,
+                                             "safe_equal_range_context(key, ptr, count, size, compare, context, "
+                                             "first, last)");
+    }
+#else
+//! \def safe_equal_range_context
+//!
+//! \brief Finds the range of elements equal to a key in a sorted array with bounds checking and an optional context
+//! parameter.
+//!
+//! This function finds the half-open range [\a first, \a last) of elements in a sorted array of \a count elements, each
+//! of \a size bytes, that compare equal to \a key, using the comparison function \a compare and an optional context
+//! parameter \a context. If no elements match, \a first equals \a last and both are the position where \a key would be
+//! inserted.
+//!
+//! \param[in] key Pointer to the key to search for.
+//! \param[in] ptr Pointer to the sorted array to be searched.
+//! \param[in] count Number of elements in the array.
+//! \param[in] size Size of each element in the array.
+//! \param[in] compare Comparison function to determine the order of the elements.
+//! \param[in] context Optional context parameter for the comparison function.
+//! \param[out] first Receives the index of the first element equal to \a key.
+//! \param[out] last Receives the index one past the last element equal to \a key.
+//! \return Zero on success, or an error code on failure.
+//!
+//! \note The following errors are detected at runtime and call the installed constraint handler:
+//!
+//! - \a count or \a size is > RSIZE_MAX
+//!
+//! - \a key or \a ptr or \a compare is a null pointer (unless count is zero)
+//!
+//! - \a first or \a last is a null pointer
+#    define safe_equal_range_context(key, ptr, count, size, compare, context, first, last)                             \
+        safe_equal_range_context_impl(key, ptr, count, size, compare, context, first, last, __FILE__, __func__,        \
+                                      __LINE__,                                                                        \
+                                      "safe_equal_range_context(" #key ", " #ptr ", " #count ", " #size                \
+                                      ", " #compare ", " #context ", " #first ", " #last ")")
+#endif
+
+#if defined(DEV_ENVIRONMENT)
+    //! \fn errno_t safe_eytzinger_layout(void* dest, const void* src, rsize_t count, rsize_t size)
+    //!
+    //! \brief Copies a sorted array into Eytzinger (breadth first search) order with bounds checking.
+    //!
+    //! Element \a i of the result is the root of an implicit binary search tree whose children are at 2*i+1 and 2*i+2.
+    //! Searching this layout with safe_eytzinger_lower_bound keeps each search within a few cache lines, which is a
+    //! large win for read-mostly tables that are searched millions of times.
+    //!
+    //! \param[out] dest Pointer to the array to receive \a count elements in Eytzinger order.
+    //! \param[in] src Pointer to the sorted array to copy from. Must not overlap \a dest.
+    //! \param[in] count Number of elements in the array.
+    //! \param[in] size Size of each element in the array.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a count or \a size is > RSIZE_MAX
+    //!
+    //! - \a dest or \a src is a null pointer (unless count is zero)
+    //!
+    //! - \a dest and \a src overlap
+    M_INLINE errno_t safe_eytzinger_layout(void* dest, const void* src, rsize_t count, rsize_t size)
+    {
+        return safe_eytzinger_layout_impl(dest, src, count, size, __FILE__, __func__, __LINE__,
+                                          "safe_eytzinger_layout(dest, src, count, size)");
+    }
+#else
+//! \def safe_eytzinger_layout
+//!
+//! \brief Copies a sorted array into Eytzinger (breadth first search) order with bounds checking.
+//!
+//! Element \a i of the result is the root of an implicit binary search tree whose children are at 2*i+1 and 2*i+2.
+//! Searching this layout with safe_eytzinger_lower_bound keeps each search within a few cache lines, which is a large
+//! win for read-mostly tables that are searched millions of times.
+//!
+//! \param[out] dest Pointer to the array to receive \a count elements in Eytzinger order.
+//! \param[in] src Pointer to the sorted array to copy from. Must not overlap \a dest.
+//! \param[in] count Number of elements in the array.
+//! \param[in] size Size of each element in the array.
+//! \return Zero on success, or an error code on failure.
+//!
+//! \note The following errors are detected at runtime and call the installed constraint handler:
+//!
+//! - \a count or \a size is > RSIZE_MAX
+//!
+//! - \a dest or \a src is a null pointer (unless count is zero)
+//!
+//! - \a dest and \a src overlap
+#    define safe_eytzinger_layout(dest, src, count, size)                                                              \
+        safe_eytzinger_layout_impl(dest, src, count, size, __FILE__, __func__, __LINE__,                               \
+                                   "safe_eytzinger_layout(" #dest ", " #src ", " #count ", " #size ")")
+#endif
+
+#if defined(DEV_ENVIRONMENT)
+    //! \fn errno_t safe_eytzinger_lower_bound(const void* key, const void* ptr, rsize_t count, rsize_t size, comparefn
+    //! compare, rsize_t* index)
+    //!
+    //! \brief Finds the first element not less than a key in an Eytzinger ordered array with bounds checking.
+    //!
+    //! This function searches an array that was rearranged with safe_eytzinger_layout for the first element (in sorted
+    //! order) that does not compare less than \a key, using the comparison function \a compare. This is faster than
+    //! safe_lower_bound on large read-mostly tables since each search touches far fewer cache lines.
+    //!
+    //! \param[in] key Pointer to the key to search for.
+    //! \param[in] ptr Pointer to the Eytzinger ordered array to be searched.
+    //! \param[in] count Number of elements in the array.
+    //! \param[in] size Size of each element in the array.
+    //! \param[in] compare Comparison function to determine the order of the elements.
+    //! \param[out] index Receives the index into \a ptr of the found element, or \a count if every element is less than
+    //! \a key.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a count or \a size is > RSIZE_MAX
+    //!
+    //! - \a key or \a ptr or \a compare is a null pointer (unless count is zero)
+    //!
+    //! - \a index is a null pointer
+    M_INLINE errno_t safe_eytzinger_lower_bound(const void* key,
+                                                const void* ptr,
+                                                rsize_t     count,
+                                                rsize_t     size,
+                                                comparefn   compare,
+                                                rsize_t*    index)
+    {
+        return safe_eytzinger_lower_bound_impl(key, ptr, count, size, compare, index, __FILE__, __func__, __LINE__,
+                                               "safe_eytzinger_lower_bound(key, ptr, count, size, compare, index)");
+    }
+#else
+//! \def safe_eytzinger_lower_bound
+//!
+//! \brief Finds the first element not less than a key in an Eytzinger ordered array with bounds checking.
+//!
+//! This function searches an array that was rearranged with safe_eytzinger_layout for the first element (in sorted
+//! order) that does not compare less than \a key, using the comparison function \a compare. This is faster than
+//! safe_lower_bound on large read-mostly tables since each search touches far fewer cache lines.
+//!
+//! \param[in] key Pointer to the key to search for.
+//! \param[in] ptr Pointer to the Eytzinger ordered array to be searched.
+//! \param[in] count Number of elements in the array.
+//! \param[in] size Size of each element in the array.
+//! \param[in] compare Comparison function to determine the order of the elements.
+//! \param[out] index Receives the index into \a ptr of the found element, or \a count if every element is less than \a
+//! key.
+//! \return Zero on success, or an error code on failure.
+//!
+//! \note The following errors are detected at runtime and call the installed constraint handler:
+//!
+//! - \a count or \a size is > RSIZE_MAX
+//!
+//! - \a key or \a ptr or \a compare is a null pointer (unless count is zero)
+//!
+//! - \a index is a null pointer
+#    define safe_eytzinger_lower_bound(key, ptr, count, size, compare, index)                                          \
+        safe_eytzinger_lower_bound_impl(key, ptr, count, size, compare, index, __FILE__, __func__, __LINE__,           \
+                                        "safe_eytzinger_lower_bound(" #key ", " #ptr ", " #count                       \
+                                        ", " #size ", " #compare ", " #index ")")
+#endif
+
+#if defined(DEV_ENVIRONMENT)
+    //! \fn errno_t safe_eytzinger_lower_bound_context(const void* key, const void* ptr, rsize_t count, rsize_t size,
+    //! ctxcomparefn compare, void* context, rsize_t* index)
+    //!
+    //! \brief Finds the first element not less than a key in an Eytzinger ordered array with bounds checking and an
+    //! optional context parameter.
+    //!
+    //! This function searches an array that was rearranged with safe_eytzinger_layout for the first element (in sorted
+    //! order) that does not compare less than \a key, using the comparison function \a compare and an optional context
+    //! parameter \a context. This is faster than safe_lower_bound on large read-mostly tables since each search touches
+    //! far fewer cache lines.
+    //!
+    //! \param[in] key Pointer to the key to search for.
+    //! \param[in] ptr Pointer to the Eytzinger ordered array to be searched.
+    //! \param[in] count Number of elements in the array.
+    //! \param[in] size Size of each element in the array.
+    //! \param[in] compare Comparison function to determine the order of the elements.
+    //! \param[in] context Optional context parameter for the comparison function.
+    //! \param[out] index Receives the index into \a ptr of the found element, or \a count if every element is less than
+    //! \a key.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a count or \a size is > RSIZE_MAX
+    //!
+    //! - \a key or \a ptr or \a compare is a null pointer (unless count is zero)
+    //!
+    //! - \a index is a null pointer
+    M_INLINE errno_t safe_eytzinger_lower_bound_context(const void*  key,
+                                                        const void*  ptr,
+                                                        rsize_t      count,
+                                                        rsize_t      size,
+                                                        ctxcomparefn compare,
+                                                        void*        context,
+                                                        rsize_t*     index)
+    {
+        return safe_eytzinger_lower_bound_context_impl(key, ptr, count, size, compare, context, index, __FILE__,
+                                                       __func__, __LINE__,
+                                                       "safe_eytzinger_lower_bound_context(key, ptr, count, size, "
+                                                       "compare, context, index)");
+    }
+#else
+//! \def safe_eytzinger_lower_bound_context
+//!
+//! \brief Finds the first element not less than a key in an Eytzinger ordered array with bounds checking and an
+//! optional context parameter.
+//!
+//! This function searches an array that was rearranged with safe_eytzinger_layout for the first element (in sorted
+//! order) that does not compare less than \a key, using the comparison function \a compare and an optional context
+//! parameter \a context. This is faster than safe_lower_bound on large read-mostly tables since each search touches far
+//! fewer cache lines.
+//!
+//! \param[in] key Pointer to the key to search for.
+//! \param[in] ptr Pointer to the Eytzinger ordered array to be searched.
+//! \param[in] count Number of elements in the array.
+//! \param[in] size Size of each element in the array.
+//! \param[in] compare Comparison function to determine the order of the elements.
+//! \param[in] context Optional context parameter for the comparison function.
+//! \param[out] index Receives the index into \a ptr of the found element, or \a count if every element is less than \a
+//! key.
+//! \return Zero on success, or an error code on failure.
+//!
+//! \note The following errors are detected at runtime and call the installed constraint handler:
+//!
+//! - \a count or \a size is > RSIZE_MAX
+//!
+//! - \a key or \a ptr or \a compare is a null pointer (unless count is zero)
+//!
+//! - \a index is a null pointer
+#    define safe_eytzinger_lower_bound_context(key, ptr, count, size, compare, context, index)                         \
+        safe_eytzinger_lower_bound_context_impl(key, ptr, count, size, compare, context, index, __FILE__, __func__,    \
+                                                __LINE__,                                                              \
+                                                "safe_eytzinger_lower_bound_context(" #key ", " #ptr                   \
+                                                ", " #count ", " #size ", " #compare ", " #context ", " #index ")")
+#endif
+
+#if defined(DEV_ENVIRONMENT)
+    //! \fn errno_t safe_lower_bound_batch(const void* keys, rsize_t keycount, rsize_t keysize, const void* ptr, rsize_t
+    //! count, rsize_t size, comparefn compare, bool keysSorted, rsize_t* results)
+    //!
+    //! \brief Finds the lower bound of many keys in one sorted array with bounds checking.
+    //!
+    //! This function performs the same search as safe_lower_bound for each of \a keycount keys in \a keys against a
+    //! sorted array of \a count elements, each of \a size bytes, and stores one index per key in \a results. Each
+    //! result is the index of the first element that does not compare less than that key, or \a count if all elements
+    //! are less than the key. A key was found when its result is less than \a count and that element compares equal to
+    //! the key.
+    //!
+    //! When \a keysSorted is true the keys must be sorted in the same order as the array. Each search then starts where
+    //! the previous key ended and gallops forward, so the total cost approaches O(keycount + count) for dense key sets
+    //! instead of O(keycount log count). When \a keysSorted is false, groups of keys are searched in lockstep so that
+    //! the cache misses of several searches overlap.
+    //!
+    //! \param[in] keys Pointer to the array of keys to search for.
+    //! \param[in] keycount Number of keys in \a keys.
+    //! \param[in] keysize Size of each key in \a keys.
+    //! \param[in] ptr Pointer to the sorted array to be searched.
+    //! \param[in] count Number of elements in the array.
+    //! \param[in] size Size of each element in the array.
+    //! \param[in] compare Comparison function that compares a key (first argument) to an array element (second
+    //! argument).
+    //! \param[in] keysSorted Set to true if \a keys is sorted in the same order as \a ptr.
+    //! \param[out] results Pointer to an array of \a keycount indexes to receive the result for each key.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a keycount, \a keysize, \a count or \a size is > RSIZE_MAX
+    //!
+    //! - \a keys or \a results is a null pointer (unless keycount is zero)
+    //!
+    //! - \a ptr or \a compare is a null pointer (unless count is zero)
+    M_INLINE errno_t safe_lower_bound_batch(const void* keys,
+                                            rsize_t     keycount,
+                                            rsize_t     keysize,
+                                            const void* ptr,
+                                            rsize_t     count,
+                                            rsize_t     size,
+                                            comparefn   compare,
+                                            bool        keysSorted,
+                                            rsize_t*    results)
+    {
+        return safe_lower_bound_batch_impl(keys, keycount, keysize, ptr, count, size, compare, keysSorted, results,
+                                           __FILE__, __func__, __LINE__,
+                                           "safe_lower_bound_batch(keys, keycount, keysize, ptr, count, size, "
+                                           "compare, keysSorted, results)");
+    }
+#else
+//! \def safe_lower_bound_batch
+//!
+//! \brief Finds the lower bound of many keys in one sorted array with bounds checking.
+//!
+//! This function performs the same search as safe_lower_bound for each of \a keycount keys in \a keys against a sorted
+//! array of \a count elements, each of \a size bytes, and stores one index per key in \a results. Each result is the
+//! index of the first element that does not compare less than that key, or \a count if all elements are less than the
+//! key. A key was found when its result is less than \a count and that element compares equal to the key.
+//!
+//! When \a keysSorted is true the keys must be sorted in the same order as the array. Each search then starts where the
+//! previous key ended and gallops forward, so the total cost approaches O(keycount + count) for dense key sets instead
+//! of O(keycount log count). When \a keysSorted is false, groups of keys are searched in lockstep so that the cache
+//! misses of several searches overlap.
+//!
+//! \param[in] keys Pointer to the array of keys to search for.
+//! \param[in] keycount Number of keys in \a keys.
+//! \param[in] keysize Size of each key in \a keys.
+//! \param[in] ptr Pointer to the sorted array to be searched.
+//! \param[in] count Number of elements in the array.
+//! \param[in] size Size of each element in the array.
+//! \param[in] compare Comparison function that compares a key (first argument) to an array element (second argument).
+//! \param[in] keysSorted Set to true if \a keys is sorted in the same order as \a ptr.
+//! \param[out] results Pointer to an array of \a keycount indexes to receive the result for each key.
+//! \return Zero on success, or an error code on failure.
+//!
+//! \note The following errors are detected at runtime and call the installed constraint handler:
+//!
+//! - \a keycount, \a keysize, \a count or \a size is > RSIZE_MAX
+//!
+//! - \a keys or \a results is a null pointer (unless keycount is zero)
+//!
+//! - \a ptr or \a compare is a null pointer (unless count is zero)
+#    define safe_lower_bound_batch(keys, keycount, keysize, ptr, count, size, compare, keysSorted, results)            \
+        safe_lower_bound_batch_impl(keys, keycount, keysize, ptr, count, size, compare, keysSorted, results, __FILE__, \
+                                    __func__, __LINE__,                                                                \
+                                    "safe_lower_bound_batch(" #keys ", " #keycount ", " #keysize ", " #ptr             \
+                                    ", " #count ", " #size ", " #compare ", " #keysSorted ", " #results ")")
+#endif
+
+#if defined(DEV_ENVIRONMENT)
+    //! \fn errno_t safe_lower_bound_batch_context(const void* keys, rsize_t keycount, rsize_t keysize, const void* ptr,
+    //! rsize_t count, rsize_t size, ctxcomparefn compare, void* context, bool keysSorted, rsize_t* results)
+    //!
+    //! \brief Finds the lower bound of many keys in one sorted array with bounds checking and an optional context
+    //! parameter.
+    //!
+    //! This function performs the same search as safe_lower_bound_context for each of \a keycount keys in \a keys
+    //! against a sorted array of \a count elements, each of \a size bytes, and stores one index per key in \a results.
+    //! Each result is the index of the first element that does not compare less than that key, or \a count if all
+    //! elements are less than the key. A key was found when its result is less than \a count and that element compares
+    //! equal to the key.
+    //!
+    //! When \a keysSorted is true the keys must be sorted in the same order as the array. Each search then starts where
+    //! the previous key ended and gallops forward, so the total cost approaches O(keycount + count) for dense key sets
+    //! instead of O(keycount log count). When \a keysSorted is false, groups of keys are searched in lockstep so that
+    //! the cache misses of several searches overlap.
+    //!
+    //! \param[in] keys Pointer to the array of keys to search for.
+    //! \param[in] keycount Number of keys in \a keys.
+    //! \param[in] keysize Size of each key in \a keys.
+    //! \param[in] ptr Pointer to the sorted array to be searched.
+    //! \param[in] count Number of elements in the array.
+    //! \param[in] size Size of each element in the array.
+    //! \param[in] compare Comparison function that compares a key (first argument) to an array element (second
+    //! argument).
+    //! \param[in] context Optional context parameter for the comparison function.
+    //! \param[in] keysSorted Set to true if \a keys is sorted in the same order as \a ptr.
+    //! \param[out] results Pointer to an array of \a keycount indexes to receive the result for each key.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a keycount, \a keysize, \a count or \a size is > RSIZE_MAX
+    //!
+    //! - \a keys or \a results is a null pointer (unless keycount is zero)
+    //!
+    //! - \a ptr or \a compare is a null pointer (unless count is zero)
+    M_INLINE errno_t safe_lower_bound_batch_context(const void*  keys,
+                                                    rsize_t      keycount,
+                                                    rsize_t      keysize,
+                                                    const void*  ptr,
+                                                    rsize_t      count,
+                                                    rsize_t      size,
+                                                    ctxcomparefn compare,
+                                                    void*        context,
+                                                    bool         keysSorted,
+                                                    rsize_t*     results)
+    {
+        return safe_lower_bound_batch_context_impl(keys, keycount, keysize, ptr, count, size, compare, context,
+                                                   keysSorted, results, __FILE__, __func__, __LINE__,
+                                                   "safe_lower_bound_batch_context(keys, keycount, keysize, ptr, "
+                                                   "count, size, compare, context, keysSorted, results)");
+    }
+#else
+//! \def safe_lower_bound_batch_context
+//!
+//! \brief Finds the lower bound of many keys in one sorted array with bounds checking and an optional context
+//! parameter.
+//!
+//! This function performs the same search as safe_lower_bound_context for each of \a keycount keys in \a keys against a
+//! sorted array of \a count elements, each of \a size bytes, and stores one index per key in \a results. Each result is
+//! the index of the first element that does not compare less than that key, or \a count if all elements are less than
+//! the key. A key was found when its result is less than \a count and that element compares equal to the key.
+//!
+//! When \a keysSorted is true the keys must be sorted in the same order as the array. Each search then starts where the
+//! previous key ended and gallops forward, so the total cost approaches O(keycount + count) for dense key sets instead
+//! of O(keycount log count). When \a keysSorted is false, groups of keys are searched in lockstep so that the cache
+//! misses of several searches overlap.
+//!
+//! \param[in] keys Pointer to the array of keys to search for.
+//! \param[in] keycount Number of keys in \a keys.
+//! \param[in] keysize Size of each key in \a keys.
+//! \param[in] ptr Pointer to the sorted array to be searched.
+//! \param[in] count Number of elements in the array.
+//! \param[in] size Size of each element in the array.
+//! \param[in] compare Comparison function that compares a key (first argument) to an array element (second argument).
+//! \param[in] context Optional context parameter for the comparison function.
+//! \param[in] keysSorted Set to true if \a keys is sorted in the same order as \a ptr.
+//! \param[out] results Pointer to an array of \a keycount indexes to receive the result for each key.
+//! \return Zero on success, or an error code on failure.
+//!
+//! \note The following errors are detected at runtime and call the installed constraint handler:
+//!
+//! - \a keycount, \a keysize, \a count or \a size is > RSIZE_MAX
+//!
+//! - \a keys or \a results is a null pointer (unless keycount is zero)
+//!
+//! - \a ptr or \a compare is a null pointer (unless count is zero)
+#    define safe_lower_bound_batch_context(keys, keycount, keysize, ptr, count, size, compare, context, keysSorted,    \
+                                           results)                                                                    \
+        safe_lower_bound_batch_context_impl(keys, keycount, keysize, ptr, count, size, compare, context, keysSorted,   \
+                                            results, __FILE__, __func__, __LINE__,                                     \
+                                            "safe_lower_bound_batch_context(" #keys ", " #keycount                     \
+                                            ", " #keysize ", " #ptr ", " #count ", " #size ", " #compare               \
+                                            ", " #context ", " #keysSorted ", " #results ")")
+#endif
+
+#if defined(DEV_ENVIRONMENT)
+    //! \fn errno_t safe_nth_element(void* ptr, rsize_t count, rsize_t size, rsize_t nth, comparefn compare)
+    //!
+    //! \brief Partially sorts an array so that one element is in its sorted position with bounds checking.
+    //!
+    //! After this function returns, the element at index \a nth is the element that would be there if the whole array
+    //! were sorted. Every element before it compares less than or equal to it and every element after it compares
+    //! greater than or equal to it. The order within each side is unspecified.
+    //!
+    //! This uses introselect: quickselect with median of three pivots that falls back to heapsort if partitioning stops
+    //! making progress, so it runs in O(count) on average and O(count log count) in the worst case.
+    //!
+    //! \param[in,out] ptr Pointer to the array.
+    //! \param[in] count Number of elements in the array.
+    //! \param[in] size Size of each element in the array.
+    //! \param[in] nth Index of the element to place in its sorted position.
+    //! \param[in] compare Comparison function to determine the order of the elements.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a count or \a size is > RSIZE_MAX
+    //!
+    //! - \a ptr or \a compare is a null pointer (unless count is zero)
+    //!
+    //! - \a nth >= \a count (unless count is zero)
+    M_INLINE errno_t safe_nth_element(void* ptr, rsize_t count, rsize_t size, rsize_t nth, comparefn compare)
+    {
+        return safe_nth_element_impl(ptr, count, size, nth, compare, __FILE__, __func__, __LINE__,
+                                     "safe_nth_element(ptr, count, size, nth, compare)");
+    }
+#else
+//! \def safe_nth_element
+//!
+//! \brief Partially sorts an array so that one element is in its sorted position with bounds checking.
+//!
+//! After this function returns, the element at index \a nth is the element that would be there if the whole array were
+//! sorted. Every element before it compares less than or equal to it and every element after it compares greater than
+//! or equal to it. The order within each side is unspecified.
+//!
+//! This uses introselect: quickselect with median of three pivots that falls back to heapsort if partitioning stops
+//! making progress, so it runs in O(count) on average and O(count log count) in the worst case.
+//!
+//! \param[in,out] ptr Pointer to the array.
+//! \param[in] count Number of elements in the array.
+//! \param[in] size Size of each element in the array.
+//! \param[in] nth Index of the element to place in its sorted position.
+//! \param[in] compare Comparison function to determine the order of the elements.
+//! \return Zero on success, or an error code on failure.
+//!
+//! \note The following errors are detected at runtime and call the installed constraint handler:
+//!
+//! - \a count or \a size is > RSIZE_MAX
+//!
+//! - \a ptr or \a compare is a null pointer (unless count is zero)
+//!
+//! - \a nth >= \a count (unless count is zero)
+#    define safe_nth_element(ptr, count, size, nth, compare)                                                           \
+        safe_nth_element_impl(ptr, count, size, nth, compare, __FILE__, __func__, __LINE__,                            \
+                              "safe_nth_element(" #ptr ", " #count ", " #size ", " #nth ", " #compare ")")
+#endif
+
+#if defined(DEV_ENVIRONMENT)
+    //! \fn errno_t safe_partial_sort(void* ptr, rsize_t count, rsize_t size, rsize_t middle, comparefn compare)
+    //!
+    //! \brief Sorts the smallest elements of an array into its beginning with bounds checking.
+    //!
+    //! After this function returns, the first \a middle elements of the array are the smallest \a middle elements in
+    //! sorted order. The order of the remaining elements is unspecified.
+    //!
+    //! This selects the boundary with introselect and then heapsorts only the first \a middle elements, so it runs in
+    //! O(count + middle log middle) instead of sorting the entire array.
+    //!
+    //! \param[in,out] ptr Pointer to the array.
+    //! \param[in] count Number of elements in the array.
+    //! \param[in] size Size of each element in the array.
+    //! \param[in] middle Number of elements to sort into the beginning of the array.
+    //! \param[in] compare Comparison function to determine the order of the elements.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a count or \a size is > RSIZE_MAX
+    //!
+    //! - \a ptr or \a compare is a null pointer (unless count is zero)
+    //!
+    //! - \a middle > \a count
+    M_INLINE errno_t safe_partial_sort(void* ptr, rsize_t count, rsize_t size, rsize_t middle, comparefn compare)
+    {
+        return safe_partial_sort_impl(ptr, count, size, middle, compare, __FILE__, __func__, __LINE__,
+                                      "safe_partial_sort(ptr, count, size, middle, compare)");
+    }
+#else
+//! \def safe_partial_sort
+//!
+//! \brief Sorts the smallest elements of an array into its beginning with bounds checking.
+//!
+//! After this function returns, the first \a middle elements of the array are the smallest \a middle elements in sorted
+//! order. The order of the remaining elements is unspecified.
+//!
+//! This selects the boundary with introselect and then heapsorts only the first \a middle elements, so it runs in
+//! O(count + middle log middle) instead of sorting the entire array.
+//!
+//! \param[in,out] ptr Pointer to the array.
+//! \param[in] count Number of elements in the array.
+//! \param[in] size Size of each element in the array.
+//! \param[in] middle Number of elements to sort into the beginning of the array.
+//! \param[in] compare Comparison function to determine the order of the elements.
+//! \return Zero on success, or an error code on failure.
+//!
+//! \note The following errors are detected at runtime and call the installed constraint handler:
+//!
+//! - \a count or \a size is > RSIZE_MAX
+//!
+//! - \a ptr or \a compare is a null pointer (unless count is zero)
+//!
+//! - \a middle > \a count
+#    define safe_partial_sort(ptr, count, size, middle, compare)                                                       \
+        safe_partial_sort_impl(ptr, count, size, middle, compare, __FILE__, __func__, __LINE__,                        \
+                               "safe_partial_sort(" #ptr ", " #count ", " #size ", " #middle ", " #compare ")")
+#endif
+
+#if defined(DEV_ENVIRONMENT)
+    //! \fn errno_t safe_top_k(void* dest, rsize_t k, const void* ptr, rsize_t count, rsize_t size, comparefn compare)
+    //!
+    //! \brief Copies the largest elements of an array into another array in descending order with bounds checking.
+    //!
+    //! The source array is not modified. \a dest is used as a min-heap of the \a k largest elements seen so far while
+    //! the source is read once from start to end, so this runs in O(count log k) and works well when \a k is much
+    //! smaller than \a count. To get the smallest elements instead, pass a comparison function that reverses the order.
+    //!
+    //! \param[out] dest Pointer to an array of at least \a k elements that receives the result, largest first.
+    //! \param[in] k Number of elements to select.
+    //! \param[in] ptr Pointer to the source array.
+    //! \param[in] count Number of elements in the source array.
+    //! \param[in] size Size of each element in the arrays.
+    //! \param[in] compare Comparison function to determine the order of the elements.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a k, \a count or \a size is > RSIZE_MAX
+    //!
+    //! - \a k * \a size is > RSIZE_MAX
+    //!
+    //! - \a dest, \a ptr or \a compare is a null pointer (unless k is zero)
+    //!
+    //! - \a k > \a count
+    //!
+    //! - \a dest overlaps \a ptr
+    M_INLINE errno_t safe_top_k(void* dest, rsize_t k, const void* ptr, rsize_t count, rsize_t size, comparefn compare)
+    {
+        return safe_top_k_impl(dest, k, ptr, count, size, compare, __FILE__, __func__, __LINE__,
+                               "safe_top_k(dest, k, ptr, count, size, compare)");
+    }
+#else
+//! \def safe_top_k
+//!
+//! \brief Copies the largest elements of an array into another array in descending order with bounds checking.
+//!
+//! The source array is not modified. \a dest is used as a min-heap of the \a k largest elements seen so far while the
+//! source is read once from start to end, so this runs in O(count log k) and works well when \a k is much smaller than
+//! \a count. To get the smallest elements instead, pass a comparison function that reverses the order.
+//!
+//! \param[out] dest Pointer to an array of at least \a k elements that receives the result, largest first.
+//! \param[in] k Number of elements to select.
+//! \param[in] ptr Pointer to the source array.
+//! \param[in] count Number of elements in the source array.
+//! \param[in] size Size of each element in the arrays.
+//! \param[in] compare Comparison function to determine the order of the elements.
+//! \return Zero on success, or an error code on failure.
+//!
+//! \note The following errors are detected at runtime and call the installed constraint handler:
+//!
+//! - \a k, \a count or \a size is > RSIZE_MAX
+//!
+//! - \a k * \a size is > RSIZE_MAX
+//!
+//! - \a dest, \a ptr or \a compare is a null pointer (unless k is zero)
+//!
+//! - \a k > \a count
+//!
+//! - \a dest overlaps \a ptr
+#    define safe_top_k(dest, k, ptr, count, size, compare)                                                             \
+        safe_top_k_impl(dest, k, ptr, count, size, compare, __FILE__, __func__, __LINE__,                              \
+                        "safe_top_k(" #dest ", " #k ", " #ptr ", " #count ", " #size ", " #compare ")")
+#endif
+
+#if defined(DEV_ENVIRONMENT)
+    //! \fn errno_t safe_nth_element_context(void* ptr, rsize_t count, rsize_t size, rsize_t nth, ctxcomparefn compare,
+    //! void* context)
+    //!
+    //! \brief Partially sorts an array so that one element is in its sorted position with bounds checking and an
+    //! optional context parameter.
+    //!
+    //! After this function returns, the element at index \a nth is the element that would be there if the whole array
+    //! were sorted. Every element before it compares less than or equal to it and every element after it compares
+    //! greater than or equal to it. The order within each side is unspecified.
+    //!
+    //! This uses introselect: quickselect with median of three pivots that falls back to heapsort if partitioning stops
+    //! making progress, so it runs in O(count) on average and O(count log count) in the worst case.
+    //!
+    //! \param[in,out] ptr Pointer to the array.
+    //! \param[in] count Number of elements in the array.
+    //! \param[in] size Size of each element in the array.
+    //! \param[in] nth Index of the element to place in its sorted position.
+    //! \param[in] compare Comparison function to determine the order of the elements.
+    //! \param[in] context Optional context parameter for the comparison function.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a count or \a size is > RSIZE_MAX
+    //!
+    //! - \a ptr or \a compare is a null pointer (unless count is zero)
+    //!
+    //! - \a nth >= \a count (unless count is zero)
+    M_INLINE errno_t safe_nth_element_context(void*        ptr,
+                                              rsize_t      count,
+                                              rsize_t      size,
+                                              rsize_t      nth,
+                                              ctxcomparefn compare,
+                                              void*        context)
+    {
+        return safe_nth_element_context_impl(ptr, count, size, nth, compare, context, __FILE__, __func__, __LINE__,
+                                             "safe_nth_element_context(ptr, count, size, nth, compare, context)");
+    }
+#else
+//! \def safe_nth_element_context
+//!
+//! \brief Partially sorts an array so that one element is in its sorted position with bounds checking and an optional
+//! context parameter.
+//!
+//! After this function returns, the element at index \a nth is the element that would be there if the whole array were
+//! sorted. Every element before it compares less than or equal to it and every element after it compares greater than
+//! or equal to it. The order within each side is unspecified.
+//!
+//! This uses introselect: quickselect with median of three pivots that falls back to heapsort if partitioning stops
+//! making progress, so it runs in O(count) on average and O(count log count) in the worst case.
+//!
+//! \param[in,out] ptr Pointer to the array.
+//! \param[in] count Number of elements in the array.
+//! \param[in] size Size of each element in the array.
+//! \param[in] nth Index of the element to place in its sorted position.
+//! \param[in] compare Comparison function to determine the order of the elements.
+//! \param[in] context Optional context parameter for the comparison function.
+//! \return Zero on success, or an error code on failure.
+//!
+//! \note The following errors are detected at runtime and call the installed constraint handler:
+//!
+//! - \a count or \a size is > RSIZE_MAX
+//!
+//! - \a ptr or \a compare is a null pointer (unless count is zero)
+//!
+//! - \a nth >= \a count (unless count is zero)
+#    define safe_nth_element_context(ptr, count, size, nth, compare, context)                                          \
+        safe_nth_element_context_impl(ptr, count, size, nth, compare, context, __FILE__, __func__, __LINE__,           \
+                                      "safe_nth_element_context(" #ptr ", " #count ", " #size ", " #nth                \
+                                      ", " #compare ", " #context ")")
+#endif
+
+#if defined(DEV_ENVIRONMENT)
+    //! \fn errno_t safe_partial_sort_context(void* ptr, rsize_t count, rsize_t size, rsize_t middle, ctxcomparefn
+    //! compare, void* context)
+    //!
+    //! \brief Sorts the smallest elements of an array into its beginning with bounds checking and an optional context
+    //! parameter.
+    //!
+    //! After this function returns, the first \a middle elements of the array are the smallest \a middle elements in
+    //! sorted order. The order of the remaining elements is unspecified.
+    //!
+    //! This selects the boundary with introselect and then heapsorts only the first \a middle elements, so it runs in
+    //! O(count + middle log middle) instead of sorting the entire array.
+    //!
+    //! \param[in,out] ptr Pointer to the array.
+    //! \param[in] count Number of elements in the array.
+    //! \param[in] size Size of each element in the array.
+    //! \param[in] middle Number of elements to sort into the beginning of the array.
+    //! \param[in] compare Comparison function to determine the order of the elements.
+    //! \param[in] context Optional context parameter for the comparison function.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a count or \a size is > RSIZE_MAX
+    //!
+    //! - \a ptr or \a compare is a null pointer (unless count is zero)
+    //!
+    //! - \a middle > \a count
+    M_INLINE errno_t safe_partial_sort_context(void*        ptr,
+                                               rsize_t      count,
+                                               rsize_t      size,
+                                               rsize_t      middle,
+                                               ctxcomparefn compare,
+                                               void*        context)
+    {
+        return safe_partial_sort_context_impl(ptr, count, size, middle, compare, context, __FILE__, __func__,
+                                              __LINE__,
+                                              "safe_partial_sort_context(ptr, count, size, middle, compare, context)");
+    }
+#else
+//! \def safe_partial_sort_context
+//!
+//! \brief Sorts the smallest elements of an array into its beginning with bounds checking and an optional context
+//! parameter.
+//!
+//! After this function returns, the first \a middle elements of the array are the smallest \a middle elements in sorted
+//! order. The order of the remaining elements is unspecified.
+//!
+//! This selects the boundary with introselect and then heapsorts only the first \a middle elements, so it runs in
+//! O(count + middle log middle) instead of sorting the entire array.
+//!
+//! \param[in,out] ptr Pointer to the array.
+//! \param[in] count Number of elements in the array.
+//! \param[in] size Size of each element in the array.
+//! \param[in] middle Number of elements to sort into the beginning of the array.
+//! \param[in] compare Comparison function to determine the order of the elements.
+//! \param[in] context Optional context parameter for the comparison function.
+//! \return Zero on success, or an error code on failure.
+//!
+//! \note The following errors are detected at runtime and call the installed constraint handler:
+//!
+//! - \a count or \a size is > RSIZE_MAX
+//!
+//! - \a ptr or \a compare is a null pointer (unless count is zero)
+//!
+//! - \a middle > \a count
+#    define safe_partial_sort_context(ptr, count, size, middle, compare, context)                                      \
+        safe_partial_sort_context_impl(ptr, count, size, middle, compare, context, __FILE__, __func__, __LINE__,       \
+                                       "safe_partial_sort_context(" #ptr ", " #count ", " #size                        \
+                                       ", " #middle ", " #compare ", " #context ")")
+#endif
+
+#if defined(DEV_ENVIRONMENT)
+    //! \fn errno_t safe_top_k_context(void* dest, rsize_t k, const void* ptr, rsize_t count, rsize_t size, ctxcomparefn
+    //! compare, void* context)
+    //!
+    //! \brief Copies the largest elements of an array into another array in descending order with bounds checking and
+    //! an optional context parameter.
+    //!
+    //! The source array is not modified. \a dest is used as a min-heap of the \a k largest elements seen so far while
+    //! the source is read once from start to end, so this runs in O(count log k) and works well when \a k is much
+    //! smaller than \a count. To get the smallest elements instead, pass a comparison function that reverses the order.
+    //!
+    //! \param[out] dest Pointer to an array of at least \a k elements that receives the result, largest first.
+    //! \param[in] k Number of elements to select.
+    //! \param[in] ptr Pointer to the source array.
+    //! \param[in] count Number of elements in the source array.
+    //! \param[in] size Size of each element in the arrays.
+    //! \param[in] compare Comparison function to determine the order of the elements.
+    //! \param[in] context Optional context parameter for the comparison function.
+    //! \return Zero on success, or an error code on failure.
+    //!
+    //! \note The following errors are detected at runtime and call the installed constraint handler:
+    //!
+    //! - \a k, \a count or \a size is > RSIZE_MAX
+    //!
+    //! - \a k * \a size is > RSIZE_MAX
+    //!
+    //! - \a dest, \a ptr or \a compare is a null pointer (unless k is zero)
+    //!
+    //! - \a k > \a count
+    //!
+    //! - \a dest overlaps \a ptr
+    M_INLINE errno_t safe_top_k_context(void*        dest,
+                                        rsize_t      k,
+                                        const void*  ptr,
+                                        rsize_t      count,
+                                        rsize_t      size,
+                                        ctxcomparefn compare,
+                                        void*        context)
+    {
+        return safe_top_k_context_impl(dest, k, ptr, count, size, compare, context, __FILE__, __func__, __LINE__,
+                                       "safe_top_k_context(dest, k, ptr, count, size, compare, context)");
+    }
+#else
+//! \def safe_top_k_context
+//!
+//! \brief Copies the largest elements of an array into another array in descending order with bounds checking and an
+//! optional context parameter.
+//!
+//! The source array is not modified. \a dest is used as a min-heap of the \a k largest elements seen so far while the
+//! source is read once from start to end, so this runs in O(count log k) and works well when \a k is much smaller than
+//! \a count. To get the smallest elements instead, pass a comparison function that reverses the order.
+//!
+//! \param[out] dest Pointer to an array of at least \a k elements that receives the result, largest first.
+//! \param[in] k Number of elements to select.
+//! \param[in] ptr Pointer to the source array.
+//! \param[in] count Number of elements in the source array.
+//! \param[in] size Size of each element in the arrays.
+//! \param[in] compare Comparison function to determine the order of the elements.
+//! \param[in] context Optional context parameter for the comparison function.
+//! \return Zero on success, or an error code on failure.
+//!
+//! \note The following errors are detected at runtime and call the installed constraint handler:
+//!
+//! - \a k, \a count or \a size is > RSIZE_MAX
+//!
+//! - \a k * \a size is > RSIZE_MAX
+//!
+//! - \a dest, \a ptr or \a compare is a null pointer (unless k is zero)
+//!
+//! - \a k > \a count
+//!
+//! - \a dest overlaps \a ptr
+#    define safe_top_k_context(dest, k, ptr, count, size, compare, context)                                            \
+        safe_top_k_context_impl(dest, k, ptr, count, size, compare, context, __FILE__, __func__, __LINE__,             \
+                                "safe_top_k_context(" #dest ", " #k ", " #ptr ", " #count ", " #size                   \
+                                ", " #compare ", " #context ")")
+#endif
+
 #if defined(__cplusplus)
 }
 #endif //__cplusplus
@@ -19,6 +19,7 @@
 #include "predef_env_detect.h"
 #include "type_conversion.h"
 
+#include <stdarg.h>
 #include <stdio.h>
 
 #if defined(__cplusplus)
@@ -283,6 +284,193 @@ extern "C"
         // clang-format on
         ;
 
+//! \def CHAR_CLASS_CNTRL
+//! \brief Character class bit for control characters. 0x00-0x1F and 0x7F.
+#define CHAR_CLASS_CNTRL UINT16_C(0x0001)
+//! \def CHAR_CLASS_SPACE
+//! \brief Character class bit for whitespace. Space, \\t, \\n, \\v, \\f, and \\r.
+#define CHAR_CLASS_SPACE UINT16_C(0x0002)
+//! \def CHAR_CLASS_BLANK
+//! \brief Character class bit for blank characters. Space and \\t.
+#define CHAR_CLASS_BLANK UINT16_C(0x0004)
+//! \def CHAR_CLASS_PRINT
+//! \brief Character class bit for printable characters including space. 0x20-0x7E.
+#define CHAR_CLASS_PRINT UINT16_C(0x0008)
+//! \def CHAR_CLASS_GRAPH
+//! \brief Character class bit for printable characters other than space. 0x21-0x7E.
+#define CHAR_CLASS_GRAPH UINT16_C(0x0010)
+//! \def CHAR_CLASS_PUNCT
+//! \brief Character class bit for punctuation. Graphical characters that are not letters or digits.
+#define CHAR_CLASS_PUNCT UINT16_C(0x0020)
+//! \def CHAR_CLASS_DIGIT
+//! \brief Character class bit for decimal digits 0-9.
+#define CHAR_CLASS_DIGIT UINT16_C(0x0040)
+//! \def CHAR_CLASS_XDIGIT
+//! \brief Character class bit for hexadecimal digits 0-9, A-F, and a-f.
+#define CHAR_CLASS_XDIGIT UINT16_C(0x0080)
+//! \def CHAR_CLASS_UPPER
+//! \brief Character class bit for uppercase letters A-Z.
+#define CHAR_CLASS_UPPER UINT16_C(0x0100)
+//! \def CHAR_CLASS_LOWER
+//! \brief Character class bit for lowercase letters a-z.
+#define CHAR_CLASS_LOWER UINT16_C(0x0200)
+//! \def CHAR_CLASS_ALPHA
+//! \brief Character class bit for letters A-Z and a-z.
+#define CHAR_CLASS_ALPHA UINT16_C(0x0400)
+//! \def CHAR_CLASS_ALNUM
+//! \brief Character class bit for letters and decimal digits.
+#define CHAR_CLASS_ALNUM UINT16_C(0x0800)
+
+    //! \var ascii_char_class_table
+    //! \brief Table of CHAR_CLASS_* bits for each byte value as classified by the "C" locale.
+    //! Bytes 0x80-0xFF are not in any class. Use the ascii_is* functions or char_class_is rather than reading this
+    //! directly.
+    extern const uint16_t ascii_char_class_table[256];
+
+    //! \fn bool char_class_is(char c, uint16_t classes)
+    //! \brief Checks if a character is in any of the given classes.
+    //!
+    //! Unlike the safe_is* functions this does not depend on the current locale, needs no range checks, does not
+    //! touch errno, and accepts a plain (possibly signed) char directly. It is a single table lookup.
+    //! \param[in] c character to check
+    //! \param[in] classes one or more CHAR_CLASS_* bits OR'd together
+    //! \return true if \a c is in at least one of \a classes
+    static M_INLINE bool char_class_is(char c, uint16_t classes)
+    {
+        return (ascii_char_class_table[M_STATIC_CAST(unsigned char, c)] & classes) != 0;
+    }
+
+    //! \fn bool ascii_isalnum(char c)
+    //! \brief Locale independent inline isalnum. \see char_class_is
+    static M_INLINE bool ascii_isalnum(char c)
+    {
+        return char_class_is(c, CHAR_CLASS_ALNUM);
+    }
+
+    //! \fn bool ascii_isalpha(char c)
+    //! \brief Locale independent inline isalpha. \see char_class_is
+    static M_INLINE bool ascii_isalpha(char c)
+    {
+        return char_class_is(c, CHAR_CLASS_ALPHA);
+    }
+
+    //! \fn bool ascii_islower(char c)
+    //! \brief Locale independent inline islower. \see char_class_is
+    static M_INLINE bool ascii_islower(char c)
+    {
+        return char_class_is(c, CHAR_CLASS_LOWER);
+    }
+
+    //! \fn bool ascii_isupper(char c)
+    //! \brief Locale independent inline isupper. \see char_class_is
+    static M_INLINE bool ascii_isupper(char c)
+    {
+        return char_class_is(c, CHAR_CLASS_UPPER);
+    }
+
+    //! \fn bool ascii_isdigit(char c)
+    //! \brief Locale independent inline isdigit. \see char_class_is
+    static M_INLINE bool ascii_isdigit(char c)
+    {
+        return char_class_is(c, CHAR_CLASS_DIGIT);
+    }
+
+    //! \fn bool ascii_isxdigit(char c)
+    //! \brief Locale independent inline isxdigit. \see char_class_is
+    static M_INLINE bool ascii_isxdigit(char c)
+    {
+        return char_class_is(c, CHAR_CLASS_XDIGIT);
+    }
+
+    //! \fn bool ascii_iscntrl(char c)
+    //! \brief Locale independent inline iscntrl. \see char_class_is
+    static M_INLINE bool ascii_iscntrl(char c)
+    {
+        return char_class_is(c, CHAR_CLASS_CNTRL);
+    }
+
+    //! \fn bool ascii_isgraph(char c)
+    //! \brief Locale independent inline isgraph. \see char_class_is
+    static M_INLINE bool ascii_isgraph(char c)
+    {
+        return char_class_is(c, CHAR_CLASS_GRAPH);
+    }
+
+    //! \fn bool ascii_isspace(char c)
+    //! \brief Locale independent inline isspace. \see char_class_is
+    static M_INLINE bool ascii_isspace(char c)
+    {
+        return char_class_is(c, CHAR_CLASS_SPACE);
+    }
+
+    //! \fn bool ascii_isblank(char c)
+    //! \brief Locale independent inline isblank. \see char_class_is
+    static M_INLINE bool ascii_isblank(char c)
+    {
+        return char_class_is(c, CHAR_CLASS_BLANK);
+    }
+
+    //! \fn bool ascii_isprint(char c)
+    //! \brief Locale independent inline isprint. \see char_class_is
+    static M_INLINE bool ascii_isprint(char c)
+    {
+        return char_class_is(c, CHAR_CLASS_PRINT);
+    }
+
+    //! \fn bool ascii_ispunct(char c)
+    //! \brief Locale independent inline ispunct. \see char_class_is
+    static M_INLINE bool ascii_ispunct(char c)
+    {
+        return char_class_is(c, CHAR_CLASS_PUNCT);
+    }
+
+    //! \fn size_t char_class_span(const char* data, size_t len, uint16_t classes)
+    //! \brief Gets the length of the leading run of characters that are in any of \a classes.
+    //!
+    //! Works like strspn with a character class instead of a character list. The returned value is also the offset
+    //! of the first character not in the classes, so "first non-digit" is char_class_span(data, len,
+    //! CHAR_CLASS_DIGIT). Null bytes are not treated as terminators. The span is checked 16 bytes at a time when SIMD
+    //! is available.
+    //! \param[in] data pointer to the characters to check
+    //! \param[in] len number of characters in \a data
+    //! \param[in] classes one or more CHAR_CLASS_* bits OR'd together
+    //! \return number of leading characters in \a classes. \a len if all of them are. Zero if \a data is NULL.
+    M_NODISCARD M_PARAM_RO_SIZE(1, 2) size_t
+        char_class_span(const char* M_NULLABLE data, size_t len, uint16_t classes);
+
+    //! \fn size_t char_class_cspan(const char* data, size_t len, uint16_t classes)
+    //! \brief Gets the length of the leading run of characters that are not in any of \a classes.
+    //!
+    //! Works like strcspn with a character class instead of a character list. The returned value is the offset of
+    //! the first character in the classes.
+    //! \param[in] data pointer to the characters to check
+    //! \param[in] len number of characters in \a data
+    //! \param[in] classes one or more CHAR_CLASS_* bits OR'd together
+    //! \return number of leading characters not in \a classes. \a len if none are. Zero if \a data is NULL.
+    M_NODISCARD M_PARAM_RO_SIZE(1, 2) size_t
+        char_class_cspan(const char* M_NULLABLE data, size_t len, uint16_t classes);
+
+    //! \fn size_t char_class_span_reverse(const char* data, size_t len, uint16_t classes)
+    //! \brief Gets the length of the trailing run of characters that are in any of \a classes.
+    //! \param[in] data pointer to the characters to check
+    //! \param[in] len number of characters in \a data
+    //! \param[in] classes one or more CHAR_CLASS_* bits OR'd together
+    //! \return number of trailing characters in \a classes. \a len if all of them are. Zero if \a data is NULL.
+    M_NODISCARD M_PARAM_RO_SIZE(1, 2) size_t
+        char_class_span_reverse(const char* M_NULLABLE data, size_t len, uint16_t classes);
+
+    //! \fn size_t char_class_count(const char* data, size_t len, uint16_t classes)
+    //! \brief Counts the characters that are in any of \a classes.
+    //!
+    //! To count the characters outside of a class subtract the result from \a len. For example the number of
+    //! non-printable characters is len - char_class_count(data, len, CHAR_CLASS_PRINT).
+    //! \param[in] data pointer to the characters to check
+    //! \param[in] len number of characters in \a data
+    //! \param[in] classes one or more CHAR_CLASS_* bits OR'd together
+    //! \return number of characters in \a classes. Zero if \a data is NULL.
+    M_NODISCARD M_PARAM_RO_SIZE(1, 2) size_t
+        char_class_count(const char* M_NULLABLE data, size_t len, uint16_t classes);
+
 #if defined(DEV_ENVIRONMENT)
     //! \fn size_t safe_strnlen(const char* string, size_t n)
     //! \brief Returns length of string or \a n if null terminator not found
@@ -1143,6 +1331,83 @@ M_NODISCARD M_PARAM_RO(1) M_NULL_TERM_STRING(1) M_FORCEINLINE size_t safe_strlen
 
 #define safe_String_Token(str, strmax, delim, saveptr) safe_strtok(str, strmax, delim, saveptr)
 
+    //! \brief A pointer and length describing part of a larger buffer.
+    //! \note The bytes described by a span are not null terminated.
+    typedef struct sstringSpan
+    {
+        const char* ptr; /*!< First byte of the span. */
+        size_t      len; /*!< Number of bytes in the span. */
+    } stringSpan;
+
+//! \def SPAN_TOKENIZER_VECTOR_DELIMITERS
+//! \brief Largest number of delimiters a spanTokenizer will compare 16 bytes at a time with SIMD instructions.
+//! Delimiter sets larger than this are matched one byte at a time through a lookup table.
+#define SPAN_TOKENIZER_VECTOR_DELIMITERS 8
+
+    //! \brief State for tokenizing a read only buffer with span_Tokenizer_Next.
+    //!
+    //! Initialize with span_Tokenizer_Init. Unlike safe_strtok the buffer is never modified, so this can be used on
+    //! memory mapped files, string literals, or any other const data.
+    typedef struct sspanTokenizer
+    {
+        const char* data;                                               /*!< Buffer being tokenized. */
+        size_t      length;                                             /*!< Length of the buffer in bytes. */
+        size_t      offset;                                             /*!< Where the next search begins. */
+        uint64_t    delimiterMap[4];                                    /*!< Bit set for each delimiter byte value. */
+        char        vectorDelimiters[SPAN_TOKENIZER_VECTOR_DELIMITERS]; /*!< Delimiters compared with SIMD. */
+        uint8_t     vectorDelimiterCount;                               /*!< Zero when the set is too large for SIMD. */
+        bool        collapseDelimiters;                                 /*!< Skip runs of delimiters. */
+        bool        finished;                                           /*!< Set once the last token is returned. */
+    } spanTokenizer;
+
+    //! \fn errno_t span_Tokenizer_Init(spanTokenizer* tokenizer, const char* data, size_t length, const char* delim,
+    //! bool collapseDelimiters)
+    //! \brief Prepares a tokenizer to split a read only buffer into {ptr,len} spans.
+    //!
+    //! The delimiter set is converted to a lookup table once here instead of on every token.
+    //! \param[out] tokenizer pointer to the tokenizer state to initialize
+    //! \param[in] data pointer to the buffer to tokenize. Does not need to be null terminated and null bytes in it
+    //! are treated as ordinary characters. Must remain valid while the tokenizer is in use.
+    //! \param[in] length number of bytes in \a data
+    //! \param[in] delim pointer to the null-terminated byte string identifying delimiters
+    //! \param[in] collapseDelimiters set to true to treat a run of delimiters as a single separator and skip
+    //! delimiters at the start and end of the buffer like safe_strtok does. Set to false to return an empty span
+    //! between adjacent delimiters, which is needed for fields that may be blank.
+    //! \return 0 on success, EINVAL if \a tokenizer or \a delim is NULL, or if \a data is NULL and \a length is not
+    //! zero
+    M_PARAM_WO(1)
+    M_PARAM_RO_SIZE(2, 3)
+    M_PARAM_RO(4)
+    M_NULL_TERM_STRING(4)
+    errno_t span_Tokenizer_Init(spanTokenizer* M_NONNULL tokenizer,
+                                const char* M_NULLABLE   data,
+                                size_t                   length,
+                                const char* M_NONNULL    delim,
+                                bool                     collapseDelimiters);
+
+    //! \fn bool span_Tokenizer_Next(spanTokenizer* tokenizer, stringSpan* token)
+    //! \brief Gets the next token from a tokenizer prepared with span_Tokenizer_Init.
+    //!
+    //! When delimiters are not collapsed, a buffer with N delimiters always produces N + 1 tokens, some of which may
+    //! be empty. "a,,b," split on "," gives "a", "", "b", and "".
+    //! \code
+    //! spanTokenizer tokenizer;
+    //! stringSpan    token;
+    //! if (0 == span_Tokenizer_Init(&tokenizer, buffer, bufferLen, "\n", false))
+    //! {
+    //!     while (span_Tokenizer_Next(&tokenizer, &token))
+    //!     {
+    //!         printf("%.*s\n", C_CAST(int, token.len), token.ptr);
+    //!     }
+    //! }
+    //! \endcode
+    //! \param[in,out] tokenizer pointer to the tokenizer state
+    //! \param[out] token receives the pointer and length of the next token
+    //! \return true if a token was returned, false when there are no more tokens
+    M_PARAM_RW(1)
+    M_PARAM_WO(2)
+    bool span_Tokenizer_Next(spanTokenizer* M_NONNULL tokenizer, stringSpan* M_NONNULL token);
+
     //! \def common_String_Token
     //! \brief backwards compatible wrapper around safe_String_Token
     //! \ref safe_String_Token
@@ -1289,6 +1554,8 @@ M_NODISCARD M_PARAM_RO(1) M_NULL_TERM_STRING(1) M_FORCEINLINE size_t safe_strlen
 
     //! \fn void remove_Trailing_Whitespace_Len(char* stringToChange, size_t stringlen)
     //! \brief remove the whitespace at the end of a string of a specified length
+    //!
+    //! Removes ASCII whitespace, control characters, and bytes above 0x7F from the end of the string.
     //! \param[out] stringToChange a pointer to the data containing a string
     //!   that needs to have the ending whitespace removed
     //! \param[in] stringlen total length of the string pointed to by \a stringToChange
@@ -1325,6 +1592,9 @@ M_NODISCARD M_PARAM_RO(1) M_NULL_TERM_STRING(1) M_FORCEINLINE size_t safe_strlen
 
     //! \fn void remove_Leading_And_Trailing_Whitespace_Len(char* stringToChange, size_t stringlen)
     //! \brief remove the whitespace at the beginning and end of a string of a specified length
+    //!
+    //! Removes ASCII whitespace and control characters from both ends. Bytes above 0x7F are also removed from the
+    //! end, but not from the beginning.
     //! \param[out] stringToChange a pointer to the data containing a string
     //! that needs to have the beginning whitespace removed
     //! \param[in] stringlen total length of the string pointed to by \a stringToChange. This will be accessed as
@@ -1336,6 +1606,20 @@ M_NODISCARD M_PARAM_RO(1) M_NULL_TERM_STRING(1) M_FORCEINLINE size_t safe_strlen
         // clang-format on
         ;
 
+    //! \fn stringSpan get_Whitespace_Trimmed_Span(const char* string, size_t stringlen)
+    //! \brief Finds the part of a string left after removing leading and trailing whitespace, without modifying it.
+    //!
+    //! Removes the same characters as remove_Leading_And_Trailing_Whitespace_Len, which are ASCII whitespace and
+    //! control characters plus trailing bytes above 0x7F, but returns a view into \a string rather than moving the
+    //! text. This allows trimming fields in read only buffers such as identify data. Both ends are scanned 16 bytes at
+    //! a time when SIMD is available.
+    //! \param[in] string pointer to the characters to trim. Does not need to be null terminated.
+    //! \param[in] stringlen number of characters in \a string
+    //! \return span pointing to the first character kept in \a string with the number of characters kept. The length is
+    //! zero if every character is trimmed or \a string is NULL.
+    M_NODISCARD M_PARAM_RO_SIZE(1, 2) stringSpan
+        get_Whitespace_Trimmed_Span(const char* M_NULLABLE string, size_t stringlen);
+
     //! \fn void remove_Leading_And_Trailing_Control_Char(char* stringToChange)
     //! \brief remove the control char at the beginning and end of a string
     //! \param[out] stringToChange a pointer to the data containing a string
@@ -1408,12 +1692,107 @@ M_NODISCARD M_PARAM_RO(1) M_NULL_TERM_STRING(1) M_FORCEINLINE size_t safe_strlen
         // clang-format on
         ;
 
+    //! \fn int safe_strncasecmp(const char* string1, const char* string2, size_t count)
+    //! \brief Compares at most \a count characters of two strings ignoring ASCII case.
+    //!
+    //! Works like POSIX strncasecmp in the C locale. Only A-Z and a-z are folded, regardless of the current locale,
+    //! and 16 bytes are compared at a time when SIMD is available.
+    //! \param[in] string1 pointer to the first null terminated string. May be NULL.
+    //! \param[in] string2 pointer to the second null terminated string. May be NULL.
+    //! \param[in] count maximum number of characters to compare
+    //! \return negative value if \a string1 < \a string2, zero if they are equal, positive value if \a string1 >
+    //! \a string2. Characters are compared as lowercase unsigned chars. A NULL string is less than any non-NULL string.
+    M_PARAM_RO(1)
+    M_PARAM_RO(2)
+    int safe_strncasecmp(const char* M_NULLABLE string1, const char* M_NULLABLE string2, size_t count);
+
+    //! \fn int safe_strcasecmp(const char* string1, const char* string2)
+    //! \brief Compares two strings ignoring ASCII case.
+    //!
+    //! Works like POSIX strcasecmp in the C locale. See safe_strncasecmp.
+    //! \param[in] string1 pointer to the first null terminated string. May be NULL.
+    //! \param[in] string2 pointer to the second null terminated string. May be NULL.
+    //! \return negative value if \a string1 < \a string2, zero if they are equal, positive value if \a string1 >
+    //! \a string2. A NULL string is less than any non-NULL string.
+    M_PARAM_RO(1)
+    M_PARAM_RO(2)
+    M_NULL_TERM_STRING(1)
+    M_NULL_TERM_STRING(2)
+    int safe_strcasecmp(const char* M_NULLABLE string1, const char* M_NULLABLE string2);
+
+    //! \fn bool safe_strcaseeq(const char* string1, const char* string2)
+    //! \brief Checks if two strings are equal ignoring ASCII case.
+    //!
+    //! Faster than checking safe_strcasecmp for zero since strings of different lengths are rejected before any
+    //! characters are compared.
+    //! \param[in] string1 pointer to the first null terminated string. May be NULL.
+    //! \param[in] string2 pointer to the second null terminated string. May be NULL.
+    //! \return true if the strings are equal ignoring case, otherwise false. Two NULL strings are equal.
+    M_PARAM_RO(1)
+    M_PARAM_RO(2)
+    M_NULL_TERM_STRING(1)
+    M_NULL_TERM_STRING(2)
+    bool safe_strcaseeq(const char* M_NULLABLE string1, const char* M_NULLABLE string2);
+
+    //! \fn void* safe_memchr(const void* ptr, int ch, size_t count)
+    //! \brief Finds the first byte equal to \a ch in a buffer. Same as memchr, but accepts a NULL pointer.
+    //! \param[in] ptr pointer to the buffer to search. May be NULL.
+    //! \param[in] ch byte value to find. Converted to unsigned char.
+    //! \param[in] count number of bytes in \a ptr to search
+    //! \return pointer to the first matching byte, or NULL if there is no match
+    M_PARAM_RO_SIZE(1, 3)
+    void* M_NULLABLE safe_memchr(const void* M_NULLABLE ptr, int ch, size_t count);
+
+    //! \fn void* safe_memrchr(const void* ptr, int ch, size_t count)
+    //! \brief Finds the last byte equal to \a ch in a buffer, like the GNU memrchr extension.
+    //! \param[in] ptr pointer to the buffer to search. May be NULL.
+    //! \param[in] ch byte value to find. Converted to unsigned char.
+    //! \param[in] count number of bytes in \a ptr to search
+    //! \return pointer to the last matching byte, or NULL if there is no match
+    M_PARAM_RO_SIZE(1, 3)
+    void* M_NULLABLE safe_memrchr(const void* M_NULLABLE ptr, int ch, size_t count);
+
+    //! \fn void* safe_memmem(const void* haystack, size_t haystackLen, const void* needle, size_t needleLen)
+    //! \brief Finds the first occurrence of a byte sequence in a buffer, like the GNU memmem extension.
+    //!
+    //! Runs in linear time for any input. Candidates are found by matching the first and last bytes of \a needle
+    //! a vector at a time. If that produces too many false candidates the search switches to the Two-Way algorithm.
+    //! \param[in] haystack pointer to the buffer to search. May be NULL.
+    //! \param[in] haystackLen number of bytes in \a haystack
+    //! \param[in] needle pointer to the bytes to find. May be NULL only when \a needleLen is 0.
+    //! \param[in] needleLen number of bytes in \a needle
+    //! \return pointer to the first match in \a haystack, or NULL if there is no match. An empty \a needle matches at
+    //! the start of \a haystack.
+    M_PARAM_RO_SIZE(1, 2)
+    M_PARAM_RO_SIZE(3, 4)
+    void* M_NULLABLE safe_memmem(const void* M_NULLABLE haystack,
+                                 size_t                 haystackLen,
+                                 const void* M_NULLABLE needle,
+                                 size_t                 needleLen);
+
+    //! \fn void* safe_memrmem(const void* haystack, size_t haystackLen, const void* needle, size_t needleLen)
+    //! \brief Finds the last occurrence of a byte sequence in a buffer. Reverse form of safe_memmem.
+    //!
+    //! Matches may overlap, so searching "aaa" for "aa" finds the match at offset 1.
+    //! \param[in] haystack pointer to the buffer to search. May be NULL.
+    //! \param[in] haystackLen number of bytes in \a haystack
+    //! \param[in] needle pointer to the bytes to find. May be NULL only when \a needleLen is 0.
+    //! \param[in] needleLen number of bytes in \a needle
+    //! \return pointer to the last match in \a haystack, or NULL if there is no match. An empty \a needle matches at
+    //! the end of \a haystack.
+    M_PARAM_RO_SIZE(1, 2)
+    M_PARAM_RO_SIZE(3, 4)
+    void* M_NULLABLE safe_memrmem(const void* M_NULLABLE haystack,
+                                  size_t                 haystackLen,
+                                  const void* M_NULLABLE needle,
+                                  size_t                 needleLen);
+
     //! \fn size_t find_last_occurrence_in_string(const char* originalString, const char* stringToFind)
     //! \brief Find the last occurrence of one string within another string
     //! \param[in] originalString pointer to the data containing a string that will be searched
     //! \param[in] stringToFind a pointer to the data containing a string that is to be found within \a originalString
     //! \return offset to last occurrence of \a stringToFind in \a originalString. The offset will be from the end of
-    //! the string
+    //! the string. If \a stringToFind is not found, the length of \a originalString is returned.
     M_PARAM_RO(1)
     M_PARAM_RO(2)
     size_t find_last_occurrence_in_string(const char* M_NONNULL originalString, const char* M_NONNULL stringToFind);
@@ -1462,6 +1841,48 @@ M_NODISCARD M_PARAM_RO(1) M_NULL_TERM_STRING(1) M_FORCEINLINE size_t safe_strlen
     M_NULL_TERM_STRING(1)
     M_NULL_TERM_STRING(2) bool wildcard_case_match(const char* M_NONNULL pattern, const char* M_NONNULL data);
 
+    //! \brief Structure holding a wildcard pattern that has been prepared by wildcard_compile.
+    //!
+    //! The literal text before the first '*' and after the last '*' is split off so wildcard_exec can reject most
+    //! non-matching data without running the backtracking matcher.
+    //! \note The structure references the pattern string passed to wildcard_compile. The pattern must stay valid and
+    //! unchanged for as long as the compiled pattern is used.
+    typedef struct swildcardPattern
+    {
+        const char* pattern;         /*!< Pattern string given to wildcard_compile. */
+        size_t      patternLen;      /*!< Length of the pattern string. */
+        size_t      prefixLen;       /*!< Number of pattern characters before the first '*'. */
+        size_t      suffixLen;       /*!< Number of pattern characters after the last '*'. */
+        size_t      minDataLen;      /*!< Minimum data length that can match. Count of non '*' characters. */
+        bool        hasStar;         /*!< Set when the pattern contains at least one '*'. */
+        bool        caseInsensitive; /*!< Set when characters are matched ignoring ASCII case. */
+    } wildcardPattern;
+
+    //! \fn errno_t wildcard_compile(const char* pattern, bool caseInsensitive, wildcardPattern* compiled)
+    //! \brief Prepares a wildcard pattern to be matched against many strings with wildcard_exec.
+    //!
+    //! A single char wildcard match is '?'
+    //! A multi char wildcard match is '*'
+    //! \param[in] pattern a pointer to the pattern consisting wildcard chars. Null terminated. Must remain valid while
+    //! \a compiled is in use.
+    //! \param[in] caseInsensitive set to true to ignore ASCII case when matching characters
+    //! \param[out] compiled pointer to the structure to fill in
+    //! \return 0 on success, EINVAL if \a pattern or \a compiled is NULL
+    M_PARAM_RO(1)
+    M_PARAM_WO(3)
+    M_NULL_TERM_STRING(1)
+    errno_t wildcard_compile(const char* M_NONNULL pattern, bool caseInsensitive, wildcardPattern* M_NONNULL compiled);
+
+    //! \fn bool wildcard_exec(const wildcardPattern* compiled, const char* data)
+    //! \brief match the string with a pattern prepared by wildcard_compile.
+    //! \param[in] compiled pointer to the pattern filled in by wildcard_compile
+    //! \param[in] data a pointer to the data to search. Null terminated.
+    //! \return true = found match, false = no match found
+    M_PARAM_RO(1)
+    M_PARAM_RO(2)
+    M_NULL_TERM_STRING(2)
+    bool wildcard_exec(const wildcardPattern* M_NONNULL compiled, const char* M_NONNULL data);
+
     //! \fn int string_version_compare(const char* string1, const char* string2)
     //! \brief Works like GNU's strvercmp function to compare two strings.
     //! \details Compares two strings taking into account numerical substrings as numbers
@@ -1480,6 +1901,261 @@ M_NODISCARD M_PARAM_RO(1) M_NULL_TERM_STRING(1) M_FORCEINLINE size_t safe_strlen
     M_NULL_TERM_STRING(2)
     int string_version_compare(const char* M_NONNULL string1, const char* M_NONNULL string2);
 
+    //! \brief Growable string with a tracked length.
+    //!
+    //! Appending to a stringBuilder costs time proportional to the text being appended, where repeated safe_strcat
+    //! calls rescan the whole destination each time. Storage grows geometrically so building a string of N bytes
+    //! performs O(log N) reallocations. The buffer is always null terminated.
+    //!
+    //! A caller supplied buffer, typically on the stack, can be given to init_String_Builder as the initial storage
+    //! so that short strings never allocate. Heap storage is only used once the text outgrows it.
+    //! \code
+    //! char          local[128];
+    //! stringBuilder report;
+    //! init_String_Builder(&report, local, sizeof(local));
+    //! string_Builder_Append(&report, "Drive: ");
+    //! string_Builder_Append_Format(&report, "%s (%" PRIu64 " LBAs)\n", model, maxLBA);
+    //! printf("%s", string_Builder_Str(&report));
+    //! free_String_Builder(&report);
+    //! \endcode
+    //! \note The members are used by the string_Builder functions and should not be modified directly.
+    typedef struct sstringBuilder
+    {
+        char* M_NULLABLE buffer;          /*!< Current storage. Null until storage is first needed. */
+        size_t           length;          /*!< Length of the string, not counting the null terminator. */
+        size_t           capacity;        /*!< Size of buffer in bytes, including room for the null terminator. */
+        char* M_NULLABLE initialBuffer;   /*!< Caller supplied storage given to init_String_Builder. */
+        size_t           initialCapacity; /*!< Size of initialBuffer in bytes. */
+    } stringBuilder;
+
+    //! \fn errno_t init_String_Builder(stringBuilder* builder, char* initialBuffer, size_t initialCapacity)
+    //! \brief Initializes an empty string builder.
+    //! \param[out] builder pointer to the string builder to initialize
+    //! \param[in] initialBuffer Optional. Storage to use until the string outgrows it. Must stay valid until the
+    //! builder is freed.
+    //! \param[in] initialCapacity size of \a initialBuffer in bytes. Must be zero if \a initialBuffer is NULL.
+    //! \return 0 on success, EINVAL if \a builder is NULL or \a initialBuffer is NULL while \a initialCapacity is not
+    //! zero
+    M_PARAM_WO(1)
+    M_PARAM_WO_SIZE(2, 3)
+    errno_t init_String_Builder(stringBuilder* M_NONNULL builder,
+                                char* M_NULLABLE         initialBuffer,
+                                size_t                   initialCapacity);
+
+    //! \fn void free_String_Builder(stringBuilder* builder)
+    //! \brief Zeroes the string, frees any heap storage, and returns the builder to its initial empty state.
+    //!
+    //! The builder may be reused after this call. It will use the caller supplied buffer again if one was given to
+    //! init_String_Builder.
+    //! \param[in,out] builder pointer to the string builder to free
+    M_PARAM_RW(1) void free_String_Builder(stringBuilder* M_NULLABLE builder);
+
+    //! \fn errno_t string_Builder_Reserve(stringBuilder* builder, size_t additional)
+    //! \brief Makes sure \a additional more characters can be appended without growing the storage again.
+    //! \param[in,out] builder pointer to the string builder
+    //! \param[in] additional number of characters, not counting the null terminator, to make room for
+    //! \return 0 on success, EINVAL if \a builder is NULL, ERANGE if the size would be larger than RSIZE_MAX, or
+    //! ENOMEM if memory could not be allocated. On ENOMEM the string is zeroed and freed and the builder is left empty.
+    M_PARAM_RW(1) errno_t string_Builder_Reserve(stringBuilder* M_NONNULL builder, size_t additional);
+
+    //! \fn errno_t string_Builder_Append_Char(stringBuilder* builder, char c)
+    //! \brief Appends one character to the string.
+    //! \param[in,out] builder pointer to the string builder
+    //! \param[in] c character to append
+    //! \return 0 on success, otherwise an error as described in string_Builder_Reserve
+    M_PARAM_RW(1) errno_t string_Builder_Append_Char(stringBuilder* M_NONNULL builder, char c);
+
+    //! \fn errno_t string_Builder_Append(stringBuilder* builder, const char* str)
+    //! \brief Appends a null terminated string.
+    //! \param[in,out] builder pointer to the string builder
+    //! \param[in] str string to append
+    //! \return 0 on success, EINVAL if \a str is NULL, otherwise an error as described in string_Builder_Reserve
+    //! \note \a str may point into the builder's own text, such as string_Builder_Str(builder), to repeat it.
+    M_PARAM_RW(1)
+    M_PARAM_RO(2)
+    M_NULL_TERM_STRING(2)
+    errno_t string_Builder_Append(stringBuilder* M_NONNULL builder, const char* M_NONNULL str);
+
+    //! \fn errno_t string_Builder_Append_N(stringBuilder* builder, const char* str, size_t count)
+    //! \brief Appends at most \a count characters of \a str, stopping early at a null terminator.
+    //! \param[in,out] builder pointer to the string builder
+    //! \param[in] str string to append. Does not need to be null terminated if it is at least \a count bytes long.
+    //! \param[in] count maximum number of characters to append
+    //! \return 0 on success, EINVAL if \a str is NULL, otherwise an error as described in string_Builder_Reserve
+    //! \note \a str may point into the builder's own text. It is found again in the new storage if the builder grows.
+    M_PARAM_RW(1)
+    M_PARAM_RO_SIZE(2, 3)
+    errno_t string_Builder_Append_N(stringBuilder* M_NONNULL builder, const char* M_NONNULL str, size_t count);
+
+    //! \fn errno_t string_Builder_Append_Format(stringBuilder* builder, const char* format, ...)
+    //! \brief Appends printf style formatted text.
+    //!
+    //! The text is formatted straight into the spare capacity of the builder. Only when it does not fit is the
+    //! storage grown and the text formatted a second time.
+    //! \param[in,out] builder pointer to the string builder
+    //! \param[in] format printf style format string
+    //! \param[in] ... arguments for \a format
+    //! \return 0 on success, EINVAL if \a format is NULL or formatting fails, otherwise an error as described in
+    //! string_Builder_Reserve
+    //! \note \a format and the arguments must not point into the builder itself. The text is written over the end
+    //! of the builder's storage, and growing frees and zeroes it. Copy the text out first or use
+    //! string_Builder_Append to repeat it.
+    M_PARAM_RW(1)
+    M_PARAM_RO(2)
+    FUNC_ATTR_PRINTF(2, 3)
+    errno_t string_Builder_Append_Format(stringBuilder* M_NONNULL builder, const char* M_NONNULL format, ...);
+
+    //! \fn errno_t string_Builder_Append_VFormat(stringBuilder* builder, const char* format, va_list args)
+    //! \brief Appends printf style formatted text using a va_list.
+    //! \param[in,out] builder pointer to the string builder
+    //! \param[in] format printf style format string
+    //! \param[in] args arguments for \a format
+    //! \return 0 on success, EINVAL if \a format is NULL or formatting fails, otherwise an error as described in
+    //! string_Builder_Reserve
+    //! \note \a format and the arguments must not point into the builder itself. See string_Builder_Append_Format.
+    M_PARAM_RW(1)
+    M_PARAM_RO(2)
+    FUNC_ATTR_PRINTF(2, 0)
+    errno_t string_Builder_Append_VFormat(stringBuilder* M_NONNULL builder, const char* M_NONNULL format, va_list args);
+
+    //! \fn void string_Builder_Clear(stringBuilder* builder)
+    //! \brief Zeroes the string with explicit_zeroes and sets the length to zero. The storage is kept for reuse.
+    //! \param[in,out] builder pointer to the string builder
+    M_PARAM_RW(1) void string_Builder_Clear(stringBuilder* M_NULLABLE builder);
+
+    //! \fn const char* string_Builder_Str(const stringBuilder* builder)
+    //! \brief Gets the current string.
+    //! \param[in] builder pointer to the string builder
+    //! \return pointer to the null terminated string. Never NULL. Only valid until the builder is next modified.
+    M_NODISCARD M_PARAM_RO(1) const char* M_NONNULL string_Builder_Str(const stringBuilder* M_NULLABLE builder);
+
+    //! \fn size_t string_Builder_Length(const stringBuilder* builder)
+    //! \brief Gets the length of the current string without scanning it.
+    //! \param[in] builder pointer to the string builder
+    //! \return length of the string, or zero if \a builder is NULL
+    M_NODISCARD M_PARAM_RO(1) size_t string_Builder_Length(const stringBuilder* M_NULLABLE builder);
+
+    //! \fn char* string_Builder_Detach(stringBuilder* builder)
+    //! \brief Takes ownership of the string away from the builder.
+    //!
+    //! If the string is still in the caller supplied buffer it is copied to the heap first. The builder is left empty
+    //! and may be reused.
+    //! \param[in,out] builder pointer to the string builder
+    //! \return heap allocated null terminated string to be freed by the caller with safe_free, or M_NULLPTR if
+    //! \a builder is NULL or memory could not be allocated
+    M_NODISCARD_REASON("The returned pointer must be freed by the caller using safe_free()")
+    M_PARAM_RW(1) char* M_NULLABLE string_Builder_Detach(stringBuilder* M_NULLABLE builder);
+
+    //! \brief Aho-Corasick automaton that finds many patterns in one pass over the data.
+    //!
+    //! The automaton is built once with create_Multi_Pattern_Matcher and is not modified by searching, so one matcher
+    //! may be shared by several threads as long as each has its own multiPatternStream. Each input byte costs one
+    //! table lookup no matter how many patterns there are, where calling find_first_occurrence_in_string once per
+    //! pattern rescans the data for each one.
+    typedef struct smultiPatternMatcher multiPatternMatcher;
+
+    //! \typedef multipatternmatchfn
+    //! \brief Called for each match found by a multiPatternMatcher.
+    //! \param[in] patternID index of the matched pattern in the list given to create_Multi_Pattern_Matcher
+    //! \param[in] offset offset of the first byte of the match from the start of the stream
+    //! \param[in] length length of the matched pattern in bytes
+    //! \param[in] context caller supplied context
+    //! \return true to keep searching, false to stop
+    typedef bool (*multipatternmatchfn)(size_t patternID, uint64_t offset, size_t length, void* M_NULLABLE context);
+
+    //! \brief Search position within a stream of data being fed to a multiPatternMatcher.
+    //!
+    //! Matches that span two chunks are found because the position in the automaton is carried over between calls
+    //! to multi_Pattern_Stream_Feed, so a file can be searched one read at a time.
+    typedef struct smultiPatternStream
+    {
+        const multiPatternMatcher* M_NULLABLE matcher; /*!< automaton being run */
+        uint64_t                              offset;  /*!< number of bytes fed so far */
+        uint32_t                              state;   /*!< current automaton state */
+    } multiPatternStream;
+
+    //! \fn multiPatternMatcher* create_Multi_Pattern_Matcher(const char* const* patterns, const size_t* lengths,
+    //! size_t patternCount, bool caseInsensitive)
+    //! \brief Builds an automaton that matches every pattern in a list.
+    //!
+    //! Building takes time proportional to the total length of the patterns. Patterns may overlap or repeat; every
+    //! pattern that matches is reported, including matches inside other matches.
+    //! \param[in] patterns list of patterns to find. Must not contain NULL or empty patterns.
+    //! \param[in] lengths length of each pattern in bytes. If NULL, each pattern is a null terminated string.
+    //! \param[in] patternCount number of patterns in \a patterns. Must not be zero.
+    //! \param[in] caseInsensitive set to true to ignore ASCII case when matching
+    //! \return pointer to the new matcher, or M_NULLPTR if the arguments are invalid or memory could not be allocated
+    M_NODISCARD_REASON("The returned pointer must be freed by the caller using free_Multi_Pattern_Matcher()")
+    M_PARAM_RO_SIZE(1, 3)
+    M_PARAM_RO_SIZE(2, 3)
+    multiPatternMatcher* M_NULLABLE create_Multi_Pattern_Matcher(const char* M_NONNULL const* M_NONNULL patterns,
+                                                                 const size_t* M_NULLABLE lengths,
+                                                                 size_t                   patternCount,
+                                                                 bool                     caseInsensitive);
+
+    //! \fn void free_Multi_Pattern_Matcher(multiPatternMatcher** matcher)
+    //! \brief Frees a matcher created by create_Multi_Pattern_Matcher.
+    //! \param[in,out] matcher pointer to the matcher to free. Set to M_NULLPTR on return.
+    void free_Multi_Pattern_Matcher(multiPatternMatcher* M_NULLABLE* M_NULLABLE matcher);
+
+    //! \fn errno_t init_Multi_Pattern_Stream(multiPatternStream* stream, const multiPatternMatcher* matcher)
+    //! \brief Starts a new search at offset zero.
+    //! \param[out] stream stream state to initialize
+    //! \param[in] matcher automaton to run. Must stay valid while \a stream is in use.
+    //! \return 0 on success, EINVAL if either pointer is NULL
+    M_PARAM_WO(1)
+    M_PARAM_RO(2)
+    errno_t init_Multi_Pattern_Stream(multiPatternStream* M_NONNULL        stream,
+                                      const multiPatternMatcher* M_NONNULL matcher);
+
+    //! \fn bool multi_Pattern_Stream_Feed(multiPatternStream* stream, const void* data, size_t length,
+    //! multipatternmatchfn onMatch, void* context)
+    //! \brief Searches the next chunk of a stream and reports each match as soon as its last byte is seen.
+    //!
+    //! Matches are reported in order of where they end. Matches ending at the same byte are reported longest first.
+    //! \code
+    //! multiPatternStream stream;
+    //! init_Multi_Pattern_Stream(&stream, matcher);
+    //! while ((bytesRead = fread(chunk, 1, sizeof(chunk), logFile)) > 0)
+    //! {
+    //!     if (!multi_Pattern_Stream_Feed(&stream, chunk, bytesRead, count_signature, &counts))
+    //!     {
+    //!         break;
+    //!     }
+    //! }
+    //! \endcode
+    //! \param[in,out] stream stream state from init_Multi_Pattern_Stream
+    //! \param[in] data pointer to the next chunk of data
+    //! \param[in] length number of bytes in \a data
+    //! \param[in] onMatch function to call for each match
+    //! \param[in] context passed to \a onMatch
+    //! \return true if the whole chunk was searched. false if \a onMatch asked to stop or an argument is invalid. After
+    //! a stop, \a stream is positioned just past the byte that ended the match.
+    M_PARAM_RW(1)
+    M_PARAM_RO_SIZE(2, 3)
+    bool multi_Pattern_Stream_Feed(multiPatternStream* M_NONNULL stream,
+                                   const void* M_NULLABLE        data,
+                                   size_t                        length,
+                                   multipatternmatchfn M_NONNULL onMatch,
+                                   void* M_NULLABLE              context);
+
+    //! \fn bool multi_Pattern_Search(const multiPatternMatcher* matcher, const void* data, size_t length,
+    //! multipatternmatchfn onMatch, void* context)
+    //! \brief Searches a single buffer. Same as feeding it to a newly initialized multiPatternStream.
+    //! \param[in] matcher automaton to run
+    //! \param[in] data pointer to the data to search
+    //! \param[in] length number of bytes in \a data
+    //! \param[in] onMatch function to call for each match
+    //! \param[in] context passed to \a onMatch
+    //! \return true if the whole buffer was searched. false if \a onMatch asked to stop or an argument is invalid.
+    M_PARAM_RO(1)
+    M_PARAM_RO_SIZE(2, 3)
+    bool multi_Pattern_Search(const multiPatternMatcher* M_NONNULL matcher,
+                              const void* M_NULLABLE               data,
+                              size_t                               length,
+                              multipatternmatchfn M_NONNULL        onMatch,
+                              void* M_NULLABLE                     context);
+
 #if defined(__cplusplus)
 }
 #endif
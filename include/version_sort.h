@@ -58,6 +58,77 @@ typedef int (*scandircmp)(const struct dirent* M_NONNULL* M_NONNULL, const struc
 int version_sort(const struct dirent* M_NONNULL* M_NONNULL ptr1, const struct dirent* M_NONNULL* M_NONNULL ptr2);
 #endif
 
+    //! \fn size_t version_sort_key(const char* string, uint8_t* key, size_t keySize)
+    //! \brief Converts a string into a key that sorts with memcmp in the same order as string_version_compare.
+    //!
+    //! Converting each string once and comparing keys avoids parsing the numbers again on every comparison of a sort.
+    //! Characters other than digits are copied to the key. Each run of digits becomes a marker byte followed by the
+    //! number of significant digits, the significant digits, then the number of leading zeros encoded so that more
+    //! zeros sort first. The counts are stored with a length prefix so that longer numbers sort after shorter ones and
+    //! numbers of any length are ordered correctly.
+    //!
+    //! Keys are compared with memcmp over the shorter length, then a shorter key sorts first. version_sort_key_compare
+    //! does this. A key is never longer than 4 times the length of \a string.
+    //! \param[in] string null terminated string to convert
+    //! \param[out] key buffer to receive the key. May be NULL when \a keySize is zero to get the required size.
+    //! \param[in] keySize size of \a key in bytes
+    //! \return length of the complete key. If this is larger than \a keySize, the key was truncated.
+    M_NODISCARD
+    M_PARAM_RO(1)
+    M_NULL_TERM_STRING(1)
+    M_PARAM_WO_SIZE(2, 3)
+    size_t version_sort_key(const char* M_NONNULL string, uint8_t* M_NULLABLE key, size_t keySize);
+
+    //! \fn int version_sort_key_compare(const uint8_t* key1, size_t key1Length, const uint8_t* key2, size_t
+    //! key2Length)
+    //! \brief Compares two keys from version_sort_key.
+    //! \param[in] key1 pointer to the first key
+    //! \param[in] key1Length length of \a key1 in bytes
+    //! \param[in] key2 pointer to the second key
+    //! \param[in] key2Length length of \a key2 in bytes
+    //! \return negative value, zero, or positive value as string_version_compare would return for the original strings
+    M_NODISCARD
+    M_PARAM_RO_SIZE(1, 2)
+    M_PARAM_RO_SIZE(3, 4)
+    int version_sort_key_compare(const uint8_t* M_NONNULL key1,
+                                 size_t                   key1Length,
+                                 const uint8_t* M_NONNULL key2,
+                                 size_t                   key2Length);
+
+    //! \typedef versionsortnamefn
+    //! \brief Returns the string to sort by for one element of an array passed to version_sort_array.
+    typedef const char* M_NONNULL (*versionsortnamefn)(const void* M_NONNULL element);
+
+    //! \fn errno_t version_sort_array(void* base, size_t count, size_t size, versionsortnamefn getName)
+    //! \brief Sorts an array of any element type by a version string within each element.
+    //!
+    //! A key is built once for each element, so each comparison during the sort is a memcmp. Elements are moved into
+    //! place once at the end.
+    //! \code
+    //! static const char* M_NONNULL dirent_name(const void* M_NONNULL element)
+    //! {
+    //!     return (*M_REINTERPRET_CAST(const struct dirent* const*, element))->d_name;
+    //! }
+    //! ...
+    //! version_sort_array(namelist, entryCount, sizeof(struct dirent*), dirent_name);
+    //! \endcode
+    //! \param[in,out] base pointer to the array to sort
+    //! \param[in] count number of elements in \a base
+    //! \param[in] size size of each element in bytes
+    //! \param[in] getName function returning the string to sort each element by
+    //! \return 0 on success, EINVAL if a pointer is NULL or \a size is zero, ENOMEM if memory could not be allocated,
+    //! or ERANGE if the total size of the keys or the array is too large
+    M_PARAM_RW(1)
+    errno_t version_sort_array(void* M_NULLABLE base, size_t count, size_t size, versionsortnamefn M_NONNULL getName);
+
+    //! \fn errno_t version_sort_strings(const char** strings, size_t count)
+    //! \brief Sorts an array of strings in the order of string_version_compare.
+    //! \param[in,out] strings array of pointers to null terminated strings
+    //! \param[in] count number of strings in \a strings
+    //! \return 0 on success, otherwise an error as described in version_sort_array
+    M_PARAM_RW_SIZE(1, 2)
+    errno_t version_sort_strings(const char* M_NONNULL* M_NULLABLE strings, size_t count);
+
 #if defined(__cplusplus)
 }
 #endif //__cplusplus
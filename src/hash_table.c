@@ -0,0 +1,537 @@
+// SPDX-License-Identifier: MPL-2.0
+
+//! \file hash_table.c
+//! \brief Implements a generic Robin Hood open addressing hash map/set.
+//!
+//! \details Each slot has a small info record holding its probe distance and the upper 32 bits of the key's hash.
+//! Probe distance 0 marks an empty slot. The info records, keys, and values each live in their own contiguous array
+//! so a probe sequence scans consecutive info records and only touches a key when the stored hash bits match.
+//! Robin Hood insertion keeps every probe sequence short and lets a lookup stop as soon as it reaches a slot whose
+//! entry is closer to home than the key being searched for.
+//! \copyright
+//! Do NOT modify or remove this copyright and license
+//!
+//! Copyright (c) 2026 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//!
+//! This software is subject to the terms of the Mozilla Public License, v. 2.0.
+//! If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "hash_table.h"
+#include "common_types.h"
+#include "memory_safety.h"
+#include "type_conversion.h"
+
+#include <string.h>
+
+#define HASH_TABLE_MIN_CAPACITY SIZE_T_C(8)
+
+typedef struct shashSlotInfo
+{
+    uint32_t distance; // probe distance + 1. 0 means the slot is empty
+    uint32_t hashbits; // upper 32 bits of the mixed hash to reject most mismatches without calling equal
+} hashSlotInfo;
+
+struct shashTable
+{
+    hashSlotInfo* M_NULLABLE    slots;
+    uint8_t* M_NULLABLE         keys;
+    uint8_t* M_NULLABLE         values;
+    uint8_t* M_NULLABLE         scratch; // keysize + valuesize bytes used to carry displaced entries
+    size_t                      keysize;
+    size_t                      valuesize;
+    size_t                      capacity; // always a power of 2 once allocated
+    size_t                      count;
+    hashtablehashfn M_NONNULL   hash;
+    hashtableequalfn M_NULLABLE equal;
+    void* M_NULLABLE            context;
+};
+
+// Final mix from MurmurHash3. Spreads the caller's hash so the low bits used for the slot index depend on every bit.
+static M_INLINE uint64_t mix_hash(uint64_t hash)
+{
+    hash ^= hash >> 33;
+    hash *= UINT64_C(0xff51afd7ed558ccd);
+    hash ^= hash >> 33;
+    hash *= UINT64_C(0xc4ceb9fe1a85ec53);
+    hash ^= hash >> 33;
+    return hash;
+}
+
+uint64_t hash_Table_Hash_Bytes(const void* M_NONNULL key, size_t keysize, void* M_NULLABLE context)
+{
+    const uint8_t* bytes = M_REINTERPRET_CAST(const uint8_t*, key);
+    uint64_t       hash  = UINT64_C(0x9e3779b97f4a7c15) ^ M_STATIC_CAST(uint64_t, keysize);
+    size_t         iter  = SIZE_T_C(0);
+    M_USE_UNUSED(context);
+    for (; iter + SIZE_T_C(8) <= keysize; iter += SIZE_T_C(8))
+    {
+        uint64_t word = UINT64_C(0);
+        memcpy(&word, bytes + iter, sizeof(word));
+        hash = (hash ^ mix_hash(word)) * UINT64_C(0x9e3779b97f4a7c15);
+        hash ^= hash >> 29;
+    }
+    if (iter < keysize)
+    {
+        uint64_t word = UINT64_C(0);
+        memcpy(&word, bytes + iter, keysize - iter);
+        hash = (hash ^ mix_hash(word)) * UINT64_C(0x9e3779b97f4a7c15);
+    }
+    return mix_hash(hash);
+}
+
+static M_INLINE bool keys_equal(const hashTable* M_NONNULL table,
+                                const void* M_NONNULL      key1,
+                                const void* M_NONNULL      key2)
+{
+    if (table->equal != M_NULLPTR)
+    {
+        return table->equal(key1, key2, table->keysize, table->context);
+    }
+    return memcmp(key1, key2, table->keysize) == 0;
+}
+
+static M_INLINE uint64_t table_hash(const hashTable* M_NONNULL table, const void* M_NONNULL key)
+{
+    return mix_hash(table->hash(key, table->keysize, table->context));
+}
+
+static M_INLINE uint8_t* slot_key(const hashTable* M_NONNULL table, size_t slot)
+{
+    return table->keys + slot * table->keysize;
+}
+
+static M_INLINE uint8_t* M_NULLABLE slot_value(const hashTable* M_NONNULL table, size_t slot)
+{
+    return table->valuesize > SIZE_T_C(0) ? table->values + slot * table->valuesize : M_NULLPTR;
+}
+
+static void swap_bytes(uint8_t* M_NONNULL first, uint8_t* M_NONNULL second, size_t length)
+{
+    for (size_t iter = SIZE_T_C(0); iter < length; ++iter)
+    {
+        uint8_t temp = first[iter];
+        first[iter]  = second[iter];
+        second[iter] = temp;
+    }
+}
+
+// Returns the slot holding key, or capacity when it is not present.
+static size_t find_slot(const hashTable* M_NONNULL table, const void* M_NONNULL key, uint64_t hash)
+{
+    if (table->count > SIZE_T_C(0))
+    {
+        size_t   mask     = table->capacity - SIZE_T_C(1);
+        size_t   slot     = M_STATIC_CAST(size_t, hash) & mask;
+        uint32_t hashbits = M_STATIC_CAST(uint32_t, hash >> 32);
+        uint32_t distance = UINT32_C(1);
+        // Once a slot holds an entry that is closer to its home than we are to ours, the key cannot be further on
+        // since Robin Hood insertion would have displaced that entry. Empty slots (distance 0) also end the search.
+        while (table->slots[slot].distance >= distance)
+        {
+            if (table->slots[slot].distance == distance && table->slots[slot].hashbits == hashbits &&
+                keys_equal(table, key, slot_key(table, slot)))
+            {
+                return slot;
+            }
+            slot = (slot + SIZE_T_C(1)) & mask;
+            ++distance;
+        }
+    }
+    return table->capacity;
+}
+
+// Places the entry held in scratch into the table. The key must not already be present and there must be a free slot.
+static void robin_hood_place(hashTable* M_NONNULL table, uint64_t hash)
+{
+    size_t       mask      = table->capacity - SIZE_T_C(1);
+    size_t       slot      = M_STATIC_CAST(size_t, hash) & mask;
+    hashSlotInfo carry     = {UINT32_C(1), M_STATIC_CAST(uint32_t, hash >> 32)};
+    uint8_t*     carryKey  = table->scratch;
+    uint8_t*     carryData = table->scratch + table->keysize;
+    for (;;)
+    {
+        hashSlotInfo* info = &table->slots[slot];
+        if (info->distance == UINT32_C(0))
+        {
+            *info = carry;
+            memcpy(slot_key(table, slot), carryKey, table->keysize);
+            if (table->valuesize > SIZE_T_C(0))
+            {
+                memcpy(slot_value(table, slot), carryData, table->valuesize);
+            }
+            break;
+        }
+        if (info->distance < carry.distance)
+        {
+            // The resident is closer to home than the entry being carried, so it gives up its slot and continues
+            // the search in its place.
+            hashSlotInfo temp = *info;
+            *info             = carry;
+            carry             = temp;
+            swap_bytes(slot_key(table, slot), carryKey, table->keysize);
+            if (table->valuesize > SIZE_T_C(0))
+            {
+                swap_bytes(slot_value(table, slot), carryData, table->valuesize);
+            }
+        }
+        slot = (slot + SIZE_T_C(1)) & mask;
+        ++carry.distance;
+    }
+    explicit_zeroes(table->scratch, table->keysize + table->valuesize);
+}
+
+// Zeroes then frees the slot arrays. The table fields are left pointing at nothing.
+static void release_storage(hashTable* M_NONNULL table)
+{
+    if (table->capacity > SIZE_T_C(0))
+    {
+        explicit_zeroes(table->slots, table->capacity * sizeof(hashSlotInfo));
+        explicit_zeroes(table->keys, table->capacity * table->keysize);
+        if (table->values != M_NULLPTR)
+        {
+            explicit_zeroes(table->values, table->capacity * table->valuesize);
+        }
+    }
+    safe_free_core(M_REINTERPRET_CAST(void**, &table->slots));
+    safe_free(&table->keys);
+    safe_free(&table->values);
+    table->capacity = SIZE_T_C(0);
+}
+
+static errno_t rehash(hashTable* M_NONNULL table, size_t newCapacity)
+{
+    hashTable old = *table;
+    if (newCapacity > SIZE_MAX / sizeof(hashSlotInfo) || newCapacity > SIZE_MAX / table->keysize ||
+        (table->valuesize > SIZE_T_C(0) && newCapacity > SIZE_MAX / table->valuesize))
+    {
+        return ERANGE;
+    }
+    table->slots  = M_REINTERPRET_CAST(hashSlotInfo*, safe_calloc(newCapacity, sizeof(hashSlotInfo)));
+    table->keys   = M_REINTERPRET_CAST(uint8_t*, safe_malloc(newCapacity * table->keysize));
+    table->values = table->valuesize > SIZE_T_C(0)
+                        ? M_REINTERPRET_CAST(uint8_t*, safe_malloc(newCapacity * table->valuesize))
+                        : M_NULLPTR;
+    if (table->slots == M_NULLPTR || table->keys == M_NULLPTR ||
+        (table->valuesize > SIZE_T_C(0) && table->values == M_NULLPTR))
+    {
+        safe_free_core(M_REINTERPRET_CAST(void**, &table->slots));
+        safe_free(&table->keys);
+        safe_free(&table->values);
+        table->slots  = old.slots;
+        table->keys   = old.keys;
+        table->values = old.values;
+        return ENOMEM;
+    }
+    table->capacity = newCapacity;
+    for (size_t slot = SIZE_T_C(0); slot < old.capacity; ++slot)
+    {
+        if (old.slots[slot].distance != UINT32_C(0))
+        {
+            memcpy(table->scratch, slot_key(&old, slot), table->keysize);
+            if (table->valuesize > SIZE_T_C(0))
+            {
+                memcpy(table->scratch + table->keysize, slot_value(&old, slot), table->valuesize);
+            }
+            robin_hood_place(table, table_hash(table, table->scratch));
+        }
+    }
+    release_storage(&old);
+    return 0;
+}
+
+// Keeps the load factor at or below 7/8. Returns the capacity needed to hold count entries.
+static size_t capacity_for(size_t count)
+{
+    size_t capacity = HASH_TABLE_MIN_CAPACITY;
+    while (capacity - (capacity >> 3) < count)
+    {
+        if (capacity > SIZE_MAX / SIZE_T_C(2))
+        {
+            return SIZE_T_C(0);
+        }
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+errno_t hash_Table_Reserve(hashTable* M_NONNULL table, size_t count)
+{
+    size_t newCapacity = SIZE_T_C(0);
+    if (table == M_NULLPTR)
+    {
+        return EINVAL;
+    }
+    newCapacity = capacity_for(count);
+    if (newCapacity == SIZE_T_C(0))
+    {
+        return ERANGE;
+    }
+    if (newCapacity <= table->capacity)
+    {
+        return 0;
+    }
+    return rehash(table, newCapacity);
+}
+
+hashTable* M_NULLABLE create_Hash_Table(size_t                      keysize,
+                                        size_t                      valuesize,
+                                        size_t                      initialCount,
+                                        hashtablehashfn M_NULLABLE  hash,
+                                        hashtableequalfn M_NULLABLE equal,
+                                        void* M_NULLABLE            context)
+{
+    hashTable* table = M_NULLPTR;
+    if (keysize == SIZE_T_C(0) || keysize > RSIZE_MAX || valuesize > RSIZE_MAX)
+    {
+        return M_NULLPTR;
+    }
+    table = M_REINTERPRET_CAST(hashTable*, safe_calloc(SIZE_T_C(1), sizeof(hashTable)));
+    if (table == M_NULLPTR)
+    {
+        return M_NULLPTR;
+    }
+    table->keysize   = keysize;
+    table->valuesize = valuesize;
+    table->hash      = hash != M_NULLPTR ? hash : hash_Table_Hash_Bytes;
+    table->equal     = equal;
+    table->context   = context;
+    table->scratch   = M_REINTERPRET_CAST(uint8_t*, safe_malloc(keysize + valuesize));
+    if (table->scratch == M_NULLPTR || hash_Table_Reserve(table, initialCount) != 0)
+    {
+        free_Hash_Table(&table);
+    }
+    return table;
+}
+
+void free_Hash_Table(hashTable* M_NULLABLE* M_NULLABLE table)
+{
+    if (table != M_NULLPTR && *table != M_NULLPTR)
+    {
+        release_storage(*table);
+        if ((*table)->scratch != M_NULLPTR)
+        {
+            explicit_zeroes((*table)->scratch, (*table)->keysize + (*table)->valuesize);
+            safe_free(&(*table)->scratch);
+        }
+        explicit_zeroes(*table, sizeof(hashTable));
+        safe_free_core(M_REINTERPRET_CAST(void**, table));
+    }
+}
+
+errno_t hash_Table_Insert(hashTable* M_NONNULL   table,
+                          const void* M_NONNULL  key,
+                          const void* M_NULLABLE value,
+                          bool* M_NULLABLE       existed)
+{
+    uint64_t hash = UINT64_C(0);
+    size_t   slot = SIZE_T_C(0);
+    if (existed != M_NULLPTR)
+    {
+        *existed = false;
+    }
+    if (table == M_NULLPTR || key == M_NULLPTR)
+    {
+        return EINVAL;
+    }
+    hash = table_hash(table, key);
+    slot = find_slot(table, key, hash);
+    if (slot < table->capacity)
+    {
+        if (existed != M_NULLPTR)
+        {
+            *existed = true;
+        }
+    }
+    else
+    {
+        if (table->count + SIZE_T_C(1) > table->capacity - (table->capacity >> 3))
+        {
+            errno_t error = hash_Table_Reserve(table, table->count + SIZE_T_C(1));
+            if (error != 0)
+            {
+                return error;
+            }
+        }
+        memcpy(table->scratch, key, table->keysize);
+        if (table->valuesize > SIZE_T_C(0))
+        {
+            if (value != M_NULLPTR)
+            {
+                memcpy(table->scratch + table->keysize, value, table->valuesize);
+            }
+            else
+            {
+                memset(table->scratch + table->keysize, 0, table->valuesize);
+            }
+        }
+        robin_hood_place(table, hash);
+        ++table->count;
+        return 0;
+    }
+    if (table->valuesize > SIZE_T_C(0) && value != M_NULLPTR)
+    {
+        memmove(slot_value(table, slot), value, table->valuesize);
+    }
+    return 0;
+}
+
+// Returns the slot holding key, or SIZE_MAX when it is not present
+static size_t lookup_slot(const hashTable* M_NULLABLE table, const void* M_NULLABLE key)
+{
+    size_t slot = SIZE_MAX;
+    if (table != M_NULLPTR && key != M_NULLPTR && table->count > SIZE_T_C(0))
+    {
+        slot = find_slot(table, key, table_hash(table, key));
+        if (slot >= table->capacity)
+        {
+            slot = SIZE_MAX;
+        }
+    }
+    return slot;
+}
+
+const void* M_NULLABLE hash_Table_Find(const hashTable* M_NONNULL table, const void* M_NONNULL key)
+{
+    size_t slot = lookup_slot(table, key);
+    if (slot == SIZE_MAX)
+    {
+        return M_NULLPTR;
+    }
+    return table->valuesize > SIZE_T_C(0) ? slot_value(table, slot) : slot_key(table, slot);
+}
+
+void* M_NULLABLE hash_Table_Find_Mutable(hashTable* M_NONNULL table, const void* M_NONNULL key)
+{
+    size_t slot = lookup_slot(table, key);
+    if (slot == SIZE_MAX)
+    {
+        return M_NULLPTR;
+    }
+    return slot_value(table, slot);
+}
+
+bool hash_Table_Contains(const hashTable* M_NONNULL table, const void* M_NONNULL key)
+{
+    return hash_Table_Find(table, key) != M_NULLPTR;
+}
+
+bool hash_Table_Remove(hashTable* M_NONNULL table, const void* M_NONNULL key)
+{
+    size_t mask = SIZE_T_C(0);
+    size_t slot = SIZE_T_C(0);
+    size_t next = SIZE_T_C(0);
+    if (table == M_NULLPTR || key == M_NULLPTR || table->count == SIZE_T_C(0))
+    {
+        return false;
+    }
+    slot = find_slot(table, key, table_hash(table, key));
+    if (slot >= table->capacity)
+    {
+        return false;
+    }
+    // Backward shift: pull every following entry that is not already in its home slot back by one so that no
+    // tombstone is needed and the Robin Hood ordering is kept.
+    mask = table->capacity - SIZE_T_C(1);
+    next = (slot + SIZE_T_C(1)) & mask;
+    while (table->slots[next].distance > UINT32_C(1))
+    {
+        table->slots[slot] = table->slots[next];
+        --table->slots[slot].distance;
+        memcpy(slot_key(table, slot), slot_key(table, next), table->keysize);
+        if (table->valuesize > SIZE_T_C(0))
+        {
+            memcpy(slot_value(table, slot), slot_value(table, next), table->valuesize);
+        }
+        slot = next;
+        next = (next + SIZE_T_C(1)) & mask;
+    }
+    table->slots[slot].distance = UINT32_C(0);
+    table->slots[slot].hashbits = UINT32_C(0);
+    explicit_zeroes(slot_key(table, slot), table->keysize);
+    if (table->valuesize > SIZE_T_C(0))
+    {
+        explicit_zeroes(slot_value(table, slot), table->valuesize);
+    }
+    --table->count;
+    return true;
+}
+
+void hash_Table_Clear(hashTable* M_NULLABLE table)
+{
+    if (table != M_NULLPTR && table->capacity > SIZE_T_C(0))
+    {
+        explicit_zeroes(table->slots, table->capacity * sizeof(hashSlotInfo));
+        explicit_zeroes(table->keys, table->capacity * table->keysize);
+        if (table->values != M_NULLPTR)
+        {
+            explicit_zeroes(table->values, table->capacity * table->valuesize);
+        }
+        table->count = SIZE_T_C(0);
+    }
+}
+
+size_t hash_Table_Count(const hashTable* M_NULLABLE table)
+{
+    return table != M_NULLPTR ? table->count : SIZE_T_C(0);
+}
+
+// Returns the next occupied slot at or after the cursor and moves the cursor past it, or SIZE_MAX at the end
+static size_t next_occupied_slot(const hashTable* M_NULLABLE table, size_t* M_NULLABLE cursor)
+{
+    if (table == M_NULLPTR || cursor == M_NULLPTR)
+    {
+        return SIZE_MAX;
+    }
+    for (size_t slot = *cursor; slot < table->capacity; ++slot)
+    {
+        if (table->slots[slot].distance != UINT32_C(0))
+        {
+            *cursor = slot + SIZE_T_C(1);
+            return slot;
+        }
+    }
+    *cursor = table->capacity;
+    return SIZE_MAX;
+}
+
+bool hash_Table_Next(const hashTable* M_NONNULL         table,
+                     size_t* M_NONNULL                  cursor,
+                     const void* M_NULLABLE* M_NULLABLE key,
+                     const void* M_NULLABLE* M_NULLABLE value)
+{
+    size_t slot = next_occupied_slot(table, cursor);
+    if (slot == SIZE_MAX)
+    {
+        return false;
+    }
+    if (key != M_NULLPTR)
+    {
+        *key = slot_key(table, slot);
+    }
+    if (value != M_NULLPTR)
+    {
+        *value = slot_value(table, slot);
+    }
+    return true;
+}
+
+bool hash_Table_Next_Mutable(hashTable* M_NONNULL               table,
+                             size_t* M_NONNULL                  cursor,
+                             const void* M_NULLABLE* M_NULLABLE key,
+                             void* M_NULLABLE* M_NULLABLE       value)
+{
+    size_t slot = next_occupied_slot(table, cursor);
+    if (slot == SIZE_MAX)
+    {
+        return false;
+    }
+    if (key != M_NULLPTR)
+    {
+        *key = slot_key(table, slot);
+    }
+    if (value != M_NULLPTR)
+    {
+        *value = slot_value(table, slot);
+    }
+    return true;
+}
@@ -1426,10 +1426,7 @@ static M_INLINE eintergetInputStrType get_Input_Str_Type(const char* M_NONNULL s
         {
             const char* temp = str;
             // Scan for decimal digits only; stop at first non-digit (unit starts here)
-            while (*temp != '\0' && safe_isdigit(*temp))
-            {
-                ++temp;
-            }
+            temp += char_class_span(temp, safe_strlen(temp), CHAR_CLASS_DIGIT);
             // Validate the unit portion
             if (!is_Allowed_Unit_For_Get_And_Validate_Input(temp, unittype))
             {
@@ -1462,16 +1459,10 @@ static M_INLINE eintergetInputStrType get_Input_Str_Type(const char* M_NONNULL s
         }
 
         // Check that all provided chars are valid for the string type.
-        size_t count = 0;
-        while (*temp != '\0' && count < templen)
+        uint16_t validChars = type == INT_INPUT_HEX ? CHAR_CLASS_XDIGIT : CHAR_CLASS_DIGIT;
+        if (char_class_span(temp, templen, validChars) != templen)
         {
-            if ((type == INT_INPUT_HEX && !safe_isxdigit(*temp)) || (type == INT_INPUT_DECIMAL && !safe_isdigit(*temp)))
-            {
-                type = INT_INPUT_INVALID;
-                break;
-            }
-            ++temp;
-            ++count;
+            type = INT_INPUT_INVALID;
         }
     }
     else
@@ -2771,7 +2762,7 @@ static char* M_NONNULL create_data_line_output(char                     line[M_N
         line[hexLineIter + 2] = ' ';
         if (showPrint)
         {
-            if (safe_isascii(dataBuffer[bufferIter]) && safe_isprint(C_CAST(int, dataBuffer[bufferIter])))
+            if (ascii_isprint(C_CAST(char, dataBuffer[bufferIter])))
             {
                 line[printLineIter] = C_CAST(char, dataBuffer[bufferIter]);
             }
@@ -3315,6 +3306,245 @@ char* M_NULLABLE safe_gets_impl(char* M_NONNULL        str,
     }
 }
 
+// Locale independent integer parsing used by the safe_strto* integer conversions.
+// These accept the same input as strtol and friends do in the "C" locale: leading whitespace, an optional sign, an
+// optional 0x/0X prefix for base 16 or base 0, then digits. Digits are found with a lookup table that works for any
+// base up to 36. Decimal numbers are converted 8 digits at a time with SWAR (SIMD within a register) arithmetic.
+
+// Value of each character as a digit in bases up to 36. Characters that are not digits in any base are 0xFF.
+static const uint8_t integer_digit_value_table[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+    0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+    0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+#define DECIMAL_SWAR_DIGITS SIZE_T_C(8)
+
+typedef struct sparsedInteger
+{
+    uintmax_t magnitude; /*!< absolute value, clamped to the limit for the sign when overflow is set */
+    size_t    consumed;  /*!< characters used, zero if no digits were found */
+    bool      negative;
+    bool      overflow;
+} parsedInteger;
+
+// Converts 8 ASCII decimal digits to their value with three multiplies instead of eight.
+static M_INLINE uint32_t decimal_swar_8_digits(const char* M_NONNULL digits)
+{
+    const uint8_t* bytes = M_REINTERPRET_CAST(const uint8_t*, digits);
+    // Assembled in little endian order on every platform so the first digit is in the low byte
+    uint64_t chunk = M_STATIC_CAST(uint64_t, bytes[0]) | (M_STATIC_CAST(uint64_t, bytes[1]) << 8) |
+                     (M_STATIC_CAST(uint64_t, bytes[2]) << 16) | (M_STATIC_CAST(uint64_t, bytes[3]) << 24) |
+                     (M_STATIC_CAST(uint64_t, bytes[4]) << 32) | (M_STATIC_CAST(uint64_t, bytes[5]) << 40) |
+                     (M_STATIC_CAST(uint64_t, bytes[6]) << 48) | (M_STATIC_CAST(uint64_t, bytes[7]) << 56);
+    chunk -= UINT64_C(0x3030303030303030);
+    // combine neighboring digits into 2 digit values, then 2 digit values into 4 digit values, then into 8 digits
+    chunk = (chunk * UINT64_C(10)) + (chunk >> 8);
+    chunk = (((chunk & UINT64_C(0x000000FF000000FF)) * (UINT64_C(100) + (UINT64_C(1000000) << 32))) +
+             (((chunk >> 16) & UINT64_C(0x000000FF000000FF)) * (UINT64_C(1) + (UINT64_C(10000) << 32)))) >>
+            32;
+    return M_STATIC_CAST(uint32_t, chunk);
+}
+
+// Converts a run of characters already known to be decimal digits. Returns false if the value is larger than limit.
+static bool decimal_run_value(const char* M_NONNULL digits, size_t count, uintmax_t limit, uintmax_t* M_NONNULL value)
+{
+    uintmax_t result = UINTMAX_C(0);
+    size_t    offset = SIZE_T_C(0);
+    // The digits that do not fill a whole chunk go first so that the rest can be taken 8 at a time
+    for (; offset < count % DECIMAL_SWAR_DIGITS; ++offset)
+    {
+        uintmax_t digit = M_STATIC_CAST(uintmax_t, digits[offset] - '0');
+        if (result > (limit - digit) / UINTMAX_C(10))
+        {
+            return false;
+        }
+        result = result * UINTMAX_C(10) + digit;
+    }
+    for (; offset < count; offset += DECIMAL_SWAR_DIGITS)
+    {
+        uintmax_t chunk = decimal_swar_8_digits(digits + offset);
+        if (chunk > limit || result > (limit - chunk) / UINTMAX_C(100000000))
+        {
+            return false;
+        }
+        result = result * UINTMAX_C(100000000) + chunk;
+    }
+    *value = result;
+    return true;
+}
+
+static M_INLINE bool is_integer_digit(char c, int base)
+{
+    return integer_digit_value_table[M_STATIC_CAST(unsigned char, c)] < M_STATIC_CAST(uint8_t, base);
+}
+
+// Parses at most length characters of text. Parsing stops at the first character that cannot continue the number.
+// length must not run past the end of the buffer: the whitespace and digit spans read 16 bytes at a time and do not
+// stop at a null terminator, so callers with null terminated text bound it with integer_text_extent first.
+static parsedInteger parse_integer_text(const char* M_NONNULL text,
+                                        size_t                length,
+                                        int                   base,
+                                        uintmax_t             positiveLimit,
+                                        uintmax_t             negativeLimit)
+{
+    parsedInteger parsed = {UINTMAX_C(0), SIZE_T_C(0), false, false};
+    size_t        offset = char_class_span(text, length, CHAR_CLASS_SPACE);
+    if (offset < length && (text[offset] == '+' || text[offset] == '-'))
+    {
+        parsed.negative = text[offset] == '-';
+        ++offset;
+    }
+    // A 0x prefix only counts when a hex digit follows it. Otherwise the 0 is the number and parsing ends at the x.
+    if ((base == 0 || base == 16) && length - offset > SIZE_T_C(2) && text[offset] == '0' &&
+        (text[offset + 1] == 'x' || text[offset + 1] == 'X') && is_integer_digit(text[offset + 2], 16))
+    {
+        base = 16;
+        offset += SIZE_T_C(2);
+    }
+    else if (base == 0)
+    {
+        base = (offset < length && text[offset] == '0') ? 8 : 10;
+    }
+    size_t    start = offset;
+    uintmax_t limit = parsed.negative ? negativeLimit : positiveLimit;
+    if (base == 10)
+    {
+        offset += char_class_span(text + offset, length - offset, CHAR_CLASS_DIGIT);
+        parsed.overflow = offset > start && !decimal_run_value(text + start, offset - start, limit, &parsed.magnitude);
+    }
+    else
+    {
+        uintmax_t cutoff = limit / M_STATIC_CAST(uintmax_t, base);
+        uintmax_t cutlim = limit % M_STATIC_CAST(uintmax_t, base);
+        for (; offset < length && is_integer_digit(text[offset], base); ++offset)
+        {
+            uintmax_t digit = integer_digit_value_table[M_STATIC_CAST(unsigned char, text[offset])];
+            if (parsed.overflow || parsed.magnitude > cutoff || (parsed.magnitude == cutoff && digit > cutlim))
+            {
+                // keep consuming digits so the end pointer lands after the whole number like strtol
+                parsed.overflow = true;
+                continue;
+            }
+            parsed.magnitude = parsed.magnitude * M_STATIC_CAST(uintmax_t, base) + digit;
+        }
+    }
+    if (offset == start)
+    {
+        parsed.negative = false;
+        return parsed;
+    }
+    if (parsed.overflow)
+    {
+        parsed.magnitude = limit;
+    }
+    parsed.consumed = offset;
+    return parsed;
+}
+
+// Length of the part of a null terminated string that parse_integer_text could consume: leading whitespace, a sign,
+// and the run of letters and digits after it, which covers every base up to 36 and the x of a 0x prefix. This walks
+// one byte at a time and stops at the null terminator, so it never reads past the string and only looks at the number
+// at the front rather than the whole remaining text.
+static size_t integer_text_extent(const char* M_NONNULL str)
+{
+    size_t extent = SIZE_T_C(0);
+    while (char_class_is(str[extent], CHAR_CLASS_SPACE))
+    {
+        ++extent;
+    }
+    if (str[extent] == '+' || str[extent] == '-')
+    {
+        ++extent;
+    }
+    while (char_class_is(str[extent], CHAR_CLASS_ALNUM))
+    {
+        ++extent;
+    }
+    return extent;
+}
+
+// strtol rejects these bases by returning 0 with errno set to EINVAL
+static M_INLINE bool is_valid_integer_base(int base)
+{
+    return base == 0 || (base >= 2 && base <= BASE_36_MAX);
+}
+
+static errno_t parse_signed_integer(const char* M_NONNULL                   str,
+                                    char* M_NULLABLE* M_RESTRICT M_NULLABLE endp,
+                                    int                                     base,
+                                    intmax_t                                minimum,
+                                    intmax_t                                maximum,
+                                    intmax_t* M_NONNULL                     value)
+{
+    parsedInteger parsed = {UINTMAX_C(0), SIZE_T_C(0), false, false};
+    errno_t       error  = EINVAL;
+    if (is_valid_integer_base(base))
+    {
+        // Bound the length to the number at the front of str. The vector spans in parse_integer_text need an in bounds
+        // length, and measuring the whole string would make parsing field by field through endp quadratic.
+        // The magnitude of the minimum is one more than the maximum in two's complement.
+        parsed = parse_integer_text(str, integer_text_extent(str), base, M_STATIC_CAST(uintmax_t, maximum),
+                                    M_STATIC_CAST(uintmax_t, -(minimum + 1)) + UINTMAX_C(1));
+        error  = parsed.consumed == SIZE_T_C(0) ? EINVAL : (parsed.overflow ? ERANGE : 0);
+    }
+    if (endp != M_NULLPTR)
+    {
+        *endp = M_CONST_CAST(char*, str + parsed.consumed);
+    }
+    if (!parsed.negative)
+    {
+        *value = M_STATIC_CAST(intmax_t, parsed.magnitude);
+    }
+    else if (parsed.magnitude > M_STATIC_CAST(uintmax_t, INTMAX_MAX))
+    {
+        *value = INTMAX_MIN;
+    }
+    else
+    {
+        *value = -M_STATIC_CAST(intmax_t, parsed.magnitude);
+    }
+    return error;
+}
+
+static errno_t parse_unsigned_integer(const char* M_NONNULL                   str,
+                                      char* M_NULLABLE* M_RESTRICT M_NULLABLE endp,
+                                      int                                     base,
+                                      uintmax_t                               maximum,
+                                      uintmax_t* M_NONNULL                    value)
+{
+    parsedInteger parsed = {UINTMAX_C(0), SIZE_T_C(0), false, false};
+    errno_t       error  = EINVAL;
+    if (is_valid_integer_base(base))
+    {
+        // Bound the length to the number at the front of str. The vector spans in parse_integer_text need an in bounds
+        // length, and measuring the whole string would make parsing field by field through endp quadratic.
+        // Like strtoul, a minus sign negates the value in unsigned arithmetic after the range check.
+        parsed = parse_integer_text(str, integer_text_extent(str), base, maximum, maximum);
+        error  = parsed.consumed == SIZE_T_C(0) ? EINVAL : (parsed.overflow ? ERANGE : 0);
+    }
+    if (endp != M_NULLPTR)
+    {
+        *endp = M_CONST_CAST(char*, str + parsed.consumed);
+    }
+    *value = (parsed.negative && !parsed.overflow) ? (maximum - parsed.magnitude + UINTMAX_C(1)) & maximum
+                                                   : parsed.magnitude;
+    return error;
+}
+
 M_PARAM_RW(1)
 M_PARAM_RO(2)
 M_NULL_TERM_STRING(2)
@@ -3350,26 +3580,9 @@ errno_t safe_strtol_impl(long* M_NONNULL                         value,
     }
     else
     {
-        // We need the end pointer to detect errors in conversion reliably.
-        // since that is an optional parameter, we have a local one to use if the user
-        // does not provide one
-        char*  localend = M_NULLPTR;
-        char** useend   = endp;
-        if (useend == M_NULLPTR)
-        {
-            useend = &localend;
-        }
-        errno  = 0; // must clear to zero before calling strtol to properly detect errors
-        *value = strtol(str, useend, base);
-        if (((*value == LONG_MAX || *value == LONG_MIN) && errno == ERANGE) || (*value == 0L && *useend == str) ||
-            errno != 0)
-        {
-            error = errno;
-            if (error == 0)
-            {
-                error = EINVAL;
-            }
-        }
+        intmax_t parsed = INTMAX_C(0);
+        error           = parse_signed_integer(str, endp, base, LONG_MIN, LONG_MAX, &parsed);
+        *value          = M_STATIC_CAST(long, parsed);
     }
     errno = error;
     return error;
@@ -3410,26 +3623,9 @@ errno_t safe_strtoll_impl(long long* M_NONNULL                    value,
     }
     else
     {
-        // We need the end pointer to detect errors in conversion reliably.
-        // since that is an optional parameter, we have a local one to use if the user
-        // does not provide one
-        char*  localend = M_NULLPTR;
-        char** useend   = endp;
-        if (useend == M_NULLPTR)
-        {
-            useend = &localend;
-        }
-        errno  = 0; // must clear to zero before calling strtol to properly detect errors
-        *value = strtoll(str, useend, base);
-        if (((*value == LLONG_MAX || *value == LLONG_MIN) && errno == ERANGE) || (*value == 0LL && *useend == str) ||
-            errno != 0)
-        {
-            error = errno;
-            if (error == 0)
-            {
-                error = EINVAL;
-            }
-        }
+        intmax_t parsed = INTMAX_C(0);
+        error           = parse_signed_integer(str, endp, base, LLONG_MIN, LLONG_MAX, &parsed);
+        *value          = M_STATIC_CAST(long long, parsed);
     }
     errno = error;
     return error;
@@ -3470,25 +3666,9 @@ errno_t safe_strtoul_impl(unsigned long* M_NONNULL                value,
     }
     else
     {
-        // We need the end pointer to detect errors in conversion reliably.
-        // since that is an optional parameter, we have a local one to use if the user
-        // does not provide one
-        char*  localend = M_NULLPTR;
-        char** useend   = endp;
-        if (useend == M_NULLPTR)
-        {
-            useend = &localend;
-        }
-        errno  = 0; // must clear to zero before calling strtol to properly detect errors
-        *value = strtoul(str, useend, base);
-        if ((*value == ULONG_MAX && errno == ERANGE) || (*value == 0UL && *useend == str) || errno != 0)
-        {
-            error = errno;
-            if (error == 0)
-            {
-                error = EINVAL;
-            }
-        }
+        uintmax_t parsed = UINTMAX_C(0);
+        error            = parse_unsigned_integer(str, endp, base, ULONG_MAX, &parsed);
+        *value           = M_STATIC_CAST(unsigned long, parsed);
     }
     errno = error;
     return error;
@@ -3529,25 +3709,9 @@ errno_t safe_strtoull_impl(unsigned long long* M_NONNULL           value,
     }
     else
     {
-        // We need the end pointer to detect errors in conversion reliably.
-        // since that is an optional parameter, we have a local one to use if the user
-        // does not provide one
-        char*  localend = M_NULLPTR;
-        char** useend   = endp;
-        if (useend == M_NULLPTR)
-        {
-            useend = &localend;
-        }
-        errno  = 0; // must clear to zero before calling strtol to properly detect errors
-        *value = strtoull(str, useend, base);
-        if ((*value == ULLONG_MAX && errno == ERANGE) || (*value == 0ULL && *useend == str) || errno != 0)
-        {
-            error = errno;
-            if (error == 0)
-            {
-                error = EINVAL;
-            }
-        }
+        uintmax_t parsed = UINTMAX_C(0);
+        error            = parse_unsigned_integer(str, endp, base, ULLONG_MAX, &parsed);
+        *value           = M_STATIC_CAST(unsigned long long, parsed);
     }
     errno = error;
     return error;
@@ -3588,26 +3752,9 @@ errno_t safe_strtoimax_impl(intmax_t* M_NONNULL                     value,
     }
     else
     {
-        // We need the end pointer to detect errors in conversion reliably.
-        // since that is an optional parameter, we have a local one to use if the user
-        // does not provide one
-        char*  localend = M_NULLPTR;
-        char** useend   = endp;
-        if (useend == M_NULLPTR)
-        {
-            useend = &localend;
-        }
-        errno  = 0; // must clear to zero before calling strtol to properly detect errors
-        *value = strtoimax(str, useend, base);
-        if (((*value == INTMAX_MAX || *value == INTMAX_MIN) && errno == ERANGE) ||
-            (*value == INTMAX_C(0) && *useend == str) || errno != 0)
-        {
-            error = errno;
-            if (error == 0)
-            {
-                error = EINVAL;
-            }
-        }
+        intmax_t parsed = INTMAX_C(0);
+        error           = parse_signed_integer(str, endp, base, INTMAX_MIN, INTMAX_MAX, &parsed);
+        *value          = M_STATIC_CAST(intmax_t, parsed);
     }
     errno = error;
     return error;
@@ -3648,25 +3795,9 @@ errno_t safe_strtoumax_impl(uintmax_t* M_NONNULL                    value,
     }
     else
     {
-        // We need the end pointer to detect errors in conversion reliably.
-        // since that is an optional parameter, we have a local one to use if the user
-        // does not provide one
-        char*  localend = M_NULLPTR;
-        char** useend   = endp;
-        if (useend == M_NULLPTR)
-        {
-            useend = &localend;
-        }
-        errno  = 0; // must clear to zero before calling strtol to properly detect errors
-        *value = strtoumax(str, useend, base);
-        if ((*value == UINTMAX_MAX && errno == ERANGE) || (*value == UINTMAX_C(0) && *useend == str) || errno != 0)
-        {
-            error = errno;
-            if (error == 0)
-            {
-                error = EINVAL;
-            }
-        }
+        uintmax_t parsed = UINTMAX_C(0);
+        error            = parse_unsigned_integer(str, endp, base, UINTMAX_MAX, &parsed);
+        *value           = M_STATIC_CAST(uintmax_t, parsed);
     }
     errno = error;
     return error;
@@ -3949,6 +4080,136 @@ errno_t safe_atof_impl(double* M_NONNULL                value,
     return error;
 }
 
+// Shared by the integer list parsers. Exactly one of unsignedValues and signedValues is used.
+static errno_t parse_integer_list(const char* M_NONNULL buffer,
+                                  size_t                length,
+                                  const char* M_NONNULL delimiters,
+                                  int                   base,
+                                  uint64_t* M_NULLABLE  unsignedValues,
+                                  int64_t* M_NULLABLE   signedValues,
+                                  size_t                capacity,
+                                  size_t* M_NONNULL     count,
+                                  size_t* M_NULLABLE    consumed)
+{
+    bool isDelimiter[256] = {false};
+    for (; *delimiters != '\0'; ++delimiters)
+    {
+        isDelimiter[M_STATIC_CAST(unsigned char, *delimiters)] = true;
+    }
+    // signed values allow one more in magnitude below zero than above it
+    uintmax_t positiveLimit = signedValues != M_NULLPTR ? M_STATIC_CAST(uintmax_t, INT64_MAX) : UINT64_MAX;
+    uintmax_t negativeLimit = signedValues != M_NULLPTR ? positiveLimit + UINTMAX_C(1) : UINT64_MAX;
+    errno_t   error         = is_valid_integer_base(base) ? 0 : EINVAL;
+    size_t    offset        = SIZE_T_C(0);
+    *count                  = SIZE_T_C(0);
+    while (error == 0 && *count < capacity)
+    {
+        offset += char_class_span(buffer + offset, length - offset, CHAR_CLASS_SPACE);
+        if (offset == length || buffer[offset] == '\0')
+        {
+            break;
+        }
+        parsedInteger parsed = parse_integer_text(buffer + offset, length - offset, base, positiveLimit, negativeLimit);
+        size_t        next   = offset + parsed.consumed;
+        if (parsed.consumed == SIZE_T_C(0) ||
+            (next < length && buffer[next] != '\0' && !ascii_isspace(buffer[next]) &&
+             !isDelimiter[M_STATIC_CAST(unsigned char, buffer[next])]))
+        {
+            error = EINVAL;
+            break;
+        }
+        if (parsed.overflow || (signedValues == M_NULLPTR && parsed.negative && parsed.magnitude != UINTMAX_C(0)))
+        {
+            error = ERANGE;
+            break;
+        }
+        if (signedValues != M_NULLPTR)
+        {
+            signedValues[*count] = parsed.negative && parsed.magnitude > M_STATIC_CAST(uintmax_t, INT64_MAX)
+                                       ? INT64_MIN
+                                       : (parsed.negative ? -M_STATIC_CAST(int64_t, parsed.magnitude)
+                                                          : M_STATIC_CAST(int64_t, parsed.magnitude));
+        }
+        else
+        {
+            unsignedValues[*count] = M_STATIC_CAST(uint64_t, parsed.magnitude);
+        }
+        ++(*count);
+        // Whitespace and at most one delimiter may separate values. A second delimiter is an empty field, which
+        // fails to parse on the next pass.
+        offset            = next;
+        bool sawDelimiter = false;
+        for (; offset < length && buffer[offset] != '\0'; ++offset)
+        {
+            bool delimiter = isDelimiter[M_STATIC_CAST(unsigned char, buffer[offset])];
+            if (!ascii_isspace(buffer[offset]) && (!delimiter || sawDelimiter))
+            {
+                break;
+            }
+            sawDelimiter = sawDelimiter || (delimiter && !ascii_isspace(buffer[offset]));
+        }
+    }
+    if (consumed != M_NULLPTR)
+    {
+        *consumed = offset;
+    }
+    return error;
+}
+
+M_PARAM_RO_SIZE(1, 2)
+M_PARAM_RO(3)
+M_NULL_TERM_STRING(3)
+M_PARAM_WO_SIZE(5, 6)
+M_PARAM_WO(7)
+M_PARAM_WO(8)
+errno_t parse_Integer_List_uint64(const char* M_NONNULL buffer,
+                                  size_t                length,
+                                  const char* M_NONNULL delimiters,
+                                  int                   base,
+                                  uint64_t* M_NONNULL   values,
+                                  size_t                capacity,
+                                  size_t* M_NONNULL     count,
+                                  size_t* M_NULLABLE    consumed)
+{
+    if (count == M_NULLPTR)
+    {
+        return EINVAL;
+    }
+    *count = SIZE_T_C(0);
+    if (buffer == M_NULLPTR || delimiters == M_NULLPTR || values == M_NULLPTR)
+    {
+        return EINVAL;
+    }
+    return parse_integer_list(buffer, length, delimiters, base, values, M_NULLPTR, capacity, count, consumed);
+}
+
+M_PARAM_RO_SIZE(1, 2)
+M_PARAM_RO(3)
+M_NULL_TERM_STRING(3)
+M_PARAM_WO_SIZE(5, 6)
+M_PARAM_WO(7)
+M_PARAM_WO(8)
+errno_t parse_Integer_List_int64(const char* M_NONNULL buffer,
+                                 size_t                length,
+                                 const char* M_NONNULL delimiters,
+                                 int                   base,
+                                 int64_t* M_NONNULL    values,
+                                 size_t                capacity,
+                                 size_t* M_NONNULL     count,
+                                 size_t* M_NULLABLE    consumed)
+{
+    if (count == M_NULLPTR)
+    {
+        return EINVAL;
+    }
+    *count = SIZE_T_C(0);
+    if (buffer == M_NULLPTR || delimiters == M_NULLPTR || values == M_NULLPTR)
+    {
+        return EINVAL;
+    }
+    return parse_integer_list(buffer, length, delimiters, base, M_NULLPTR, values, capacity, count, consumed);
+}
+
 M_NONNULL_IF_NONZERO_PARAM(5, 6)
 M_NULL_TERM_STRING(7)
 M_PARAM_WO_SIZE(5, 6)
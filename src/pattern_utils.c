@@ -12,6 +12,7 @@
 //! If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include "pattern_utils.h"
+#include "bit_manip.h"
 #include "math_utils.h"
 #include "memory_safety.h"
 #include "prng.h"
@@ -21,84 +22,164 @@
 #include <stdlib.h>
 #include <string.h>
 
-M_PARAM_WO_SIZE(1, 2)
-eReturnValues fill_Random_Pattern_In_Buffer(uint8_t* M_NONNULL ptrData, uint32_t dataLength)
+// Random patterns are generated 8 bytes at a time from prng_Counter_64. Word N of the stream covers stream bytes
+// N * 8 through N * 8 + 7.
+#define RANDOM_PATTERN_WORD_SIZE SIZE_T_C(8)
+
+// Random patterns and LBA stamps are stored least significant byte first so they are identical on every platform.
+static M_INLINE void store_little_endian_64(uint8_t* M_NONNULL dest, uint64_t value)
+{
+#if defined(ENV_BIG_ENDIAN)
+    byte_Swap_64(&value);
+#endif
+    memcpy(dest, &value, sizeof(value));
+}
+
+static M_INLINE uint64_t load_little_endian_64(const uint8_t* M_NONNULL source)
+{
+    uint64_t value = UINT64_C(0);
+    memcpy(&value, source, sizeof(value));
+#if defined(ENV_BIG_ENDIAN)
+    byte_Swap_64(&value);
+#endif
+    return value;
+}
+
+M_PARAM_WO_SIZE(3, 4)
+eReturnValues fill_Random_Pattern_At_Offset(uint64_t           seed,
+                                            uint64_t           streamOffset,
+                                            uint8_t* M_NONNULL ptrData,
+                                            size_t             dataLength)
     // clang-format off
     M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
 // clang-format on
 {
-    if (dataLength == UINT32_C(0))
+    if (ptrData == M_NULLPTR || dataLength == SIZE_T_C(0))
     {
         return M_ACCESS_ENUM(eReturnValues, BAD_PARAMETER);
     }
-    size_t localPtrDataLen =
-        ((dataLength + sizeof(uint32_t)) - 1) / sizeof(uint32_t); // round up to nearest uint32 amount
-    uint32_t* localPtr = M_REINTERPRET_CAST(uint32_t*, safe_calloc(localPtrDataLen, sizeof(uint32_t)));
-    if (localPtr == M_NULLPTR)
+    uint64_t key       = prng_Counter_Key(seed);
+    uint64_t counter   = streamOffset / RANDOM_PATTERN_WORD_SIZE;
+    size_t   wordStart = M_STATIC_CAST(size_t, streamOffset % RANDOM_PATTERN_WORD_SIZE);
+    size_t   offset    = SIZE_T_C(0);
+    if (wordStart != SIZE_T_C(0))
     {
-        return M_ACCESS_ENUM(eReturnValues, MEMORY_FAILURE);
+        // stream offset is in the middle of a word, so only its last bytes belong to this buffer
+        uint8_t word[RANDOM_PATTERN_WORD_SIZE];
+        store_little_endian_64(word, prng_Counter_64(key, counter));
+        offset = M_Min(RANDOM_PATTERN_WORD_SIZE - wordStart, dataLength);
+        memcpy(ptrData, &word[wordStart], offset);
+        ++counter;
     }
-    seed_32(C_CAST(uint32_t, time(M_NULLPTR)));
-    for (uint32_t iter = UINT32_C(0); iter < (dataLength / sizeof(uint32_t)); ++iter)
+    // Words do not depend on each other, so generating four per pass keeps several multiplies in flight and lets the
+    // compiler vectorize the loop on targets that have 64bit vector multiplies.
+    for (; dataLength - offset >= RANDOM_PATTERN_WORD_SIZE * SIZE_T_C(4);
+         offset += RANDOM_PATTERN_WORD_SIZE * SIZE_T_C(4), counter += UINT64_C(4))
     {
-        localPtr[iter] = xorshiftplus32();
+        store_little_endian_64(&ptrData[offset], prng_Counter_64(key, counter));
+        store_little_endian_64(&ptrData[offset + RANDOM_PATTERN_WORD_SIZE], prng_Counter_64(key, counter + 1));
+        store_little_endian_64(&ptrData[offset + RANDOM_PATTERN_WORD_SIZE * 2], prng_Counter_64(key, counter + 2));
+        store_little_endian_64(&ptrData[offset + RANDOM_PATTERN_WORD_SIZE * 3], prng_Counter_64(key, counter + 3));
     }
-    if (0 != safe_memcpy(ptrData, dataLength, localPtr,
-                         dataLength)) // copy only the length of the original pointer since we
-                                      // may have overallocated and rounded up earlier.
+    for (; dataLength - offset >= RANDOM_PATTERN_WORD_SIZE; offset += RANDOM_PATTERN_WORD_SIZE, ++counter)
     {
-        safe_free(&localPtr);
-        return M_ACCESS_ENUM(eReturnValues, MEMORY_FAILURE);
+        store_little_endian_64(&ptrData[offset], prng_Counter_64(key, counter));
+    }
+    if (offset < dataLength)
+    {
+        // partial word at the end of the buffer
+        uint8_t word[RANDOM_PATTERN_WORD_SIZE];
+        store_little_endian_64(word, prng_Counter_64(key, counter));
+        memcpy(&ptrData[offset], word, dataLength - offset);
     }
-    safe_free(&localPtr);
     return M_ACCESS_ENUM(eReturnValues, SUCCESS);
 }
 
-M_PARAM_WO_SIZE(2, 3)
-eReturnValues fill_Hex_Pattern_In_Buffer(uint32_t hexPattern, uint8_t* M_NONNULL ptrData, uint32_t dataLength)
+M_PARAM_WO_SIZE(1, 2)
+eReturnValues fill_Random_Pattern_In_Buffer(uint8_t* M_NONNULL ptrData, size_t dataLength)
     // clang-format off
     M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
 // clang-format on
 {
-    if (dataLength == UINT32_C(0))
+    if (dataLength == SIZE_T_C(0))
     {
         return M_ACCESS_ENUM(eReturnValues, BAD_PARAMETER);
     }
-    size_t localPtrDataLen =
-        ((dataLength + sizeof(uint32_t)) - 1) / sizeof(uint32_t); // round up to nearest uint32 amount
-    uint32_t* localPtr = M_REINTERPRET_CAST(uint32_t*, safe_calloc(localPtrDataLen, sizeof(uint32_t)));
-    if (localPtr == M_NULLPTR)
+    // Each call takes a new seed from the calling thread's stream so buffers filled in the same second still differ.
+    return fill_Random_Pattern_At_Offset(prng_State_Next_64(get_Thread_PRNG_State()), UINT64_C(0), ptrData,
+                                         dataLength);
+}
+
+// Once this much of the destination holds the pattern, the same leading block is copied over and over instead of
+// continuing to double, so the copy source stays in cache.
+#define PATTERN_COPY_BLOCK_SIZE (SIZE_T_C(32) * SIZE_T_C(1024))
+
+// Writes pattern[(phase + iter) % patternLength] to every byte of dest so that a pattern can be continued from the
+// middle, as it is when a chunk starts partway through a repetition.
+// Only the first repetition is read from pattern. After that the filled start of dest is copied onto the rest of it,
+// doubling the copy size each time, so a short pattern needs a handful of large copies rather than one per repetition.
+static void repeat_pattern_from_phase(uint8_t* M_NONNULL       dest,
+                                      size_t                   destLength,
+                                      const uint8_t* M_NONNULL pattern,
+                                      size_t                   patternLength,
+                                      size_t                   phase)
+{
+    if (patternLength == SIZE_T_C(1))
+    {
+        memset(dest, pattern[0], destLength);
+        return;
+    }
+    size_t filled = M_Min(patternLength - phase, destLength);
+    memcpy(dest, &pattern[phase], filled);
+    if (filled < destLength && phase > SIZE_T_C(0))
     {
-        return M_ACCESS_ENUM(eReturnValues, MEMORY_FAILURE);
+        size_t wrapped = M_Min(phase, destLength - filled);
+        memcpy(&dest[filled], pattern, wrapped);
+        filled += wrapped;
     }
-    for (uint32_t iter = UINT32_C(0); iter < (dataLength / sizeof(uint32_t)); ++iter)
+    // dest now starts with a whole number of repetitions, so any leading block of that size repeats correctly
+    size_t block = filled;
+    while (filled < destLength)
     {
-        localPtr[iter] = hexPattern;
+        size_t copy = M_Min(block, destLength - filled);
+        memcpy(&dest[filled], dest, copy);
+        filled += copy;
+        if (block < PATTERN_COPY_BLOCK_SIZE)
+        {
+            block = filled;
+        }
     }
-    if (0 != safe_memcpy(ptrData, dataLength, localPtr,
-                         dataLength)) // copy only the length of the original pointer since we
-                                      // may have overallocated and rounded up earlier.
+}
+
+M_PARAM_WO_SIZE(2, 3)
+eReturnValues fill_Hex_Pattern_In_Buffer(uint32_t hexPattern, uint8_t* M_NONNULL ptrData, size_t dataLength)
+    // clang-format off
+    M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
+// clang-format on
+{
+    if (ptrData == M_NULLPTR || dataLength == SIZE_T_C(0))
     {
-        safe_free(&localPtr);
-        return M_ACCESS_ENUM(eReturnValues, MEMORY_FAILURE);
+        return M_ACCESS_ENUM(eReturnValues, BAD_PARAMETER);
     }
-    safe_free(&localPtr);
+    uint8_t hexBytes[sizeof(uint32_t)];
+    memcpy(hexBytes, &hexPattern, sizeof(hexBytes));
+    repeat_pattern_from_phase(ptrData, dataLength, hexBytes, sizeof(hexBytes), SIZE_T_C(0));
     return M_ACCESS_ENUM(eReturnValues, SUCCESS);
 }
 
 M_PARAM_WO_SIZE(2, 3)
 eReturnValues fill_Incrementing_Pattern_In_Buffer(uint8_t            incrementStartValue,
                                                   uint8_t* M_NONNULL ptrData,
-                                                  uint32_t           dataLength)
+                                                  size_t             dataLength)
     // clang-format off
     M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
 // clang-format on
 {
-    if (ptrData == M_NULLPTR || dataLength == UINT32_C(0))
+    if (ptrData == M_NULLPTR || dataLength == SIZE_T_C(0))
     {
         return M_ACCESS_ENUM(eReturnValues, BAD_PARAMETER);
     }
-    for (uint32_t iter = UINT32_C(0); iter < dataLength; ++iter)
+    for (size_t iter = SIZE_T_C(0); iter < dataLength; ++iter)
     {
         ptrData[iter] = incrementStartValue++;
     }
@@ -108,33 +189,28 @@ eReturnValues fill_Incrementing_Pattern_In_Buffer(uint8_t            incrementSt
 M_PARAM_RO_SIZE(1, 2)
 M_PARAM_WO_SIZE(3, 4)
 eReturnValues fill_ASCII_Pattern_In_Buffer(const char* M_NONNULL asciiPattern,
-                                           uint32_t              patternLength,
+                                           size_t                patternLength,
                                            uint8_t* M_NONNULL    ptrData,
-                                           uint32_t              dataLength)
+                                           size_t                dataLength)
     // clang-format off
     M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
 // clang-format on
 {
-    if (ptrData == M_NULLPTR || patternLength == 0 || asciiPattern == M_NULLPTR || dataLength == UINT32_C(0))
+    if (ptrData == M_NULLPTR || patternLength == 0 || asciiPattern == M_NULLPTR || dataLength == SIZE_T_C(0))
     {
         return M_ACCESS_ENUM(eReturnValues, BAD_PARAMETER);
     }
-    for (uint32_t iter = UINT32_C(0); iter < dataLength; iter += patternLength)
-    {
-        if (0 != safe_memcpy(&ptrData[iter], dataLength - iter, asciiPattern, M_Min(patternLength, dataLength - iter)))
-        {
-            return M_ACCESS_ENUM(eReturnValues, MEMORY_FAILURE);
-        }
-    }
+    repeat_pattern_from_phase(ptrData, dataLength, M_REINTERPRET_CAST(const uint8_t*, asciiPattern), patternLength,
+                              SIZE_T_C(0));
     return M_ACCESS_ENUM(eReturnValues, SUCCESS);
 }
 
 M_PARAM_RO_SIZE(1, 2)
 M_PARAM_WO_SIZE(3, 4)
 eReturnValues fill_Pattern_Buffer_Into_Another_Buffer(uint8_t* M_NONNULL inPattern,
-                                                      uint32_t           inpatternLength,
+                                                      size_t             inpatternLength,
                                                       uint8_t* M_NONNULL ptrData,
-                                                      uint32_t           dataLength)
+                                                      size_t             dataLength)
     // clang-format off
     M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
     M_DIAG_ERROR(inpatternLength == 0, "inpatternLength must be non-zero")
@@ -144,12 +220,642 @@ eReturnValues fill_Pattern_Buffer_Into_Another_Buffer(uint8_t* M_NONNULL inPatte
     {
         return M_ACCESS_ENUM(eReturnValues, BAD_PARAMETER);
     }
-    for (uint32_t iter = UINT32_C(0); iter < dataLength; iter += inpatternLength)
+    repeat_pattern_from_phase(ptrData, dataLength, inPattern, inpatternLength, SIZE_T_C(0));
+    return M_ACCESS_ENUM(eReturnValues, SUCCESS);
+}
+
+static bool is_valid_pattern_fill(const patternFill* fill)
+{
+    if (fill == M_NULLPTR)
+    {
+        return false;
+    }
+    if ((fill->type == PATTERN_TYPE_ASCII || fill->type == PATTERN_TYPE_BUFFER) &&
+        (fill->pattern == M_NULLPTR || fill->patternLength == SIZE_T_C(0)))
     {
-        if (0 != safe_memcpy(&ptrData[iter], dataLength - iter, inPattern, M_Min(inpatternLength, dataLength - iter)))
+        return false;
+    }
+    if (fill->type == PATTERN_TYPE_DATA_REDUCTION &&
+        (fill->blockSize == SIZE_T_C(0) || fill->compressPercent > UINT8_C(100) || fill->dedupPercent > UINT8_C(100)))
+    {
+        return false;
+    }
+    return true;
+}
+
+// Generates PATTERN_TYPE_DATA_REDUCTION data. One random draw per block decides whether it is unique or which pool
+// entry it repeats, and that choice gives the seed for the block's random bytes. The rest of the block repeats one
+// byte so it compresses away.
+static eReturnValues generate_data_reduction_pattern(const patternFill* M_NONNULL fill,
+                                                     uint64_t                     offset,
+                                                     uint8_t* M_NONNULL           dest,
+                                                     size_t                       length)
+{
+    uint64_t choiceKey    = prng_Counter_Key(fill->seed);
+    uint64_t contentKey   = prng_Counter_Key(~fill->seed);
+    uint64_t blockSize    = M_STATIC_CAST(uint64_t, fill->blockSize);
+    uint64_t randomLength = blockSize - ((blockSize * fill->compressPercent) / UINT64_C(100));
+    uint64_t position     = fill->streamOffset + offset;
+    size_t   written      = SIZE_T_C(0);
+    while (written < length)
+    {
+        uint64_t block   = position / blockSize;
+        uint64_t inBlock = position % blockSize;
+        size_t   count   = M_STATIC_CAST(size_t, M_Min(blockSize - inBlock, M_STATIC_CAST(uint64_t, length - written)));
+        uint64_t choice  = prng_Counter_64(choiceKey, block);
+        // unique blocks use even content numbers and pool entries odd ones so the two never share data
+        uint64_t content = block << 1;
+        if ((choice % UINT64_C(100)) < fill->dedupPercent)
+        {
+            content = (((choice >> 32) % PATTERN_DEDUP_POOL_SIZE) << 1) | UINT64_C(1);
+        }
+        uint64_t contentSeed = prng_Counter_64(contentKey, content);
+        size_t   randomCount = SIZE_T_C(0);
+        if (inBlock < randomLength)
+        {
+            randomCount = M_STATIC_CAST(size_t, M_Min(randomLength - inBlock, M_STATIC_CAST(uint64_t, count)));
+            eReturnValues ret = fill_Random_Pattern_At_Offset(contentSeed, inBlock, &dest[written], randomCount);
+            if (ret != M_ACCESS_ENUM(eReturnValues, SUCCESS))
+            {
+                return ret;
+            }
+        }
+        if (randomCount < count)
         {
-            return M_ACCESS_ENUM(eReturnValues, MEMORY_FAILURE);
+            memset(&dest[written + randomCount], M_STATIC_CAST(int, contentSeed & UINT8_MAX), count - randomCount);
         }
+        written += count;
+        position += count;
     }
     return M_ACCESS_ENUM(eReturnValues, SUCCESS);
 }
+
+// Writes the bytes of the pattern from offset through offset + length - 1 to dest. The pattern must have passed
+// is_valid_pattern_fill.
+static eReturnValues generate_pattern_at_offset(const patternFill* M_NONNULL fill,
+                                                uint64_t                     offset,
+                                                uint8_t* M_NONNULL           dest,
+                                                size_t                       length)
+{
+    uint8_t hexBytes[sizeof(uint32_t)];
+    switch (fill->type)
+    {
+    case PATTERN_TYPE_HEX:
+        memcpy(hexBytes, &fill->hexPattern, sizeof(hexBytes));
+        repeat_pattern_from_phase(dest, length, hexBytes, sizeof(hexBytes),
+                                  M_STATIC_CAST(size_t, offset % sizeof(hexBytes)));
+        break;
+    case PATTERN_TYPE_INCREMENTING:
+        for (size_t iter = SIZE_T_C(0); iter < length; ++iter)
+        {
+            dest[iter] = M_STATIC_CAST(uint8_t, fill->incrementStartValue + ((offset + iter) & UINT8_MAX));
+        }
+        break;
+    case PATTERN_TYPE_ASCII:
+    case PATTERN_TYPE_BUFFER:
+        repeat_pattern_from_phase(dest, length, fill->pattern, fill->patternLength,
+                                  M_STATIC_CAST(size_t, offset % fill->patternLength));
+        break;
+    case PATTERN_TYPE_RANDOM:
+        return fill_Random_Pattern_At_Offset(fill->seed, fill->streamOffset + offset, dest, length);
+    case PATTERN_TYPE_DATA_REDUCTION:
+        return generate_data_reduction_pattern(fill, offset, dest, length);
+    default:
+        return M_ACCESS_ENUM(eReturnValues, BAD_PARAMETER);
+    }
+    return M_ACCESS_ENUM(eReturnValues, SUCCESS);
+}
+
+// Splits dataLength bytes into chunkCount chunks made of whole units (the last unit may be partial), spreading the
+// remainder over the first chunks so none of them is left empty when there are at least as many units as chunks.
+static void get_chunk_byte_range(size_t            dataLength,
+                                 size_t            unitSize,
+                                 uint32_t          chunkCount,
+                                 uint32_t          chunkIndex,
+                                 size_t* M_NONNULL offset,
+                                 size_t* M_NONNULL length)
+{
+    size_t units      = (dataLength / unitSize) + ((dataLength % unitSize) != SIZE_T_C(0) ? SIZE_T_C(1) : SIZE_T_C(0));
+    size_t perChunk   = units / chunkCount;
+    size_t extraUnits = units % chunkCount;
+    size_t firstUnit  = (perChunk * chunkIndex) + M_Min(M_STATIC_CAST(size_t, chunkIndex), extraUnits);
+    size_t chunkUnits = perChunk + (chunkIndex < extraUnits ? SIZE_T_C(1) : SIZE_T_C(0));
+    *offset           = firstUnit * unitSize;
+    *length           = SIZE_T_C(0);
+    if (*offset < dataLength)
+    {
+        *length = M_Min(chunkUnits * unitSize, dataLength - *offset);
+    }
+}
+
+uint32_t get_Pattern_Fill_Chunk_Count(size_t dataLength, uint32_t threadCount)
+{
+    size_t chunks = dataLength / PATTERN_FILL_MIN_CHUNK_SIZE;
+    if (chunks > SIZE_T_C(0) && dataLength / get_System_Pagesize() < chunks)
+    {
+        chunks = dataLength / get_System_Pagesize();
+    }
+    if (chunks > M_STATIC_CAST(size_t, threadCount))
+    {
+        chunks = M_STATIC_CAST(size_t, threadCount);
+    }
+    if (chunks == SIZE_T_C(0))
+    {
+        chunks = SIZE_T_C(1);
+    }
+    return M_STATIC_CAST(uint32_t, chunks);
+}
+
+M_PARAM_RO(1)
+M_PARAM_WO_SIZE(2, 3)
+eReturnValues fill_Pattern_Chunk_In_Buffer(const patternFill* M_NONNULL fill,
+                                           uint8_t* M_NONNULL           ptrData,
+                                           size_t                       dataLength,
+                                           uint32_t                     chunkCount,
+                                           uint32_t                     chunkIndex)
+    // clang-format off
+    M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
+    M_DIAG_ERROR(chunkIndex >= chunkCount, "chunkIndex must be less than chunkCount")
+// clang-format on
+{
+    if (!is_valid_pattern_fill(fill) || ptrData == M_NULLPTR || dataLength == SIZE_T_C(0) || chunkIndex >= chunkCount)
+    {
+        return M_ACCESS_ENUM(eReturnValues, BAD_PARAMETER);
+    }
+    size_t offset = SIZE_T_C(0);
+    size_t length = SIZE_T_C(0);
+    get_chunk_byte_range(dataLength, get_System_Pagesize(), chunkCount, chunkIndex, &offset, &length);
+    if (length == SIZE_T_C(0))
+    {
+        return M_ACCESS_ENUM(eReturnValues, SUCCESS);
+    }
+    return generate_pattern_at_offset(fill, offset, &ptrData[offset], length);
+}
+
+M_PARAM_RO(1)
+M_PARAM_WO_SIZE(2, 3)
+eReturnValues fill_Pattern_In_Buffer(const patternFill* M_NONNULL fill, uint8_t* M_NONNULL ptrData, size_t dataLength)
+    // clang-format off
+    M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
+// clang-format on
+{
+    return fill_Pattern_Chunk_In_Buffer(fill, ptrData, dataLength, UINT32_C(1), UINT32_C(0));
+}
+
+// Expected data is generated and compared this many bytes at a time.
+#define PATTERN_VERIFY_BLOCK_SIZE SIZE_T_C(4096)
+
+// SWAR: returns a word with the high bit of each byte set where that byte of value is non-zero.
+static M_INLINE uint64_t nonzero_byte_flags(uint64_t value)
+{
+    const uint64_t lowBits = UINT64_C(0x7F7F7F7F7F7F7F7F);
+    return (((value & lowBits) + lowBits) | value) & ~lowBits;
+}
+
+static void record_mismatch_range(patternVerifyResult* M_NONNULL result, size_t offset)
+{
+    if (result->rangeCount > SIZE_T_C(0))
+    {
+        patternMismatchRange* last = &result->ranges[result->rangeCount - SIZE_T_C(1)];
+        if (last->offset + last->length == offset)
+        {
+            last->length += SIZE_T_C(1);
+            return;
+        }
+    }
+    if (result->rangeCount < result->rangeCapacity)
+    {
+        result->ranges[result->rangeCount].offset = offset;
+        result->ranges[result->rangeCount].length = SIZE_T_C(1);
+        result->rangeCount += SIZE_T_C(1);
+    }
+    else
+    {
+        result->rangesTruncated = true;
+    }
+}
+
+// Compares one block and adds its differences to result. baseOffset is the offset of the block in the whole buffer.
+static void compare_pattern_block(const uint8_t* M_NONNULL       actual,
+                                  const uint8_t* M_NONNULL       expected,
+                                  size_t                         length,
+                                  size_t                         baseOffset,
+                                  patternVerifyResult* M_NONNULL result)
+{
+    size_t offset = SIZE_T_C(0);
+    for (; offset < length; offset += sizeof(uint64_t))
+    {
+        size_t   wordLength = M_Min(sizeof(uint64_t), length - offset);
+        uint64_t actualWord = UINT64_C(0);
+        uint64_t expectWord = UINT64_C(0);
+        memcpy(&actualWord, &actual[offset], wordLength);
+        memcpy(&expectWord, &expected[offset], wordLength);
+        uint64_t difference = actualWord ^ expectWord;
+        if (difference == UINT64_C(0))
+        {
+            continue;
+        }
+        bool trackRanges = result->ranges != M_NULLPTR && !result->rangesTruncated;
+        if (result->mismatchCount == SIZE_T_C(0) || trackRanges)
+        {
+            for (size_t iter = SIZE_T_C(0); iter < wordLength; ++iter)
+            {
+                if (actual[offset + iter] != expected[offset + iter])
+                {
+                    if (result->mismatchCount == SIZE_T_C(0))
+                    {
+                        result->firstMismatch = baseOffset + offset + iter;
+                    }
+                    if (trackRanges)
+                    {
+                        record_mismatch_range(result, baseOffset + offset + iter);
+                    }
+                    result->mismatchCount += SIZE_T_C(1);
+                }
+            }
+        }
+        else
+        {
+            result->mismatchCount += M_STATIC_CAST(size_t, count_ones_ull(nonzero_byte_flags(difference)));
+        }
+    }
+}
+
+M_PARAM_RO(1)
+M_PARAM_RO_SIZE(2, 3)
+eReturnValues verify_Pattern_In_Buffer(const patternFill* M_NONNULL    fill,
+                                       const uint8_t* M_NONNULL        ptrData,
+                                       size_t                          dataLength,
+                                       patternVerifyResult* M_NULLABLE result)
+    // clang-format off
+    M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
+// clang-format on
+{
+    if (!is_valid_pattern_fill(fill) || ptrData == M_NULLPTR || dataLength == SIZE_T_C(0) ||
+        (result != M_NULLPTR && result->ranges == M_NULLPTR && result->rangeCapacity > SIZE_T_C(0)))
+    {
+        return M_ACCESS_ENUM(eReturnValues, BAD_PARAMETER);
+    }
+    if (result != M_NULLPTR)
+    {
+        result->firstMismatch   = dataLength;
+        result->mismatchCount   = SIZE_T_C(0);
+        result->rangeCount      = SIZE_T_C(0);
+        result->rangesTruncated = false;
+    }
+    uint8_t expected[PATTERN_VERIFY_BLOCK_SIZE];
+    for (size_t offset = SIZE_T_C(0); offset < dataLength; offset += PATTERN_VERIFY_BLOCK_SIZE)
+    {
+        size_t        length = M_Min(PATTERN_VERIFY_BLOCK_SIZE, dataLength - offset);
+        eReturnValues ret    = generate_pattern_at_offset(fill, offset, expected, length);
+        if (ret != M_ACCESS_ENUM(eReturnValues, SUCCESS))
+        {
+            return ret;
+        }
+        // memcmp is the platform's vectorized compare, so matching blocks cost no more than a memcmp
+        if (memcmp(&ptrData[offset], expected, length) != 0)
+        {
+            if (result == M_NULLPTR)
+            {
+                return M_ACCESS_ENUM(eReturnValues, VALIDATION_FAILURE);
+            }
+            compare_pattern_block(&ptrData[offset], expected, length, offset, result);
+        }
+    }
+    if (result != M_NULLPTR && result->mismatchCount > SIZE_T_C(0))
+    {
+        return M_ACCESS_ENUM(eReturnValues, VALIDATION_FAILURE);
+    }
+    return M_ACCESS_ENUM(eReturnValues, SUCCESS);
+}
+
+M_PARAM_RO_SIZE(2, 3)
+eReturnValues verify_Hex_Pattern_In_Buffer(uint32_t                        hexPattern,
+                                           const uint8_t* M_NONNULL        ptrData,
+                                           size_t                          dataLength,
+                                           patternVerifyResult* M_NULLABLE result)
+    // clang-format off
+    M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
+// clang-format on
+{
+    patternFill fill;
+    safe_memset(&fill, sizeof(fill), 0, sizeof(fill));
+    fill.type       = PATTERN_TYPE_HEX;
+    fill.hexPattern = hexPattern;
+    return verify_Pattern_In_Buffer(&fill, ptrData, dataLength, result);
+}
+
+M_PARAM_RO_SIZE(2, 3)
+eReturnValues verify_Incrementing_Pattern_In_Buffer(uint8_t                         incrementStartValue,
+                                                    const uint8_t* M_NONNULL        ptrData,
+                                                    size_t                          dataLength,
+                                                    patternVerifyResult* M_NULLABLE result)
+    // clang-format off
+    M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
+// clang-format on
+{
+    patternFill fill;
+    safe_memset(&fill, sizeof(fill), 0, sizeof(fill));
+    fill.type                = PATTERN_TYPE_INCREMENTING;
+    fill.incrementStartValue = incrementStartValue;
+    return verify_Pattern_In_Buffer(&fill, ptrData, dataLength, result);
+}
+
+M_PARAM_RO_SIZE(1, 2)
+M_PARAM_RO_SIZE(3, 4)
+eReturnValues verify_ASCII_Pattern_In_Buffer(const char* M_NONNULL           asciiPattern,
+                                             size_t                          patternLength,
+                                             const uint8_t* M_NONNULL        ptrData,
+                                             size_t                          dataLength,
+                                             patternVerifyResult* M_NULLABLE result)
+    // clang-format off
+    M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
+// clang-format on
+{
+    patternFill fill;
+    safe_memset(&fill, sizeof(fill), 0, sizeof(fill));
+    fill.type          = PATTERN_TYPE_ASCII;
+    fill.pattern       = M_REINTERPRET_CAST(const uint8_t*, asciiPattern);
+    fill.patternLength = patternLength;
+    return verify_Pattern_In_Buffer(&fill, ptrData, dataLength, result);
+}
+
+M_PARAM_RO_SIZE(1, 2)
+M_PARAM_RO_SIZE(3, 4)
+eReturnValues verify_Pattern_Buffer_In_Another_Buffer(const uint8_t* M_NONNULL        inPattern,
+                                                      size_t                          inpatternLength,
+                                                      const uint8_t* M_NONNULL        ptrData,
+                                                      size_t                          dataLength,
+                                                      patternVerifyResult* M_NULLABLE result)
+    // clang-format off
+    M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
+    M_DIAG_ERROR(inpatternLength == 0, "inpatternLength must be non-zero")
+// clang-format on
+{
+    patternFill fill;
+    safe_memset(&fill, sizeof(fill), 0, sizeof(fill));
+    fill.type          = PATTERN_TYPE_BUFFER;
+    fill.pattern       = inPattern;
+    fill.patternLength = inpatternLength;
+    return verify_Pattern_In_Buffer(&fill, ptrData, dataLength, result);
+}
+
+M_PARAM_RO_SIZE(3, 4)
+eReturnValues verify_Random_Pattern_At_Offset(uint64_t                        seed,
+                                              uint64_t                        streamOffset,
+                                              const uint8_t* M_NONNULL        ptrData,
+                                              size_t                          dataLength,
+                                              patternVerifyResult* M_NULLABLE result)
+    // clang-format off
+    M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
+// clang-format on
+{
+    patternFill fill;
+    safe_memset(&fill, sizeof(fill), 0, sizeof(fill));
+    fill.type         = PATTERN_TYPE_RANDOM;
+    fill.seed         = seed;
+    fill.streamOffset = streamOffset;
+    return verify_Pattern_In_Buffer(&fill, ptrData, dataLength, result);
+}
+
+// Checksum over one stamped sector. The rounds are the same as xxHash64 and run on four independent lanes so the main
+// loop vectorizes.
+#define LBA_STAMP_PRIME_1 UINT64_C(0x9E3779B185EBCA87)
+#define LBA_STAMP_PRIME_2 UINT64_C(0xC2B2AE3D27D4EB4F)
+
+static M_INLINE uint64_t lba_stamp_round(uint64_t accumulator, uint64_t word)
+{
+    accumulator += word * LBA_STAMP_PRIME_2;
+    accumulator = M_STATIC_CAST(uint64_t, rotate_left_ull(M_STATIC_CAST(unsigned long long, accumulator), 31U));
+    return accumulator * LBA_STAMP_PRIME_1;
+}
+
+static uint64_t lba_stamp_checksum(const uint8_t* M_NONNULL data, size_t length)
+{
+    uint64_t lanes[4] = {LBA_STAMP_PRIME_1 + LBA_STAMP_PRIME_2, LBA_STAMP_PRIME_2, UINT64_C(0),
+                         UINT64_C(0) - LBA_STAMP_PRIME_1};
+    size_t   offset   = SIZE_T_C(0);
+    for (; length - offset >= SIZE_T_C(32); offset += SIZE_T_C(32))
+    {
+        lanes[0] = lba_stamp_round(lanes[0], load_little_endian_64(&data[offset]));
+        lanes[1] = lba_stamp_round(lanes[1], load_little_endian_64(&data[offset + SIZE_T_C(8)]));
+        lanes[2] = lba_stamp_round(lanes[2], load_little_endian_64(&data[offset + SIZE_T_C(16)]));
+        lanes[3] = lba_stamp_round(lanes[3], load_little_endian_64(&data[offset + SIZE_T_C(24)]));
+    }
+    uint64_t checksum = M_STATIC_CAST(uint64_t, length);
+    for (size_t lane = SIZE_T_C(0); lane < SIZE_T_C(4); ++lane)
+    {
+        checksum = lba_stamp_round(checksum, lanes[lane]);
+    }
+    for (; length - offset >= SIZE_T_C(8); offset += SIZE_T_C(8))
+    {
+        checksum = lba_stamp_round(checksum, load_little_endian_64(&data[offset]));
+    }
+    if (offset < length)
+    {
+        uint8_t word[sizeof(uint64_t)] = {0};
+        memcpy(word, &data[offset], length - offset);
+        checksum = lba_stamp_round(checksum, load_little_endian_64(word));
+    }
+    return prng_Mix_64(checksum);
+}
+
+static bool is_valid_lba_stamp(const lbaStamp* stamp, size_t dataLength)
+{
+    return stamp != M_NULLPTR && is_valid_pattern_fill(&stamp->payload) &&
+           stamp->sectorSize >= LBA_STAMP_HEADER_SIZE + LBA_STAMP_TRAILER_SIZE && dataLength != SIZE_T_C(0) &&
+           dataLength % stamp->sectorSize == SIZE_T_C(0);
+}
+
+static eReturnValues fill_lba_stamped_sector(const lbaStamp* M_NONNULL stamp, uint8_t* M_NONNULL sector, uint64_t lba)
+{
+    size_t        checksumOffset = stamp->sectorSize - LBA_STAMP_TRAILER_SIZE;
+    eReturnValues ret            = generate_pattern_at_offset(&stamp->payload, lba * stamp->sectorSize, sector,
+                                                              checksumOffset);
+    if (ret != M_ACCESS_ENUM(eReturnValues, SUCCESS))
+    {
+        return ret;
+    }
+    store_little_endian_64(sector, (M_STATIC_CAST(uint64_t, stamp->sectorSize) << 32) | LBA_STAMP_MAGIC);
+    store_little_endian_64(&sector[8], lba);
+    store_little_endian_64(&sector[16], stamp->sequence);
+    store_little_endian_64(&sector[24], stamp->timestamp);
+    store_little_endian_64(&sector[checksumOffset], lba_stamp_checksum(sector, checksumOffset));
+    return M_ACCESS_ENUM(eReturnValues, SUCCESS);
+}
+
+// Compares data with the pattern from offset onward, generating the expected bytes a block at a time.
+static bool payload_matches_pattern(const patternFill* M_NONNULL fill,
+                                    uint64_t                     offset,
+                                    const uint8_t* M_NONNULL     data,
+                                    size_t                       length)
+{
+    uint8_t expected[PATTERN_VERIFY_BLOCK_SIZE];
+    for (size_t iter = SIZE_T_C(0); iter < length; iter += PATTERN_VERIFY_BLOCK_SIZE)
+    {
+        size_t blockLength = M_Min(PATTERN_VERIFY_BLOCK_SIZE, length - iter);
+        if (generate_pattern_at_offset(fill, offset + iter, expected, blockLength) !=
+                M_ACCESS_ENUM(eReturnValues, SUCCESS) ||
+            memcmp(&data[iter], expected, blockLength) != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Returns the LBA_STAMP_ERROR_* flags for one sector along with the LBA and sequence found in its header.
+static uint32_t check_lba_stamped_sector(const lbaStamp* M_NONNULL stamp,
+                                         const uint8_t* M_NONNULL  sector,
+                                         uint64_t                  lba,
+                                         uint64_t* M_NONNULL       foundLBA,
+                                         uint64_t* M_NONNULL       foundSequence)
+{
+    uint32_t errors         = UINT32_C(0);
+    size_t   checksumOffset = stamp->sectorSize - LBA_STAMP_TRAILER_SIZE;
+    *foundLBA               = load_little_endian_64(&sector[8]);
+    *foundSequence          = load_little_endian_64(&sector[16]);
+    if (load_little_endian_64(sector) != ((M_STATIC_CAST(uint64_t, stamp->sectorSize) << 32) | LBA_STAMP_MAGIC))
+    {
+        errors |= LBA_STAMP_ERROR_MAGIC;
+    }
+    if (load_little_endian_64(&sector[checksumOffset]) != lba_stamp_checksum(sector, checksumOffset))
+    {
+        errors |= LBA_STAMP_ERROR_CHECKSUM;
+    }
+    if (*foundLBA != lba)
+    {
+        errors |= LBA_STAMP_ERROR_LBA;
+    }
+    if (*foundSequence != stamp->sequence)
+    {
+        errors |= LBA_STAMP_ERROR_SEQUENCE;
+    }
+    if (!payload_matches_pattern(&stamp->payload, (lba * stamp->sectorSize) + LBA_STAMP_HEADER_SIZE,
+                                 &sector[LBA_STAMP_HEADER_SIZE], checksumOffset - LBA_STAMP_HEADER_SIZE))
+    {
+        errors |= LBA_STAMP_ERROR_PAYLOAD;
+    }
+    return errors;
+}
+
+M_PARAM_RO(1)
+M_PARAM_WO_SIZE(2, 3)
+eReturnValues fill_LBA_Stamped_Chunk_In_Buffer(const lbaStamp* M_NONNULL stamp,
+                                               uint8_t* M_NONNULL        ptrData,
+                                               size_t                    dataLength,
+                                               uint32_t                  chunkCount,
+                                               uint32_t                  chunkIndex)
+    // clang-format off
+    M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
+    M_DIAG_ERROR(chunkIndex >= chunkCount, "chunkIndex must be less than chunkCount")
+// clang-format on
+{
+    if (!is_valid_lba_stamp(stamp, dataLength) || ptrData == M_NULLPTR || chunkIndex >= chunkCount)
+    {
+        return M_ACCESS_ENUM(eReturnValues, BAD_PARAMETER);
+    }
+    size_t offset = SIZE_T_C(0);
+    size_t length = SIZE_T_C(0);
+    get_chunk_byte_range(dataLength, stamp->sectorSize, chunkCount, chunkIndex, &offset, &length);
+    uint64_t lba = stamp->startLBA + (offset / stamp->sectorSize);
+    for (size_t sector = offset; sector < offset + length; sector += stamp->sectorSize, ++lba)
+    {
+        eReturnValues ret = fill_lba_stamped_sector(stamp, &ptrData[sector], lba);
+        if (ret != M_ACCESS_ENUM(eReturnValues, SUCCESS))
+        {
+            return ret;
+        }
+    }
+    return M_ACCESS_ENUM(eReturnValues, SUCCESS);
+}
+
+M_PARAM_RO(1)
+M_PARAM_WO_SIZE(2, 3)
+eReturnValues fill_LBA_Stamped_Pattern_In_Buffer(const lbaStamp* M_NONNULL stamp,
+                                                 uint8_t* M_NONNULL        ptrData,
+                                                 size_t                    dataLength)
+    // clang-format off
+    M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
+// clang-format on
+{
+    return fill_LBA_Stamped_Chunk_In_Buffer(stamp, ptrData, dataLength, UINT32_C(1), UINT32_C(0));
+}
+
+M_PARAM_RO(1)
+M_PARAM_RO_SIZE(2, 3)
+eReturnValues verify_LBA_Stamped_Chunk_In_Buffer(const lbaStamp* M_NONNULL        stamp,
+                                                 const uint8_t* M_NONNULL         ptrData,
+                                                 size_t                           dataLength,
+                                                 uint32_t                         chunkCount,
+                                                 uint32_t                         chunkIndex,
+                                                 lbaStampVerifyResult* M_NULLABLE result)
+    // clang-format off
+    M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
+    M_DIAG_ERROR(chunkIndex >= chunkCount, "chunkIndex must be less than chunkCount")
+// clang-format on
+{
+    if (!is_valid_lba_stamp(stamp, dataLength) || ptrData == M_NULLPTR || chunkIndex >= chunkCount ||
+        (result != M_NULLPTR && result->mismatches == M_NULLPTR && result->mismatchCapacity > SIZE_T_C(0)))
+    {
+        return M_ACCESS_ENUM(eReturnValues, BAD_PARAMETER);
+    }
+    if (result != M_NULLPTR)
+    {
+        result->badSectorCount      = UINT64_C(0);
+        result->mismatchCount       = SIZE_T_C(0);
+        result->mismatchesTruncated = false;
+    }
+    size_t offset = SIZE_T_C(0);
+    size_t length = SIZE_T_C(0);
+    get_chunk_byte_range(dataLength, stamp->sectorSize, chunkCount, chunkIndex, &offset, &length);
+    uint64_t lba    = stamp->startLBA + (offset / stamp->sectorSize);
+    bool     failed = false;
+    for (size_t sector = offset; sector < offset + length; sector += stamp->sectorSize, ++lba)
+    {
+        uint64_t foundLBA      = UINT64_C(0);
+        uint64_t foundSequence = UINT64_C(0);
+        uint32_t errors        = check_lba_stamped_sector(stamp, &ptrData[sector], lba, &foundLBA, &foundSequence);
+        if (errors == UINT32_C(0))
+        {
+            continue;
+        }
+        failed = true;
+        if (result == M_NULLPTR)
+        {
+            break;
+        }
+        result->badSectorCount += UINT64_C(1);
+        if (result->mismatchCount < result->mismatchCapacity)
+        {
+            lbaStampMismatch* mismatch = &result->mismatches[result->mismatchCount];
+            mismatch->lba              = lba;
+            mismatch->foundLBA         = foundLBA;
+            mismatch->foundSequence    = foundSequence;
+            mismatch->errors           = errors;
+            result->mismatchCount += SIZE_T_C(1);
+        }
+        else
+        {
+            result->mismatchesTruncated = true;
+        }
+    }
+    if (failed)
+    {
+        return M_ACCESS_ENUM(eReturnValues, VALIDATION_FAILURE);
+    }
+    return M_ACCESS_ENUM(eReturnValues, SUCCESS);
+}
+
+M_PARAM_RO(1)
+M_PARAM_RO_SIZE(2, 3)
+eReturnValues verify_LBA_Stamped_Pattern_In_Buffer(const lbaStamp* M_NONNULL        stamp,
+                                                   const uint8_t* M_NONNULL         ptrData,
+                                                   size_t                           dataLength,
+                                                   lbaStampVerifyResult* M_NULLABLE result)
+    // clang-format off
+    M_DIAG_ERROR(dataLength == 0, "dataLength must be non-zero")
+// clang-format on
+{
+    return verify_LBA_Stamped_Chunk_In_Buffer(stamp, ptrData, dataLength, UINT32_C(1), UINT32_C(0), result);
+}
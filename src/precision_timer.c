@@ -12,7 +12,9 @@
 //! If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include "precision_timer.h"
+#include "bit_manip.h"
 #include "env_detect.h"
+#include "math_utils.h"
 #include "memory_safety.h"
 #include "string_utils.h"
 #include "type_conversion.h"
@@ -24,41 +26,23 @@ DISABLE_WARNING_4255
 #    include <windows.h>
 RESTORE_WARNING_4255
 
-M_PARAM_WO(1) void start_Timer(seatimer_t* M_NONNULL timer)
-{
-    if (timer != M_NULLPTR)
-    {
-        LARGE_INTEGER tempLargeInt;
-        tempLargeInt.QuadPart = 0;
-        if (MSFT_BOOL_TRUE(QueryPerformanceCounter(&tempLargeInt))) // according to MSDN this will always return
-                                                                    // success on XP and later systems
-        {
-            if (tempLargeInt.QuadPart >= LONGLONG_C(0))
-            {
-                timer->timerStart = C_CAST(uint64_t, tempLargeInt.QuadPart);
-            }
-        }
-    }
-}
-
-M_PARAM_WO(1) void stop_Timer(seatimer_t* M_NONNULL timer)
+static bool read_os_timer(uint64_t* M_NONNULL ticks)
 {
-    if (timer != M_NULLPTR)
+    LARGE_INTEGER tempLargeInt;
+    tempLargeInt.QuadPart = 0;
+    if (MSFT_BOOL_TRUE(QueryPerformanceCounter(&tempLargeInt))) // according to MSDN this will always return
+                                                                // success on XP and later systems
     {
-        LARGE_INTEGER tempLargeInt;
-        M_INITIALIZE_STRUCTURE(&tempLargeInt, sizeof(LARGE_INTEGER));
-        if (MSFT_BOOL_TRUE(QueryPerformanceCounter(&tempLargeInt))) // according to MSDN this will always return
-                                                                    // success on XP and later systems
+        if (tempLargeInt.QuadPart >= LONGLONG_C(0))
         {
-            if (tempLargeInt.QuadPart >= LONGLONG_C(0))
-            {
-                timer->timerStop = C_CAST(uint64_t, tempLargeInt.QuadPart);
-            }
+            *ticks = C_CAST(uint64_t, tempLargeInt.QuadPart);
+            return true;
         }
     }
+    return false;
 }
 
-M_NODISCARD M_CONST_FUNC uint64_t get_Nano_Seconds(seatimer_t timer) M_UNSEQUENCED
+static uint64_t os_ticks_to_nanoseconds(uint64_t ticks)
 {
     LARGE_INTEGER frequency;                                 // clock ticks per second
     uint64_t      ticksPerNanosecond = UINT64_C(1000000000); // start with a count of nanoseconds per second
@@ -71,11 +55,8 @@ M_NODISCARD M_CONST_FUNC uint64_t get_Nano_Seconds(seatimer_t timer) M_UNSEQUENC
                                                 // and don't want to divide by zero
         {
             ticksPerNanosecond /= C_CAST(uint64_t, frequency.QuadPart);
-            seconds =
-                (timer.timerStop - timer.timerStart) / C_CAST(uint64_t,
-                                                              frequency.QuadPart); // converted to nanoseconds later
-            nanoSeconds =
-                ((timer.timerStop - timer.timerStart) % C_CAST(uint64_t, frequency.QuadPart)) * ticksPerNanosecond;
+            seconds     = ticks / C_CAST(uint64_t, frequency.QuadPart); // converted to nanoseconds later
+            nanoSeconds = (ticks % C_CAST(uint64_t, frequency.QuadPart)) * ticksPerNanosecond;
             return ((seconds * UINT64_C(1000000000)) + nanoSeconds);
         }
         else
@@ -97,29 +78,256 @@ M_NODISCARD M_CONST_FUNC uint64_t get_Nano_Seconds(seatimer_t timer) M_UNSEQUENC
 // (this will be affected just like gettimeofday function) other clocks that may
 // work: CLOCK_TAI (linux),  CLOCK_MONOTONIC_RAW  (linux), CLOCK_BOOTTIME
 // (linux) https://www.man7.org/linux/man-pages/man3/clock_gettime.3.html
-M_PARAM_WO(1) void start_Timer(seatimer_t* M_NONNULL timer)
+static bool read_os_timer(uint64_t* M_NONNULL ticks)
 {
-    if (timer != M_NULLPTR)
-    {
-        struct timespec startTimespec;
-        int             ret = 0;
-        M_INITIALIZE_STRUCTURE(&startTimespec, sizeof(struct timespec));
 #    if !defined(UEFI_C_SOURCE) && defined(POSIX_1993) && defined(_POSIX_TIMERS) && defined _POSIX_MONOTONIC_CLOCK
-        ret = clock_gettime(CLOCK_MONOTONIC, &startTimespec);
+    struct timespec nowTimespec;
+    M_INITIALIZE_STRUCTURE(&nowTimespec, sizeof(struct timespec));
+    if (0 == clock_gettime(CLOCK_MONOTONIC, &nowTimespec))
+    {
+        *ticks =
+            (C_CAST(uint64_t, nowTimespec.tv_sec) * UINT64_C(1000000000)) + C_CAST(uint64_t, nowTimespec.tv_nsec);
+        return true;
+    }
 #    else // this function is older and more likely available if we don't have
           // the support we need/want
-        ret = gettimeofday(&startTimespec, M_NULLPTR);
+    struct timeval nowTimeval;
+    M_INITIALIZE_STRUCTURE(&nowTimeval, sizeof(struct timeval));
+    if (0 == gettimeofday(&nowTimeval, M_NULLPTR))
+    {
+        *ticks = (C_CAST(uint64_t, nowTimeval.tv_sec) * UINT64_C(1000000000)) +
+                 (C_CAST(uint64_t, nowTimeval.tv_usec) * UINT64_C(1000));
+        return true;
+    }
 #    endif
-        if (0 == ret) // hopefully this always works...-TJE
+    return false;
+}
+
+static uint64_t os_ticks_to_nanoseconds(uint64_t ticks)
+{
+    return ticks;
+}
+#endif // platform check
+
+// CPU counter backends. x86 uses the time stamp counter when the CPU reports it as invariant (constant rate in all
+// power states). AArch64 uses the generic timer's virtual count, which always runs at the fixed rate in cntfrq_el0.
+#if !defined(DISABLE_CPU_TIMER) && !defined(UEFI_C_SOURCE)
+#    if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#        include <cpuid.h>
+#        include <x86intrin.h>
+#        define CPU_TIMER_X86
+#    elif (defined(_M_X64) || defined(_M_AMD64) || defined(_M_IX86)) && defined(_MSC_VER)
+#        include <intrin.h>
+#        define CPU_TIMER_X86
+#    elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+#        define CPU_TIMER_ARM64
+#    endif
+#endif
+
+// length of the interval the TSC is measured over against the OS clock
+#define CPU_TIMER_CALIBRATION_NANOSECONDS UINT64_C(5000000)
+
+#if defined(CPU_TIMER_X86)
+static void get_cpuid(uint32_t leaf, uint32_t registers[4])
+{
+#    if defined(_MSC_VER) && !defined(__clang__)
+    int values[4] = {0, 0, 0, 0};
+    __cpuid(values, C_CAST(int, leaf));
+    for (size_t iter = SIZE_T_C(0); iter < SIZE_T_C(4); ++iter)
+    {
+        registers[iter] = C_CAST(uint32_t, values[iter]);
+    }
+#    else
+    unsigned int eax = 0U;
+    unsigned int ebx = 0U;
+    unsigned int ecx = 0U;
+    unsigned int edx = 0U;
+    __cpuid(leaf, eax, ebx, ecx, edx);
+    registers[0] = eax;
+    registers[1] = ebx;
+    registers[2] = ecx;
+    registers[3] = edx;
+#    endif
+}
+
+// Reading at the start of a timed region: lfence keeps the read from moving ahead of earlier instructions.
+static M_INLINE uint64_t read_cpu_timer_start(void)
+{
+#    if defined(HAVE_SSE2)
+    _mm_lfence();
+#    endif
+    return C_CAST(uint64_t, __rdtsc());
+}
+
+// Reading at the end of a timed region: rdtscp waits for earlier instructions to finish, and the lfence keeps later
+// instructions from starting before the read.
+static M_INLINE uint64_t read_cpu_timer_stop(bool hasRDTSCP)
+{
+    uint64_t ticks = UINT64_C(0);
+    if (hasRDTSCP)
+    {
+        unsigned int processor = 0U;
+        ticks                  = C_CAST(uint64_t, __rdtscp(&processor));
+    }
+    else
+    {
+        ticks = read_cpu_timer_start();
+    }
+#    if defined(HAVE_SSE2)
+    _mm_lfence();
+#    endif
+    return ticks;
+}
+
+static uint64_t calibrate_cpu_timer(bool* M_NONNULL hasRDTSCP)
+{
+    uint32_t registers[4] = {0, 0, 0, 0};
+    get_cpuid(UINT32_C(0x80000000), registers);
+    if (registers[0] < UINT32_C(0x80000007))
+    {
+        return UINT64_C(0);
+    }
+    get_cpuid(UINT32_C(0x80000001), registers);
+    *hasRDTSCP = (registers[3] & (UINT32_C(1) << 27)) != UINT32_C(0);
+    get_cpuid(UINT32_C(0x80000007), registers);
+    if ((registers[3] & (UINT32_C(1) << 8)) == UINT32_C(0))
+    {
+        return UINT64_C(0); // TSC rate changes with power state, so it cannot be converted to time
+    }
+    uint64_t osStart = UINT64_C(0);
+    uint64_t osNow   = UINT64_C(0);
+    if (!read_os_timer(&osStart))
+    {
+        return UINT64_C(0);
+    }
+    uint64_t tscStart       = read_cpu_timer_start();
+    uint64_t tscStop        = tscStart;
+    uint64_t osElapsedNanos = UINT64_C(0);
+    do
+    {
+        if (!read_os_timer(&osNow))
         {
-            //        printf("Start Time:  %lu\n", startTimespec.tv_nsec);
-            timer->timerStart = (C_CAST(uint64_t, startTimespec.tv_sec) * UINT64_C(1000000000)) +
-                                C_CAST(uint64_t, startTimespec.tv_nsec);
+            return UINT64_C(0);
+        }
+        tscStop        = read_cpu_timer_stop(*hasRDTSCP);
+        osElapsedNanos = os_ticks_to_nanoseconds(osNow - osStart);
+    } while (osElapsedNanos < CPU_TIMER_CALIBRATION_NANOSECONDS);
+    if (osElapsedNanos > UINT64_MAX / UINT64_C(1000000000))
+    {
+        return UINT64_C(0); // suspended for many seconds mid-measurement, so the result cannot be trusted
+    }
+    // split into whole multiples of the interval and a remainder so the multiply cannot overflow
+    uint64_t tscTicks = tscStop - tscStart;
+    return ((tscTicks / osElapsedNanos) * UINT64_C(1000000000)) +
+           (((tscTicks % osElapsedNanos) * UINT64_C(1000000000)) / osElapsedNanos);
+}
+#elif defined(CPU_TIMER_ARM64)
+static M_INLINE uint64_t read_cpu_timer_start(void)
+{
+    uint64_t ticks = UINT64_C(0);
+    // isb keeps the read from moving ahead of earlier instructions
+    __asm__ __volatile__("isb\n\tmrs %0, cntvct_el0" : "=r"(ticks) : : "memory");
+    return ticks;
+}
+
+static M_INLINE uint64_t read_cpu_timer_stop(bool hasRDTSCP)
+{
+    M_USE_UNUSED(hasRDTSCP);
+    return read_cpu_timer_start();
+}
+
+static uint64_t calibrate_cpu_timer(bool* M_NONNULL hasRDTSCP)
+{
+    uint64_t frequency = UINT64_C(0);
+    *hasRDTSCP         = false;
+    __asm__ __volatile__("mrs %0, cntfrq_el0" : "=r"(frequency));
+    return frequency;
+}
+#endif
+
+#if defined(CPU_TIMER_X86) || defined(CPU_TIMER_ARM64)
+// The clock choice and the CPU counter rate live in one word so a thread can never see one without the other. It is
+// written once with a compare-exchange: if two threads calibrate at the same time, the first result is kept and the
+// other thread uses it too, so every timer starts and stops on the same clock and converts with the same rate.
+//   0                        not chosen yet
+//   TIMER_STATE_OS_CLOCK     the OS clock
+//   anything else            the CPU counter: ticks per second shifted left by 1, low bit set when rdtscp is available
+#    define TIMER_STATE_UNSELECTED UINT64_C(0)
+#    define TIMER_STATE_OS_CLOCK   UINT64_C(1)
+
+static uint64_t timerState = TIMER_STATE_UNSELECTED;
+
+static M_INLINE uint64_t load_timer_state(void)
+{
+#    if defined(_MSC_VER) && !defined(__clang__)
+    // a compare-exchange that never changes the value is a load with a full barrier
+    return C_CAST(uint64_t, _InterlockedCompareExchange64(C_CAST(volatile __int64*, &timerState), 0, 0));
+#    else
+    return __atomic_load_n(&timerState, __ATOMIC_ACQUIRE);
+#    endif
+}
+
+static uint64_t select_timer_source(void)
+{
+    bool     hasRDTSCP         = false;
+    uint64_t cpuTicksPerSecond = calibrate_cpu_timer(&hasRDTSCP);
+    uint64_t state             = TIMER_STATE_OS_CLOCK;
+    if (cpuTicksPerSecond > UINT64_C(0))
+    {
+        state = (cpuTicksPerSecond << 1) | (hasRDTSCP ? UINT64_C(1) : UINT64_C(0));
+    }
+#    if defined(_MSC_VER) && !defined(__clang__)
+    uint64_t previous = C_CAST(
+        uint64_t, _InterlockedCompareExchange64(C_CAST(volatile __int64*, &timerState), C_CAST(__int64, state), 0));
+    return previous == TIMER_STATE_UNSELECTED ? state : previous;
+#    else
+    uint64_t expected = TIMER_STATE_UNSELECTED;
+    if (!__atomic_compare_exchange_n(&timerState, &expected, state, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+    {
+        return expected; // another thread chose first
+    }
+    return state;
+#    endif
+}
+
+static M_INLINE uint64_t get_timer_state(void)
+{
+    uint64_t state = load_timer_state();
+    if (state == TIMER_STATE_UNSELECTED)
+    {
+        state = select_timer_source();
+    }
+    return state;
+}
+#endif
+
+M_NODISCARD eTimerSource get_Timer_Source(void)
+{
+#if defined(CPU_TIMER_X86) || defined(CPU_TIMER_ARM64)
+    if (get_timer_state() != TIMER_STATE_OS_CLOCK)
+    {
+        return TIMER_SOURCE_CPU_COUNTER;
+    }
+#endif
+    return TIMER_SOURCE_OS_CLOCK;
+}
+
+M_PARAM_WO(1) void start_Timer(seatimer_t* M_NONNULL timer)
+{
+    if (timer != M_NULLPTR)
+    {
+#if defined(CPU_TIMER_X86) || defined(CPU_TIMER_ARM64)
+        if (get_timer_state() != TIMER_STATE_OS_CLOCK)
+        {
+            timer->timerStart = read_cpu_timer_start();
+            return;
+        }
+#endif
+        uint64_t ticks = UINT64_C(0);
+        if (read_os_timer(&ticks))
+        {
+            timer->timerStart = ticks;
         }
-        //    else
-        //    {
-        //       printf("Bad start_timer Ret:  %d\n",ret);
-        //    }
     }
 }
 
@@ -127,50 +335,347 @@ M_PARAM_WO(1) void stop_Timer(seatimer_t* M_NONNULL timer)
 {
     if (timer != M_NULLPTR)
     {
-        struct timespec stopTimespec;
-        int             ret = 0;
-        M_INITIALIZE_STRUCTURE(&stopTimespec, sizeof(struct timespec));
-#    if !defined(UEFI_C_SOURCE) && defined(POSIX_1993) && defined(_POSIX_TIMERS) && defined _POSIX_MONOTONIC_CLOCK
-        ret = clock_gettime(CLOCK_MONOTONIC, &stopTimespec);
-#    else // this function is older and more likely available if we don't have
-          // the support we need/want
-        ret = gettimeofday(&stopTimespec, M_NULLPTR);
-#    endif
-        if (0 == ret) // hopefully this always works...-TJE
+#if defined(CPU_TIMER_X86) || defined(CPU_TIMER_ARM64)
+        uint64_t state = get_timer_state();
+        if (state != TIMER_STATE_OS_CLOCK)
+        {
+            timer->timerStop = read_cpu_timer_stop((state & UINT64_C(1)) != UINT64_C(0));
+            return;
+        }
+#endif
+        uint64_t ticks = UINT64_C(0);
+        if (read_os_timer(&ticks))
         {
-            //        printf("Stop Time:  %lu\n", stopTimespec.tv_nsec);
-            timer->timerStop =
-                (C_CAST(uint64_t, stopTimespec.tv_sec) * UINT64_C(1000000000)) + C_CAST(uint64_t, stopTimespec.tv_nsec);
+            timer->timerStop = ticks;
         }
-        //    else
-        //    {
-        //       printf("Bad stop_timer Ret:  %d\n",ret);
-        //    }
     }
 }
 
-M_NODISCARD M_CONST_FUNC uint64_t get_Nano_Seconds(seatimer_t timer) M_UNSEQUENCED
+// Not const: the conversion depends on the clock chosen at run time, so results must not be reused from a call made
+// before the first timer was started.
+M_NODISCARD uint64_t get_Nano_Seconds(seatimer_t timer)
 {
-    return timer.timerStop - timer.timerStart;
+    uint64_t ticks = timer.timerStop - timer.timerStart;
+#if defined(CPU_TIMER_X86) || defined(CPU_TIMER_ARM64)
+    uint64_t state = load_timer_state();
+    if (state != TIMER_STATE_UNSELECTED && state != TIMER_STATE_OS_CLOCK)
+    {
+        uint64_t cpuTicksPerSecond = state >> 1;
+        // split into whole seconds and a remainder so the multiply cannot overflow
+        return ((ticks / cpuTicksPerSecond) * UINT64_C(1000000000)) +
+               (((ticks % cpuTicksPerSecond) * UINT64_C(1000000000)) / cpuTicksPerSecond);
+    }
+#endif
+    return os_ticks_to_nanoseconds(ticks);
 }
-#endif // platform check
 
 #define NANOSECONDS_PER_MICROSECOND 1000.0
 #define NANOSECONDS_PER_MILLISECOND 1000000.0
 #define NANOSECONDS_PER_SECOND      1000000000.0
 
-M_NODISCARD M_CONST_FUNC double get_Micro_Seconds(seatimer_t timer) M_UNSEQUENCED
+M_NODISCARD double get_Micro_Seconds(seatimer_t timer)
 {
     uint64_t nanoseconds = get_Nano_Seconds(timer);
     return (C_CAST(double, nanoseconds) / NANOSECONDS_PER_MICROSECOND);
 }
 
-M_NODISCARD M_CONST_FUNC double get_Milli_Seconds(seatimer_t timer) M_UNSEQUENCED
+M_NODISCARD double get_Milli_Seconds(seatimer_t timer)
 {
     return (get_Nano_Seconds(timer) / NANOSECONDS_PER_MILLISECOND);
 }
 
-M_NODISCARD M_CONST_FUNC double get_Seconds(seatimer_t timer) M_UNSEQUENCED
+double get_Seconds(seatimer_t timer)
 {
     return (get_Nano_Seconds(timer) / NANOSECONDS_PER_SECOND);
 }
+
+#define LATENCY_HISTOGRAM_MIN_SIGNIFICANT_BITS 2
+#define LATENCY_HISTOGRAM_MAX_SIGNIFICANT_BITS 16
+
+struct slatencyHistogram
+{
+    uint64_t* M_NONNULL counts;
+    size_t              bucketCount;
+    uint64_t            maxValue;    // values above this are counted in the last bucket
+    uint64_t            totalCount;
+    uint64_t            minRecorded; // UINT64_MAX while empty
+    uint64_t            maxRecorded;
+    uint8_t             significantBits;
+};
+
+// Values below 2^significantBits map to themselves. Above that, a value whose top set bit is e is shifted right by
+// (e - significantBits + 1) so exactly significantBits bits remain, and each shift gets its own run of
+// 2^(significantBits - 1) buckets.
+static M_INLINE size_t latency_bucket_index(uint8_t significantBits, uint64_t value)
+{
+    unsigned int shift = 0U;
+    if (value < (UINT64_C(1) << significantBits))
+    {
+        return C_CAST(size_t, value);
+    }
+    shift = (ULLONG_WIDTH - count_leading_zeros_ull(value)) - significantBits;
+    return C_CAST(size_t, (C_CAST(uint64_t, shift) << (significantBits - 1U)) + (value >> shift));
+}
+
+static M_INLINE uint64_t latency_bucket_lowest_value(uint8_t significantBits, size_t index)
+{
+    uint64_t     bucket = C_CAST(uint64_t, index);
+    unsigned int shift  = 0U;
+    if (bucket < (UINT64_C(1) << significantBits))
+    {
+        return bucket;
+    }
+    shift = C_CAST(unsigned int, (bucket >> (significantBits - 1U)) - UINT64_C(1));
+    return (bucket - (C_CAST(uint64_t, shift) << (significantBits - 1U))) << shift;
+}
+
+static M_INLINE uint64_t latency_bucket_highest_value(uint8_t significantBits, size_t index)
+{
+    uint64_t bucket = C_CAST(uint64_t, index);
+    if (bucket < (UINT64_C(1) << significantBits))
+    {
+        return bucket;
+    }
+    // the width of a bucket is 2^shift, so the last value is one less than the next bucket's first
+    return latency_bucket_lowest_value(significantBits, index) +
+           ((UINT64_C(1) << ((bucket >> (significantBits - 1U)) - UINT64_C(1))) - UINT64_C(1));
+}
+
+latencyHistogram* M_NULLABLE create_Latency_Histogram(uint8_t significantBits, uint64_t maxValue)
+{
+    latencyHistogram* histogram = M_NULLPTR;
+    if (significantBits < LATENCY_HISTOGRAM_MIN_SIGNIFICANT_BITS ||
+        significantBits > LATENCY_HISTOGRAM_MAX_SIGNIFICANT_BITS)
+    {
+        return M_NULLPTR;
+    }
+    if (maxValue == UINT64_C(0))
+    {
+        maxValue = UINT64_MAX;
+    }
+    histogram = M_REINTERPRET_CAST(latencyHistogram*, safe_calloc(SIZE_T_C(1), sizeof(latencyHistogram)));
+    if (histogram == M_NULLPTR)
+    {
+        return M_NULLPTR;
+    }
+    histogram->significantBits = significantBits;
+    histogram->maxValue        = maxValue;
+    histogram->bucketCount     = latency_bucket_index(significantBits, maxValue) + SIZE_T_C(1);
+    histogram->minRecorded     = UINT64_MAX;
+    histogram->counts = M_REINTERPRET_CAST(uint64_t*, safe_calloc(histogram->bucketCount, sizeof(uint64_t)));
+    if (histogram->counts == M_NULLPTR)
+    {
+        free_Latency_Histogram(&histogram);
+    }
+    return histogram;
+}
+
+void free_Latency_Histogram(latencyHistogram* M_NULLABLE* M_NULLABLE histogram)
+{
+    if (histogram != M_NULLPTR && *histogram != M_NULLPTR)
+    {
+        safe_free(&(*histogram)->counts);
+        safe_free_core(M_REINTERPRET_CAST(void**, histogram));
+    }
+}
+
+void latency_Histogram_Reset(latencyHistogram* M_NONNULL histogram)
+{
+    if (histogram != M_NULLPTR)
+    {
+        safe_memset(histogram->counts, histogram->bucketCount * sizeof(uint64_t), 0,
+                    histogram->bucketCount * sizeof(uint64_t));
+        histogram->totalCount  = UINT64_C(0);
+        histogram->minRecorded = UINT64_MAX;
+        histogram->maxRecorded = UINT64_C(0);
+    }
+}
+
+void latency_Histogram_Record(latencyHistogram* M_NONNULL histogram, uint64_t value)
+{
+    if (histogram != M_NULLPTR)
+    {
+        histogram->counts[latency_bucket_index(histogram->significantBits, M_Min(value, histogram->maxValue))] += 1;
+        histogram->totalCount += 1;
+        if (value < histogram->minRecorded)
+        {
+            histogram->minRecorded = value;
+        }
+        if (value > histogram->maxRecorded)
+        {
+            histogram->maxRecorded = value;
+        }
+    }
+}
+
+void latency_Histogram_Record_Timer(latencyHistogram* M_NONNULL histogram, seatimer_t timer)
+{
+    latency_Histogram_Record(histogram, get_Nano_Seconds(timer));
+}
+
+errno_t latency_Histogram_Merge(latencyHistogram* M_NONNULL destination, const latencyHistogram* M_NONNULL source)
+{
+    if (destination == M_NULLPTR || source == M_NULLPTR || destination->significantBits != source->significantBits ||
+        destination->maxValue != source->maxValue)
+    {
+        return EINVAL;
+    }
+    for (size_t index = SIZE_T_C(0); index < destination->bucketCount; ++index)
+    {
+        destination->counts[index] += source->counts[index];
+    }
+    destination->totalCount += source->totalCount;
+    if (source->minRecorded < destination->minRecorded)
+    {
+        destination->minRecorded = source->minRecorded;
+    }
+    if (source->maxRecorded > destination->maxRecorded)
+    {
+        destination->maxRecorded = source->maxRecorded;
+    }
+    return 0;
+}
+
+uint64_t latency_Histogram_Count(const latencyHistogram* M_NONNULL histogram)
+{
+    return histogram != M_NULLPTR ? histogram->totalCount : UINT64_C(0);
+}
+
+uint64_t latency_Histogram_Min(const latencyHistogram* M_NONNULL histogram)
+{
+    return (histogram != M_NULLPTR && histogram->totalCount > UINT64_C(0)) ? histogram->minRecorded : UINT64_C(0);
+}
+
+uint64_t latency_Histogram_Max(const latencyHistogram* M_NONNULL histogram)
+{
+    return histogram != M_NULLPTR ? histogram->maxRecorded : UINT64_C(0);
+}
+
+double latency_Histogram_Mean(const latencyHistogram* M_NONNULL histogram)
+{
+    double total = 0.0;
+    if (histogram == M_NULLPTR || histogram->totalCount == UINT64_C(0))
+    {
+        return 0.0;
+    }
+    for (size_t index = SIZE_T_C(0); index < histogram->bucketCount; ++index)
+    {
+        if (histogram->counts[index] > UINT64_C(0))
+        {
+            uint64_t lowest  = latency_bucket_lowest_value(histogram->significantBits, index);
+            uint64_t highest = latency_bucket_highest_value(histogram->significantBits, index);
+            total += C_CAST(double, histogram->counts[index]) *
+                     (C_CAST(double, lowest) + (C_CAST(double, highest - lowest) / 2.0));
+        }
+    }
+    return total / C_CAST(double, histogram->totalCount);
+}
+
+uint64_t latency_Histogram_Percentile(const latencyHistogram* M_NONNULL histogram, double percentile)
+{
+    double   target     = 0.0;
+    uint64_t targetRank = UINT64_C(0);
+    uint64_t cumulative = UINT64_C(0);
+    if (histogram == M_NULLPTR || histogram->totalCount == UINT64_C(0))
+    {
+        return UINT64_C(0);
+    }
+    if (!(percentile > 0.0)) // also catches NaN
+    {
+        return histogram->minRecorded;
+    }
+    if (percentile >= 100.0)
+    {
+        return histogram->maxRecorded;
+    }
+    // rank of the value to report, rounded up so p50 of 3 values is the second
+    target     = (percentile / 100.0) * C_CAST(double, histogram->totalCount);
+    targetRank = C_CAST(uint64_t, target);
+    if (C_CAST(double, targetRank) < target || targetRank == UINT64_C(0))
+    {
+        targetRank += 1;
+    }
+    for (size_t index = SIZE_T_C(0); index < histogram->bucketCount; ++index)
+    {
+        cumulative += histogram->counts[index];
+        if (cumulative >= targetRank)
+        {
+            uint64_t value = latency_bucket_highest_value(histogram->significantBits, index);
+            if (value > histogram->maxRecorded)
+            {
+                value = histogram->maxRecorded;
+            }
+            if (value < histogram->minRecorded)
+            {
+                value = histogram->minRecorded;
+            }
+            return value;
+        }
+    }
+    return histogram->maxRecorded;
+}
+
+static errno_t print_latency_histogram_text(const latencyHistogram* M_NONNULL histogram, FILE* M_NONNULL stream)
+{
+    static const double percentiles[] = {50.0, 75.0, 90.0, 99.0, 99.9, 99.99, 100.0};
+    if (fprintf(stream, "Count: %" PRIu64 "\n", histogram->totalCount) < 0 ||
+        fprintf(stream, "Min:   %" PRIu64 "\n", latency_Histogram_Min(histogram)) < 0 ||
+        fprintf(stream, "Mean:  %.2f\n", latency_Histogram_Mean(histogram)) < 0 ||
+        fprintf(stream, "Max:   %" PRIu64 "\n", histogram->maxRecorded) < 0 ||
+        fprintf(stream, "%10s  %20s\n", "Percentile", "Value") < 0)
+    {
+        return EIO;
+    }
+    for (size_t index = SIZE_T_C(0); index < SIZE_OF_STACK_ARRAY(percentiles); ++index)
+    {
+        if (fprintf(stream, "%10.3f  %20" PRIu64 "\n", percentiles[index],
+                    latency_Histogram_Percentile(histogram, percentiles[index])) < 0)
+        {
+            return EIO;
+        }
+    }
+    return 0;
+}
+
+static errno_t print_latency_histogram_csv(const latencyHistogram* M_NONNULL histogram, FILE* M_NONNULL stream)
+{
+    uint64_t cumulative = UINT64_C(0);
+    if (fprintf(stream, "Value,Count,Cumulative Count,Percentile\n") < 0)
+    {
+        return EIO;
+    }
+    for (size_t index = SIZE_T_C(0); index < histogram->bucketCount; ++index)
+    {
+        if (histogram->counts[index] > UINT64_C(0))
+        {
+            uint64_t value = M_Min(latency_bucket_highest_value(histogram->significantBits, index),
+                                   histogram->maxRecorded);
+            cumulative += histogram->counts[index];
+            if (fprintf(stream, "%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%.6f\n", value, histogram->counts[index],
+                        cumulative, (C_CAST(double, cumulative) * 100.0) / C_CAST(double, histogram->totalCount)) <
+                0)
+            {
+                return EIO;
+            }
+        }
+    }
+    return 0;
+}
+
+errno_t print_Latency_Histogram(const latencyHistogram* M_NONNULL histogram,
+                                FILE* M_NONNULL                   stream,
+                                eLatencyHistogramFormat           format)
+{
+    if (histogram == M_NULLPTR || stream == M_NULLPTR)
+    {
+        return EINVAL;
+    }
+    switch (format)
+    {
+    case LATENCY_HISTOGRAM_TEXT:
+        return print_latency_histogram_text(histogram, stream);
+    case LATENCY_HISTOGRAM_CSV:
+        return print_latency_histogram_csv(histogram, stream);
+    }
+    return EINVAL;
+}
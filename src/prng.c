@@ -2,7 +2,8 @@
 
 //! \file prng.c
 //! \brief Implements psuedo random number generation functionality.
-//! Currently implemented using XOR shift+
+//! The global seed_32/seed_64 generators are implemented using XOR shift+. The prngState API provides independent
+//! streams using xoshiro256** or SplitMix64.
 //! \copyright
 //! Do NOT modify or remove this copyright and license
 //!
@@ -12,9 +13,14 @@
 //! If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include "prng.h"
+#include "bit_manip.h"
 #include "common_types.h"
 #include "type_conversion.h"
 
+#if defined(_MSC_VER)
+#    include <intrin.h>
+#endif
+
 uint32_t seed32Array[2] = {UINT32_C(0x05EAF00D), UINT32_C(0x05EA51DE)};
 uint64_t seed64Array[2] = {UINT64_C(0x05EAF00D05EA51DE), UINT64_C(0x05EA51DE05EAF00D)};
 
@@ -57,48 +63,386 @@ uint64_t xorshiftplus64(void)
     return (seed64Array[1] + y);
 }
 
-uint32_t random_Range_32(uint32_t rangeMin, uint32_t rangeMax)
+// Multiplies two 64bit values, returning the upper 64 bits of the 128bit product and storing the lower 64 bits in low.
+static M_INLINE uint64_t multiply_64_to_128(uint64_t left, uint64_t right, uint64_t* M_NONNULL low)
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ unsigned __int128 product = M_STATIC_CAST(unsigned __int128, left) * right;
+    *low                                    = M_STATIC_CAST(uint64_t, product);
+    return M_STATIC_CAST(uint64_t, product >> 64);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_AMD64))
+    uint64_t high = UINT64_C(0);
+    *low          = _umul128(left, right, &high);
+    return high;
+#else
+    uint64_t leftLow   = left & UINT32_MAX;
+    uint64_t leftHigh  = left >> 32;
+    uint64_t rightLow  = right & UINT32_MAX;
+    uint64_t rightHigh = right >> 32;
+    uint64_t lowLow    = leftLow * rightLow;
+    uint64_t highLow   = leftHigh * rightLow;
+    uint64_t lowHigh   = leftLow * rightHigh;
+    uint64_t middle    = (lowLow >> 32) + (highLow & UINT32_MAX) + (lowHigh & UINT32_MAX);
+    *low               = (middle << 32) | (lowLow & UINT32_MAX);
+    return (leftHigh * rightHigh) + (highLow >> 32) + (lowHigh >> 32) + (middle >> 32);
+#endif
+}
+
+// Lemire's nearly divisionless method: maps a random value to [0, bound) with the upper half of random * bound. Draws
+// whose lower half falls below 2^64 % bound are rejected because they would make some results more likely than
+// others. The remainder is only computed when a draw might be rejected, which is rare unless bound is huge.
+static M_INLINE uint64_t bounded_64(uint64_t (*next)(void* M_NONNULL), void* M_NONNULL context, uint64_t bound)
 {
-    // doing this to prevent a possible overflow
-    if (rangeMax == UINT32_MAX)
+    uint64_t low    = UINT64_C(0);
+    uint64_t result = multiply_64_to_128(next(context), bound, &low);
+    if (low < bound)
     {
-        rangeMax -= UINT32_C(1);
+        uint64_t threshold = (UINT64_C(0) - bound) % bound;
+        while (low < threshold)
+        {
+            result = multiply_64_to_128(next(context), bound, &low);
+        }
     }
-    // this will slightly bias the randomness.
-    // return (xorshiftplus32() % (rangeMax + 1 - rangeMin) + rangeMin);
+    return result;
+}
 
-    // This method below should return unbiased results. see
-    // http://c-faq.com/lib/randrange.html
-    uint32_t d = (UINT32_MAX / (rangeMax - rangeMin + UINT32_C(1)) + UINT32_C(1));
-    if (d > 0)
+static M_INLINE uint32_t bounded_32(uint32_t (*next)(void* M_NONNULL), void* M_NONNULL context, uint32_t bound)
+{
+    uint64_t product = M_STATIC_CAST(uint64_t, next(context)) * bound;
+    uint32_t low     = M_STATIC_CAST(uint32_t, product);
+    if (low < bound)
     {
-        return (rangeMin + xorshiftplus32() / d);
+        uint32_t threshold = (UINT32_C(0) - bound) % bound;
+        while (low < threshold)
+        {
+            product = M_STATIC_CAST(uint64_t, next(context)) * bound;
+            low     = M_STATIC_CAST(uint32_t, product);
+        }
     }
-    else
+    return M_STATIC_CAST(uint32_t, product >> 32);
+}
+
+static uint32_t global_next_32(void* M_NONNULL context)
+{
+    M_USE_UNUSED(context);
+    return xorshiftplus32();
+}
+
+static uint64_t global_next_64(void* M_NONNULL context)
+{
+    M_USE_UNUSED(context);
+    return xorshiftplus64();
+}
+
+static uint32_t state_next_32(void* M_NONNULL context)
+{
+    return prng_State_Next_32(M_STATIC_CAST(prngState*, context));
+}
+
+static uint64_t state_next_64(void* M_NONNULL context)
+{
+    return prng_State_Next_64(M_STATIC_CAST(prngState*, context));
+}
+
+uint32_t random_Range_32(uint32_t rangeMin, uint32_t rangeMax)
+{
+    if (rangeMax < rangeMin)
     {
         return 0;
     }
+    uint32_t span = rangeMax - rangeMin;
+    if (span == UINT32_MAX)
+    {
+        return xorshiftplus32();
+    }
+    return rangeMin + bounded_32(global_next_32, &seed32Array, span + UINT32_C(1));
 }
 
 uint64_t random_Range_64(uint64_t rangeMin, uint64_t rangeMax)
 {
-    // doing this to prevent a possible overflow
-    if (rangeMax == UINT64_MAX)
+    if (rangeMax < rangeMin)
+    {
+        return 0;
+    }
+    uint64_t span = rangeMax - rangeMin;
+    if (span == UINT64_MAX)
+    {
+        return xorshiftplus64();
+    }
+    return rangeMin + bounded_64(global_next_64, &seed64Array, span + UINT64_C(1));
+}
+
+// Golden ratio increment used by SplitMix64. Also used to spread seeds for xoshiro256**.
+#define SPLITMIX64_GAMMA PRNG_COUNTER_GAMMA
+
+static M_INLINE uint64_t splitmix64_mix(uint64_t value)
+{
+    return prng_Mix_64(value);
+}
+
+static M_INLINE uint64_t splitmix64_next(uint64_t* M_NONNULL counter)
+{
+    *counter += SPLITMIX64_GAMMA;
+    return splitmix64_mix(*counter);
+}
+
+static M_INLINE uint64_t rotl64(uint64_t value, unsigned int count)
+{
+    return M_STATIC_CAST(uint64_t, rotate_left_ull(M_STATIC_CAST(unsigned long long, value), count));
+}
+
+static M_INLINE uint64_t xoshiro256_next(uint64_t state[4])
+{
+    uint64_t result  = rotl64(state[1] * UINT64_C(5), 7U) * UINT64_C(9);
+    uint64_t shifted = state[1] << 17;
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= shifted;
+    state[3] = rotl64(state[3], 45U);
+    return result;
+}
+
+M_PARAM_WO(1) errno_t init_PRNG_State(prngState* M_NONNULL prng, ePRNGEngine engine, uint64_t seed)
+{
+    if (prng == M_NULLPTR)
+    {
+        return EINVAL;
+    }
+    switch (engine)
     {
-        rangeMax -= UINT64_C(1);
+    case PRNG_ENGINE_XOSHIRO256_STAR_STAR:
+    case PRNG_ENGINE_SPLITMIX64:
+        prng->engine = engine;
+        prng_State_Seed(prng, seed);
+        return 0;
     }
-    // this will slightly bias the randomness.
-    // return (xorshiftplus64() % (rangeMax + 1 - rangeMin) + rangeMin);
+    return EINVAL;
+}
 
-    // This method below should return unbiased results. see
-    // http://c-faq.com/lib/randrange.html
-    uint64_t d = (UINT64_MAX / (rangeMax - rangeMin + UINT64_C(1)) + UINT64_C(1));
-    if (d > 0)
+M_PARAM_RW(1) void prng_State_Seed(prngState* M_NONNULL prng, uint64_t seed)
+{
+    if (prng == M_NULLPTR)
     {
-        return (rangeMin + xorshiftplus64() / d);
+        return;
+    }
+    if (prng->engine == PRNG_ENGINE_SPLITMIX64)
+    {
+        prng->state[0] = seed;
+        prng->state[1] = UINT64_C(0);
+        prng->state[2] = UINT64_C(0);
+        prng->state[3] = UINT64_C(0);
     }
     else
     {
-        return 0;
+        // xoshiro256** must not start from all zeros. The SplitMix64 mix is a bijection, so four outputs from
+        // consecutive counters are all different and at most one of them can be zero.
+        uint64_t counter = seed;
+        prng->state[0]   = splitmix64_next(&counter);
+        prng->state[1]   = splitmix64_next(&counter);
+        prng->state[2]   = splitmix64_next(&counter);
+        prng->state[3]   = splitmix64_next(&counter);
+    }
+}
+
+M_PARAM_RW(1) uint64_t prng_State_Next_64(prngState* M_NONNULL prng)
+{
+    if (prng->engine == PRNG_ENGINE_SPLITMIX64)
+    {
+        return splitmix64_next(&prng->state[0]);
+    }
+    return xoshiro256_next(prng->state);
+}
+
+M_PARAM_RW(1) uint32_t prng_State_Next_32(prngState* M_NONNULL prng)
+{
+    // The upper bits are the strongest from both engines
+    return M_STATIC_CAST(uint32_t, prng_State_Next_64(prng) >> 32);
+}
+
+M_PARAM_RW(1) void prng_State_Jump(prngState* M_NONNULL prng)
+{
+    if (prng == M_NULLPTR)
+    {
+        return;
+    }
+    if (prng->engine == PRNG_ENGINE_SPLITMIX64)
+    {
+        prng->state[0] += SPLITMIX64_GAMMA << 48;
+        return;
+    }
+    // Polynomial for advancing xoshiro256 by 2^128 steps, from the reference implementation
+    static const uint64_t jump[4] = {UINT64_C(0x180EC6D33CFD0ABA), UINT64_C(0xD5A61266F0C9392C),
+                                     UINT64_C(0xA9582618E03FC9AA), UINT64_C(0x39ABDC4529B1661C)};
+    uint64_t              jumped[4] = {UINT64_C(0), UINT64_C(0), UINT64_C(0), UINT64_C(0)};
+    for (size_t word = SIZE_T_C(0); word < SIZE_T_C(4); ++word)
+    {
+        for (unsigned int bit = 0U; bit < 64U; ++bit)
+        {
+            if ((jump[word] & (UINT64_C(1) << bit)) != UINT64_C(0))
+            {
+                jumped[0] ^= prng->state[0];
+                jumped[1] ^= prng->state[1];
+                jumped[2] ^= prng->state[2];
+                jumped[3] ^= prng->state[3];
+            }
+            M_STATIC_CAST(void, xoshiro256_next(prng->state));
+        }
+    }
+    prng->state[0] = jumped[0];
+    prng->state[1] = jumped[1];
+    prng->state[2] = jumped[2];
+    prng->state[3] = jumped[3];
+}
+
+static M_THREAD_LOCAL prngState threadPRNG;
+static M_THREAD_LOCAL bool      threadPRNGSeeded = false;
+
+M_NODISCARD prngState* M_NONNULL get_Thread_PRNG_State(void)
+{
+    if (!threadPRNGSeeded)
+    {
+        // Each thread's state is at a different address, which keeps threads started in the same second apart
+        uint64_t seed = M_STATIC_CAST(uint64_t, time(M_NULLPTR)) ^
+                        splitmix64_mix(M_STATIC_CAST(uint64_t, M_REINTERPRET_CAST(uintptr_t, &threadPRNG))) ^
+                        splitmix64_mix(M_STATIC_CAST(uint64_t, clock()));
+        M_STATIC_CAST(void, init_PRNG_State(&threadPRNG, PRNG_ENGINE_XOSHIRO256_STAR_STAR, seed));
+        threadPRNGSeeded = true;
+    }
+    return &threadPRNG;
+}
+
+M_PARAM_RW(1)
+M_PARAM_WO_SIZE(5, 6)
+errno_t prng_State_Fill_Range_32(prngState* M_NONNULL prng,
+                                 uint32_t             rangeMin,
+                                 uint32_t             rangeMax,
+                                 uint32_t             step,
+                                 uint32_t* M_NONNULL  values,
+                                 size_t               count)
+{
+    if (prng == M_NULLPTR || values == M_NULLPTR || step == UINT32_C(0) || rangeMax < rangeMin)
+    {
+        return EINVAL;
+    }
+    uint32_t lastStep = (rangeMax - rangeMin) / step;
+    for (size_t iter = SIZE_T_C(0); iter < count; ++iter)
+    {
+        uint32_t steps = lastStep == UINT32_MAX ? prng_State_Next_32(prng)
+                                                : bounded_32(state_next_32, prng, lastStep + UINT32_C(1));
+        values[iter]   = rangeMin + (steps * step);
+    }
+    return 0;
+}
+
+M_PARAM_RW(1)
+M_PARAM_WO_SIZE(5, 6)
+errno_t prng_State_Fill_Range_64(prngState* M_NONNULL prng,
+                                 uint64_t             rangeMin,
+                                 uint64_t             rangeMax,
+                                 uint64_t             step,
+                                 uint64_t* M_NONNULL  values,
+                                 size_t               count)
+{
+    if (prng == M_NULLPTR || values == M_NULLPTR || step == UINT64_C(0) || rangeMax < rangeMin)
+    {
+        return EINVAL;
+    }
+    uint64_t lastStep = (rangeMax - rangeMin) / step;
+    for (size_t iter = SIZE_T_C(0); iter < count; ++iter)
+    {
+        uint64_t steps = lastStep == UINT64_MAX ? prng_State_Next_64(prng)
+                                                : bounded_64(state_next_64, prng, lastStep + UINT64_C(1));
+        values[iter]   = rangeMin + (steps * step);
+    }
+    return 0;
+}
+
+#define PRNG_PERMUTATION_ROUNDS 4
+
+// One pass of a balanced Feistel network over 2 * halfBits bits. Each round is invertible whatever the round function
+// does, so the whole network is a permutation of [0, 2^(2 * halfBits)).
+static uint64_t permutation_feistel(const prngPermutation* M_NONNULL permutation, uint64_t value)
+{
+    uint64_t halfMask = UINT64_MAX >> (64U - permutation->halfBits);
+    uint64_t left     = value >> permutation->halfBits;
+    uint64_t right    = value & halfMask;
+    for (size_t round = SIZE_T_C(0); round < PRNG_PERMUTATION_ROUNDS; ++round)
+    {
+        uint64_t mixed = left ^ (prng_Mix_64(right ^ permutation->keys[round]) & halfMask);
+        left           = right;
+        right          = mixed;
+    }
+    return (left << permutation->halfBits) | right;
+}
+
+M_PARAM_WO(1)
+errno_t init_PRNG_Permutation(prngPermutation* M_NONNULL permutation,
+                              uint64_t                   rangeMin,
+                              uint64_t                   rangeMax,
+                              uint64_t                   step,
+                              uint64_t                   seed)
+{
+    if (permutation == M_NULLPTR || step == UINT64_C(0) || rangeMax < rangeMin)
+    {
+        return EINVAL;
+    }
+    permutation->rangeMin  = rangeMin;
+    permutation->step      = step;
+    permutation->lastIndex = (rangeMax - rangeMin) / step;
+    permutation->position  = UINT64_C(0);
+    permutation->finished  = false;
+    // the smallest even bit width that covers every index keeps the out of range part of the domain under 3/4
+    unsigned int indexBits = 1U;
+    if (permutation->lastIndex > UINT64_C(0))
+    {
+        indexBits = 64U - count_leading_zeros_ull(M_STATIC_CAST(unsigned long long, permutation->lastIndex));
+    }
+    permutation->halfBits = (indexBits + 1U) / 2U;
+    uint64_t counter      = seed;
+    for (size_t round = SIZE_T_C(0); round < PRNG_PERMUTATION_ROUNDS; ++round)
+    {
+        permutation->keys[round] = splitmix64_next(&counter);
+    }
+    return 0;
+}
+
+M_PARAM_RO(1) M_NODISCARD uint64_t prng_Permutation_At(const prngPermutation* M_NONNULL permutation, uint64_t index)
+{
+    if (permutation == M_NULLPTR || index > permutation->lastIndex)
+    {
+        return permutation == M_NULLPTR ? UINT64_C(0) : permutation->rangeMin;
+    }
+    // cycle walking: the network permutes a power of 2 sized domain, so follow the cycle until it is back in range
+    uint64_t value = index;
+    do
+    {
+        value = permutation_feistel(permutation, value);
+    } while (value > permutation->lastIndex);
+    return permutation->rangeMin + (value * permutation->step);
+}
+
+M_PARAM_RW(1)
+M_PARAM_WO_SIZE(2, 3)
+size_t prng_Permutation_Fill(prngPermutation* M_NONNULL permutation, uint64_t* M_NONNULL values, size_t count)
+{
+    if (permutation == M_NULLPTR || values == M_NULLPTR)
+    {
+        return SIZE_T_C(0);
+    }
+    size_t written = SIZE_T_C(0);
+    for (; written < count && !permutation->finished; ++written)
+    {
+        values[written] = prng_Permutation_At(permutation, permutation->position);
+        if (permutation->position == permutation->lastIndex)
+        {
+            permutation->finished = true;
+        }
+        else
+        {
+            ++permutation->position;
+        }
     }
+    return written;
 }
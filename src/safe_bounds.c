@@ -0,0 +1,765 @@
+// SPDX-License-Identifier: MPL-2.0
+
+//! \file safe_bounds.c
+//! \brief Defines bounds checked lower_bound, upper_bound, and equal_range searches of sorted arrays along with
+//! an Eytzinger (breadth first) layout and search for large read-mostly tables and batched lookups of many keys.
+//!
+//! \details The inner search loops do not branch on the comparison result. Instead the result is turned into a 0 or
+//! 1 multiplier for the step size so the compiler can emit a conditional move. Both possible next probe locations are
+//! prefetched while the current comparison runs, which hides most of the memory latency on large tables.
+//! \copyright
+//! Do NOT modify or remove this copyright and license
+//!
+//! Copyright (c) 2026 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//!
+//! This software is subject to the terms of the Mozilla Public License, v. 2.0.
+//! If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "bit_manip.h"
+#include "code_attributes.h"
+#include "common_types.h"
+#include "constraint_handling.h"
+#include "sort_and_search.h"
+#include "type_conversion.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define BOUND_SEARCH_MSG_LEN 96
+
+// Common parameter validation for all of the bound searches in this file.
+// name is used to build the message passed to the constraint handler.
+// outputIsNull is passed instead of the output pointers themselves so that write-only outputs are never read here.
+static errno_t validate_bound_search(const char* M_NONNULL  name,
+                                     const void* M_NULLABLE key,
+                                     const void* M_NULLABLE ptr,
+                                     rsize_t                count,
+                                     rsize_t                size,
+                                     bool                   compareIsNull,
+                                     bool                   outputIsNull,
+                                     const char* M_NULLABLE file,
+                                     const char* M_NULLABLE function,
+                                     int                    line,
+                                     const char* M_NULLABLE expression)
+{
+    errno_t           error = 0;
+    const char*       msg   = M_NULLPTR;
+    char              fullmsg[BOUND_SEARCH_MSG_LEN];
+    constraintEnvInfo envInfo;
+    if (outputIsNull)
+    {
+        error = EINVAL;
+        msg   = "output index == NULL";
+    }
+    else if (count > RSIZE_T_C(0) && ptr == M_NULLPTR)
+    {
+        error = EINVAL;
+        msg   = "count > 0 && ptr == NULL";
+    }
+    else if (count > RSIZE_T_C(0) && compareIsNull)
+    {
+        error = EINVAL;
+        msg   = "count > 0 && compare == NULL";
+    }
+    else if (count > RSIZE_T_C(0) && key == M_NULLPTR)
+    {
+        error = EINVAL;
+        msg   = "count > 0 && key == NULL";
+    }
+    else if (count > RSIZE_MAX)
+    {
+        error = ERANGE;
+        msg   = "count > RSIZE_MAX";
+    }
+    else if (size > RSIZE_MAX)
+    {
+        error = ERANGE;
+        msg   = "size > RSIZE_MAX";
+    }
+    if (error != 0)
+    {
+        M_USE_UNUSED(snprintf(fullmsg, BOUND_SEARCH_MSG_LEN, "%s: %s", name, msg));
+        invoke_Constraint_Handler(fullmsg, set_Env_Info(&envInfo, file, function, expression, line), error);
+        errno = error;
+    }
+    return error;
+}
+
+// Branchless lower/upper bound over [0, count).
+// "upper" selects between moving right when key > element (lower bound) or key >= element (upper bound).
+// Invariant: the answer is always within [lo, lo + n]
+static M_INLINE size_t bound_search(const void* M_NONNULL key,
+                                    const char* M_NONNULL base,
+                                    size_t                count,
+                                    size_t                size,
+                                    comparefn M_NONNULL   compare,
+                                    bool                  upper)
+{
+    size_t lo        = SIZE_T_C(0);
+    size_t n         = count;
+    int    threshold = upper ? 0 : 1;
+    if (count == SIZE_T_C(0))
+    {
+        return SIZE_T_C(0);
+    }
+    while (n > SIZE_T_C(1))
+    {
+        size_t half = n >> 1;
+        size_t next = (n - half) >> 1;
+        M_PREFETCH_READ(base + (lo + next) * size);
+        M_PREFETCH_READ(base + (lo + half + next) * size);
+        lo += M_STATIC_CAST(size_t, compare(key, base + (lo + half) * size) >= threshold) * half;
+        n -= half;
+    }
+    return lo + M_STATIC_CAST(size_t, compare(key, base + lo * size) >= threshold);
+}
+
+static M_INLINE size_t bound_search_context(const void* M_NONNULL  key,
+                                            const char* M_NONNULL  base,
+                                            size_t                 count,
+                                            size_t                 size,
+                                            ctxcomparefn M_NONNULL compare,
+                                            void* M_NULLABLE       context,
+                                            bool                   upper)
+{
+    size_t lo        = SIZE_T_C(0);
+    size_t n         = count;
+    int    threshold = upper ? 0 : 1;
+    if (count == SIZE_T_C(0))
+    {
+        return SIZE_T_C(0);
+    }
+    while (n > SIZE_T_C(1))
+    {
+        size_t half = n >> 1;
+        size_t next = (n - half) >> 1;
+        M_PREFETCH_READ(base + (lo + next) * size);
+        M_PREFETCH_READ(base + (lo + half + next) * size);
+        lo += M_STATIC_CAST(size_t, compare(key, base + (lo + half) * size, context) >= threshold) * half;
+        n -= half;
+    }
+    return lo + M_STATIC_CAST(size_t, compare(key, base + lo * size, context) >= threshold);
+}
+
+M_PARAM_RO(1)
+M_PARAM_RO(2)
+M_PARAM_WO(6)
+CONSTRAINT_NO_DISCARD
+errno_t safe_lower_bound_impl(const void* M_NONNULL  key,
+                              const void* M_NONNULL  ptr,
+                              rsize_t                count,
+                              rsize_t                size,
+                              comparefn M_NONNULL    compare,
+                              rsize_t* M_NONNULL     index,
+                              const char* M_NULLABLE file,
+                              const char* M_NULLABLE function,
+                              int                    line,
+                              const char* M_NULLABLE expression)
+{
+    errno_t error = validate_bound_search("safe_lower_bound", key, ptr, count, size, compare == M_NULLPTR,
+                                          index == M_NULLPTR, file, function, line, expression);
+    if (error == 0)
+    {
+        errno  = 0;
+        *index = bound_search(key, M_REINTERPRET_CAST(const char*, ptr), count, size, compare, false);
+    }
+    return error;
+}
+
+M_PARAM_RO(1)
+M_PARAM_RO(2)
+M_PARAM_WO(7)
+CONSTRAINT_NO_DISCARD
+errno_t safe_lower_bound_context_impl(const void* M_NONNULL  key,
+                                      const void* M_NONNULL  ptr,
+                                      rsize_t                count,
+                                      rsize_t                size,
+                                      ctxcomparefn M_NONNULL compare,
+                                      void* M_NULLABLE       context,
+                                      rsize_t* M_NONNULL     index,
+                                      const char* M_NULLABLE file,
+                                      const char* M_NULLABLE function,
+                                      int                    line,
+                                      const char* M_NULLABLE expression)
+{
+    errno_t error = validate_bound_search("safe_lower_bound_context", key, ptr, count, size, compare == M_NULLPTR,
+                                          index == M_NULLPTR, file, function, line, expression);
+    if (error == 0)
+    {
+        errno = 0;
+        *index =
+            bound_search_context(key, M_REINTERPRET_CAST(const char*, ptr), count, size, compare, context, false);
+    }
+    return error;
+}
+
+M_PARAM_RO(1)
+M_PARAM_RO(2)
+M_PARAM_WO(6)
+CONSTRAINT_NO_DISCARD
+errno_t safe_upper_bound_impl(const void* M_NONNULL  key,
+                              const void* M_NONNULL  ptr,
+                              rsize_t                count,
+                              rsize_t                size,
+                              comparefn M_NONNULL    compare,
+                              rsize_t* M_NONNULL     index,
+                              const char* M_NULLABLE file,
+                              const char* M_NULLABLE function,
+                              int                    line,
+                              const char* M_NULLABLE expression)
+{
+    errno_t error = validate_bound_search("safe_upper_bound", key, ptr, count, size, compare == M_NULLPTR,
+                                          index == M_NULLPTR, file, function, line, expression);
+    if (error == 0)
+    {
+        errno  = 0;
+        *index = bound_search(key, M_REINTERPRET_CAST(const char*, ptr), count, size, compare, true);
+    }
+    return error;
+}
+
+M_PARAM_RO(1)
+M_PARAM_RO(2)
+M_PARAM_WO(7)
+CONSTRAINT_NO_DISCARD
+errno_t safe_upper_bound_context_impl(const void* M_NONNULL  key,
+                                      const void* M_NONNULL  ptr,
+                                      rsize_t                count,
+                                      rsize_t                size,
+                                      ctxcomparefn M_NONNULL compare,
+                                      void* M_NULLABLE       context,
+                                      rsize_t* M_NONNULL     index,
+                                      const char* M_NULLABLE file,
+                                      const char* M_NULLABLE function,
+                                      int                    line,
+                                      const char* M_NULLABLE expression)
+{
+    errno_t error = validate_bound_search("safe_upper_bound_context", key, ptr, count, size, compare == M_NULLPTR,
+                                          index == M_NULLPTR, file, function, line, expression);
+    if (error == 0)
+    {
+        errno  = 0;
+        *index = bound_search_context(key, M_REINTERPRET_CAST(const char*, ptr), count, size, compare, context, true);
+    }
+    return error;
+}
+
+M_PARAM_RO(1)
+M_PARAM_RO(2)
+M_PARAM_WO(6)
+M_PARAM_WO(7)
+CONSTRAINT_NO_DISCARD
+errno_t safe_equal_range_impl(const void* M_NONNULL  key,
+                              const void* M_NONNULL  ptr,
+                              rsize_t                count,
+                              rsize_t                size,
+                              comparefn M_NONNULL    compare,
+                              rsize_t* M_NONNULL     first,
+                              rsize_t* M_NONNULL     last,
+                              const char* M_NULLABLE file,
+                              const char* M_NULLABLE function,
+                              int                    line,
+                              const char* M_NULLABLE expression)
+{
+    errno_t error = validate_bound_search("safe_equal_range", key, ptr, count, size, compare == M_NULLPTR,
+                                          first == M_NULLPTR || last == M_NULLPTR, file, function, line, expression);
+    if (error == 0)
+    {
+        const char* base = M_REINTERPRET_CAST(const char*, ptr);
+        errno            = 0;
+        *first           = bound_search(key, base, count, size, compare, false);
+        // Everything before first is less than key, so only the remaining elements need to be searched for the end
+        *last = *first + bound_search(key, base + *first * size, count - *first, size, compare, true);
+    }
+    return error;
+}
+
+M_PARAM_RO(1)
+M_PARAM_RO(2)
+M_PARAM_WO(7)
+M_PARAM_WO(8)
+CONSTRAINT_NO_DISCARD
+errno_t safe_equal_range_context_impl(const void* M_NONNULL  key,
+                                      const void* M_NONNULL  ptr,
+                                      rsize_t                count,
+                                      rsize_t                size,
+                                      ctxcomparefn M_NONNULL compare,
+                                      void* M_NULLABLE       context,
+                                      rsize_t* M_NONNULL     first,
+                                      rsize_t* M_NONNULL     last,
+                                      const char* M_NULLABLE file,
+                                      const char* M_NULLABLE function,
+                                      int                    line,
+                                      const char* M_NULLABLE expression)
+{
+    errno_t error = validate_bound_search("safe_equal_range_context", key, ptr, count, size, compare == M_NULLPTR,
+                                          first == M_NULLPTR || last == M_NULLPTR, file, function, line, expression);
+    if (error == 0)
+    {
+        const char* base = M_REINTERPRET_CAST(const char*, ptr);
+        errno            = 0;
+        *first           = bound_search_context(key, base, count, size, compare, context, false);
+        *last            = *first +
+                bound_search_context(key, base + *first * size, count - *first, size, compare, context, true);
+    }
+    return error;
+}
+
+// In-order walk of the implicit tree rooted at k. Each visited node receives the next element of the sorted source.
+// Recursion depth is the height of the tree, so log2(count).
+static size_t eytzinger_fill(char* M_NONNULL       dest,
+                             const char* M_NONNULL src,
+                             size_t                srcidx,
+                             size_t                k,
+                             size_t                count,
+                             size_t                size)
+{
+    if (k < count)
+    {
+        srcidx = eytzinger_fill(dest, src, srcidx, (k * SIZE_T_C(2)) + SIZE_T_C(1), count, size);
+        memcpy(dest + k * size, src + srcidx * size, size);
+        ++srcidx;
+        srcidx = eytzinger_fill(dest, src, srcidx, (k * SIZE_T_C(2)) + SIZE_T_C(2), count, size);
+    }
+    return srcidx;
+}
+
+M_PARAM_WO(1)
+M_PARAM_RO(2)
+CONSTRAINT_NO_DISCARD
+errno_t safe_eytzinger_layout_impl(void* M_NONNULL        dest,
+                                   const void* M_NONNULL  src,
+                                   rsize_t                count,
+                                   rsize_t                size,
+                                   const char* M_NULLABLE file,
+                                   const char* M_NULLABLE function,
+                                   int                    line,
+                                   const char* M_NULLABLE expression)
+{
+    errno_t           error = 0;
+    constraintEnvInfo envInfo;
+    if (count > RSIZE_T_C(0) && dest == M_NULLPTR)
+    {
+        error = EINVAL;
+        invoke_Constraint_Handler("safe_eytzinger_layout: count > 0 && dest == NULL",
+                                  set_Env_Info(&envInfo, file, function, expression, line), error);
+    }
+    else if (count > RSIZE_T_C(0) && src == M_NULLPTR)
+    {
+        error = EINVAL;
+        invoke_Constraint_Handler("safe_eytzinger_layout: count > 0 && src == NULL",
+                                  set_Env_Info(&envInfo, file, function, expression, line), error);
+    }
+    else if (count > RSIZE_MAX || (size > RSIZE_T_C(0) && count > RSIZE_MAX / size))
+    {
+        error = ERANGE;
+        invoke_Constraint_Handler("safe_eytzinger_layout: count > RSIZE_MAX",
+                                  set_Env_Info(&envInfo, file, function, expression, line), error);
+    }
+    else if (size > RSIZE_MAX)
+    {
+        error = ERANGE;
+        invoke_Constraint_Handler("safe_eytzinger_layout: size > RSIZE_MAX",
+                                  set_Env_Info(&envInfo, file, function, expression, line), error);
+    }
+    else if (count > RSIZE_T_C(0) && size > RSIZE_T_C(0))
+    {
+        uintptr_t destStart = M_REINTERPRET_CAST(uintptr_t, dest);
+        uintptr_t srcStart  = M_REINTERPRET_CAST(uintptr_t, src);
+        uintptr_t length    = M_STATIC_CAST(uintptr_t, count * size);
+        if (destStart < srcStart + length && srcStart < destStart + length)
+        {
+            error = EINVAL;
+            invoke_Constraint_Handler("safe_eytzinger_layout: dest and src overlap",
+                                      set_Env_Info(&envInfo, file, function, expression, line), error);
+        }
+        else
+        {
+            M_USE_UNUSED(eytzinger_fill(M_REINTERPRET_CAST(char*, dest), M_REINTERPRET_CAST(const char*, src),
+                                        SIZE_T_C(0), SIZE_T_C(0), count, size));
+        }
+    }
+    errno = error;
+    return error;
+}
+
+// Using 1-based node numbering, the path taken is recorded in the bits of k. Once k walks off the bottom of the tree,
+// the last node where the search went left (the lower bound) is found by dropping the trailing 1 bits (right turns)
+// plus one more bit. A result of 0 means every element was less than key.
+// Nodes 16 * k and up are 4 levels below the current node and are all contiguous, so they are fetched one cache line
+// ahead of the search.
+static M_INLINE size_t eytzinger_to_index(size_t k, size_t count)
+{
+    k >>= count_trailing_zeros_ull(M_STATIC_CAST(unsigned long long, ~k)) + 1U;
+    return k == SIZE_T_C(0) ? count : k - SIZE_T_C(1);
+}
+
+static M_INLINE size_t eytzinger_search(const void* M_NONNULL key,
+                                        const char* M_NONNULL base,
+                                        size_t                count,
+                                        size_t                size,
+                                        comparefn M_NONNULL   compare)
+{
+    size_t k = SIZE_T_C(1);
+    while (k <= count)
+    {
+        if (k <= count / SIZE_T_C(16))
+        {
+            M_PREFETCH_READ(base + (k * SIZE_T_C(16) - SIZE_T_C(1)) * size);
+        }
+        k = (k * SIZE_T_C(2)) + M_STATIC_CAST(size_t, compare(key, base + (k - SIZE_T_C(1)) * size) > 0);
+    }
+    return eytzinger_to_index(k, count);
+}
+
+static M_INLINE size_t eytzinger_search_context(const void* M_NONNULL  key,
+                                                const char* M_NONNULL  base,
+                                                size_t                 count,
+                                                size_t                 size,
+                                                ctxcomparefn M_NONNULL compare,
+                                                void* M_NULLABLE       context)
+{
+    size_t k = SIZE_T_C(1);
+    while (k <= count)
+    {
+        if (k <= count / SIZE_T_C(16))
+        {
+            M_PREFETCH_READ(base + (k * SIZE_T_C(16) - SIZE_T_C(1)) * size);
+        }
+        k = (k * SIZE_T_C(2)) + M_STATIC_CAST(size_t, compare(key, base + (k - SIZE_T_C(1)) * size, context) > 0);
+    }
+    return eytzinger_to_index(k, count);
+}
+
+M_PARAM_RO(1)
+M_PARAM_RO(2)
+M_PARAM_WO(6)
+CONSTRAINT_NO_DISCARD
+errno_t safe_eytzinger_lower_bound_impl(const void* M_NONNULL  key,
+                                        const void* M_NONNULL  ptr,
+                                        rsize_t                count,
+                                        rsize_t                size,
+                                        comparefn M_NONNULL    compare,
+                                        rsize_t* M_NONNULL     index,
+                                        const char* M_NULLABLE file,
+                                        const char* M_NULLABLE function,
+                                        int                    line,
+                                        const char* M_NULLABLE expression)
+{
+    errno_t error = validate_bound_search("safe_eytzinger_lower_bound", key, ptr, count, size, compare == M_NULLPTR,
+                                          index == M_NULLPTR, file, function, line, expression);
+    if (error == 0)
+    {
+        errno  = 0;
+        *index = eytzinger_search(key, M_REINTERPRET_CAST(const char*, ptr), count, size, compare);
+    }
+    return error;
+}
+
+M_PARAM_RO(1)
+M_PARAM_RO(2)
+M_PARAM_WO(7)
+CONSTRAINT_NO_DISCARD
+errno_t safe_eytzinger_lower_bound_context_impl(const void* M_NONNULL  key,
+                                                const void* M_NONNULL  ptr,
+                                                rsize_t                count,
+                                                rsize_t                size,
+                                                ctxcomparefn M_NONNULL compare,
+                                                void* M_NULLABLE       context,
+                                                rsize_t* M_NONNULL     index,
+                                                const char* M_NULLABLE file,
+                                                const char* M_NULLABLE function,
+                                                int                    line,
+                                                const char* M_NULLABLE expression)
+{
+    errno_t error = validate_bound_search("safe_eytzinger_lower_bound_context", key, ptr, count, size,
+                                          compare == M_NULLPTR, index == M_NULLPTR, file, function, line, expression);
+    if (error == 0)
+    {
+        errno  = 0;
+        *index = eytzinger_search_context(key, M_REINTERPRET_CAST(const char*, ptr), count, size, compare, context);
+    }
+    return error;
+}
+
+// Holds whichever comparison function the caller provided so that the batch searches below only need to be written
+// once. The branch on which pointer is set always goes the same way for a given call, so it predicts perfectly.
+typedef struct s_batchCompare
+{
+    comparefn M_NULLABLE    compare;
+    ctxcomparefn M_NULLABLE ctxcompare;
+    void* M_NULLABLE        context;
+} batchCompare;
+
+static M_INLINE int batch_compare(const batchCompare* M_NONNULL cmp,
+                                  const void* M_NONNULL         key,
+                                  const void* M_NONNULL         element)
+{
+    if (cmp->compare != M_NULLPTR)
+    {
+        return cmp->compare(key, element);
+    }
+    else
+    {
+        return cmp->ctxcompare(key, element, cmp->context);
+    }
+}
+
+static M_INLINE size_t batch_bound_search(const batchCompare* M_NONNULL cmp,
+                                          const void* M_NONNULL         key,
+                                          const char* M_NONNULL         base,
+                                          size_t                        count,
+                                          size_t                        size)
+{
+    if (cmp->compare != M_NULLPTR)
+    {
+        return bound_search(key, base, count, size, cmp->compare, false);
+    }
+    else
+    {
+        return bound_search_context(key, base, count, size, cmp->ctxcompare, cmp->context, false);
+    }
+}
+
+// Sorted keys: the lower bound of each key is at or after the lower bound of the previous key.
+// Gallop forward from there with doubling steps until an element that is not less than the
+// key is found, then finish with a bound search in the last window. A key that lands close to the previous one costs
+// only a few comparisons, and a key that lands far away costs about 2 * log2(distance).
+static void batch_search_sorted(const batchCompare* M_NONNULL cmp,
+                                const char* M_NONNULL         keys,
+                                size_t                        keycount,
+                                size_t                        keysize,
+                                const char* M_NONNULL         base,
+                                size_t                        count,
+                                size_t                        size,
+                                rsize_t* M_NONNULL            results)
+{
+    size_t lo = SIZE_T_C(0);
+    for (size_t keyiter = SIZE_T_C(0); keyiter < keycount; ++keyiter)
+    {
+        const char* key   = keys + keyiter * keysize;
+        size_t      start = lo;
+        size_t      end   = lo;
+        size_t      step  = SIZE_T_C(1);
+        while (end < count && batch_compare(cmp, key, base + end * size) > 0)
+        {
+            start = end + SIZE_T_C(1);
+            end   = step > count - start ? count : start + step;
+            step <<= 1;
+        }
+        // every element before start is less than key, and the element at end (if any) is not.
+        lo               = start + batch_bound_search(cmp, key, base + start * size, end - start, size);
+        results[keyiter] = lo;
+    }
+}
+
+#define BATCH_SEARCH_GROUP_SIZE 8
+
+// Unsorted keys: a branchless lower bound only depends on count to decide how many steps it takes and how large each
+// step is, so a group of keys can walk down the array in lockstep with each key keeping its own lo. The loads for the
+// keys in the group are independent so the CPU can have several cache misses in flight at once instead of one.
+static void batch_search_interleaved(const batchCompare* M_NONNULL cmp,
+                                     const char* M_NONNULL         keys,
+                                     size_t                        keycount,
+                                     size_t                        keysize,
+                                     const char* M_NONNULL         base,
+                                     size_t                        count,
+                                     size_t                        size,
+                                     rsize_t* M_NONNULL            results)
+{
+    for (size_t group = SIZE_T_C(0); group < keycount; group += BATCH_SEARCH_GROUP_SIZE)
+    {
+        size_t      lo[BATCH_SEARCH_GROUP_SIZE];
+        size_t      groupcount = keycount - group;
+        size_t      n          = count;
+        const char* groupkeys  = keys + group * keysize;
+        if (groupcount > BATCH_SEARCH_GROUP_SIZE)
+        {
+            groupcount = BATCH_SEARCH_GROUP_SIZE;
+        }
+        for (size_t iter = SIZE_T_C(0); iter < groupcount; ++iter)
+        {
+            lo[iter] = SIZE_T_C(0);
+        }
+        if (count == SIZE_T_C(0))
+        {
+            for (size_t iter = SIZE_T_C(0); iter < groupcount; ++iter)
+            {
+                results[group + iter] = SIZE_T_C(0);
+            }
+            continue;
+        }
+        while (n > SIZE_T_C(1))
+        {
+            size_t half = n >> 1;
+            for (size_t iter = SIZE_T_C(0); iter < groupcount; ++iter)
+            {
+                M_PREFETCH_READ(base + (lo[iter] + half) * size);
+            }
+            for (size_t iter = SIZE_T_C(0); iter < groupcount; ++iter)
+            {
+                const char* element = base + (lo[iter] + half) * size;
+                lo[iter] += M_STATIC_CAST(size_t, batch_compare(cmp, groupkeys + iter * keysize, element) > 0) * half;
+            }
+            n -= half;
+        }
+        for (size_t iter = SIZE_T_C(0); iter < groupcount; ++iter)
+        {
+            results[group + iter] =
+                lo[iter] +
+                M_STATIC_CAST(size_t, batch_compare(cmp, groupkeys + iter * keysize, base + lo[iter] * size) > 0);
+        }
+    }
+}
+
+static errno_t validate_batch_search(const char* M_NONNULL  name,
+                                     const void* M_NULLABLE keys,
+                                     rsize_t                keycount,
+                                     rsize_t                keysize,
+                                     const void* M_NULLABLE ptr,
+                                     rsize_t                count,
+                                     rsize_t                size,
+                                     bool                   compareIsNull,
+                                     bool                   resultsIsNull,
+                                     const char* M_NULLABLE file,
+                                     const char* M_NULLABLE function,
+                                     int                    line,
+                                     const char* M_NULLABLE expression)
+{
+    errno_t           error = 0;
+    const char*       msg   = M_NULLPTR;
+    char              fullmsg[BOUND_SEARCH_MSG_LEN];
+    constraintEnvInfo envInfo;
+    if (keycount > RSIZE_T_C(0) && keys == M_NULLPTR)
+    {
+        error = EINVAL;
+        msg   = "keycount > 0 && keys == NULL";
+    }
+    else if (keycount > RSIZE_T_C(0) && resultsIsNull)
+    {
+        error = EINVAL;
+        msg   = "keycount > 0 && results == NULL";
+    }
+    else if (count > RSIZE_T_C(0) && ptr == M_NULLPTR)
+    {
+        error = EINVAL;
+        msg   = "count > 0 && ptr == NULL";
+    }
+    else if (count > RSIZE_T_C(0) && compareIsNull)
+    {
+        error = EINVAL;
+        msg   = "count > 0 && compare == NULL";
+    }
+    else if (keycount > RSIZE_MAX)
+    {
+        error = ERANGE;
+        msg   = "keycount > RSIZE_MAX";
+    }
+    else if (keysize > RSIZE_MAX)
+    {
+        error = ERANGE;
+        msg   = "keysize > RSIZE_MAX";
+    }
+    else if (count > RSIZE_MAX)
+    {
+        error = ERANGE;
+        msg   = "count > RSIZE_MAX";
+    }
+    else if (size > RSIZE_MAX)
+    {
+        error = ERANGE;
+        msg   = "size > RSIZE_MAX";
+    }
+    if (error != 0)
+    {
+        M_USE_UNUSED(snprintf(fullmsg, BOUND_SEARCH_MSG_LEN, "%s: %s", name, msg));
+        invoke_Constraint_Handler(fullmsg, set_Env_Info(&envInfo, file, function, expression, line), error);
+        errno = error;
+    }
+    return error;
+}
+
+static void batch_search(const batchCompare* M_NONNULL cmp,
+                         const void* M_NULLABLE        keys,
+                         rsize_t                       keycount,
+                         rsize_t                       keysize,
+                         const void* M_NULLABLE        ptr,
+                         rsize_t                       count,
+                         rsize_t                       size,
+                         bool                          keysSorted,
+                         rsize_t* M_NULLABLE           results)
+{
+    if (keycount == RSIZE_T_C(0))
+    {
+        return;
+    }
+    if (keysSorted)
+    {
+        batch_search_sorted(cmp, M_REINTERPRET_CAST(const char*, keys), keycount, keysize,
+                            M_REINTERPRET_CAST(const char*, ptr), count, size, results);
+    }
+    else
+    {
+        batch_search_interleaved(cmp, M_REINTERPRET_CAST(const char*, keys), keycount, keysize,
+                                 M_REINTERPRET_CAST(const char*, ptr), count, size, results);
+    }
+}
+
+M_PARAM_RO(1)
+M_PARAM_RO(4)
+M_PARAM_WO(9)
+CONSTRAINT_NO_DISCARD
+errno_t safe_lower_bound_batch_impl(const void* M_NONNULL  keys,
+                                    rsize_t                keycount,
+                                    rsize_t                keysize,
+                                    const void* M_NONNULL  ptr,
+                                    rsize_t                count,
+                                    rsize_t                size,
+                                    comparefn M_NONNULL    compare,
+                                    bool                   keysSorted,
+                                    rsize_t* M_NONNULL     results,
+                                    const char* M_NULLABLE file,
+                                    const char* M_NULLABLE function,
+                                    int                    line,
+                                    const char* M_NULLABLE expression)
+{
+    errno_t error = validate_batch_search("safe_lower_bound_batch", keys, keycount, keysize, ptr, count, size,
+                                          compare == M_NULLPTR, results == M_NULLPTR, file, function, line, expression);
+    if (error == 0)
+    {
+        batchCompare cmp = {compare, M_NULLPTR, M_NULLPTR};
+        errno            = 0;
+        batch_search(&cmp, keys, keycount, keysize, ptr, count, size, keysSorted, results);
+    }
+    return error;
+}
+
+M_PARAM_RO(1)
+M_PARAM_RO(4)
+M_PARAM_WO(10)
+CONSTRAINT_NO_DISCARD
+errno_t safe_lower_bound_batch_context_impl(const void* M_NONNULL  keys,
+                                            rsize_t                keycount,
+                                            rsize_t                keysize,
+                                            const void* M_NONNULL  ptr,
+                                            rsize_t                count,
+                                            rsize_t                size,
+                                            ctxcomparefn M_NONNULL compare,
+                                            void* M_NULLABLE       context,
+                                            bool                   keysSorted,
+                                            rsize_t* M_NONNULL     results,
+                                            const char* M_NULLABLE file,
+                                            const char* M_NULLABLE function,
+                                            int                    line,
+                                            const char* M_NULLABLE expression)
+{
+    errno_t error = validate_batch_search("safe_lower_bound_batch_context", keys, keycount, keysize, ptr, count, size,
+                                          compare == M_NULLPTR, results == M_NULLPTR, file, function, line, expression);
+    if (error == 0)
+    {
+        batchCompare cmp = {M_NULLPTR, compare, context};
+        errno            = 0;
+        batch_search(&cmp, keys, keycount, keysize, ptr, count, size, keysSorted, results);
+    }
+    return error;
+}
@@ -23,12 +23,17 @@
 //! This software is subject to the terms of the Mozilla Public License, v. 2.0.
 //! If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include "bit_manip.h"
 #include "common_types.h"
 #include "constraint_handling.h"
+#include "impl_simd.h"
 #include "memory_safety.h"
 #include "sort_and_search.h"
 #include "type_conversion.h"
 
+#include <stdio.h>
+#include <string.h>
+
 /*
  * Initial implementation:
  * Copyright (c) 2002 Robert Drehmel
@@ -44,6 +49,280 @@ typedef enum eLworkModeEnum
     LWORK_MODE_FIND   = 0
 } eLworkMode;
 
+M_NODISCARD int compare_uint16(const void* M_NONNULL a, const void* M_NONNULL b)
+{
+    uint16_t first  = *M_REINTERPRET_CAST(const uint16_t*, a);
+    uint16_t second = *M_REINTERPRET_CAST(const uint16_t*, b);
+    return (first > second) - (first < second);
+}
+
+M_NODISCARD int compare_uint32(const void* M_NONNULL a, const void* M_NONNULL b)
+{
+    uint32_t first  = *M_REINTERPRET_CAST(const uint32_t*, a);
+    uint32_t second = *M_REINTERPRET_CAST(const uint32_t*, b);
+    return (first > second) - (first < second);
+}
+
+M_NODISCARD int compare_uint64(const void* M_NONNULL a, const void* M_NONNULL b)
+{
+    uint64_t first  = *M_REINTERPRET_CAST(const uint64_t*, a);
+    uint64_t second = *M_REINTERPRET_CAST(const uint64_t*, b);
+    return (first > second) - (first < second);
+}
+
+// The typed searches below compare one 128bit vector of elements against a broadcast copy of the key per loop.
+// SSE2 turns the compare result into a byte mask so the first matching lane comes straight from a trailing zero count.
+// NEON has no cheap movemask, so once a vector reports any match the scalar loop finishes the job from that vector.
+// Anything left over after the last full vector is also handled by the scalar loop.
+static M_INLINE size_t lfind_uint16(uint16_t key, const uint16_t* M_NONNULL base, size_t count)
+{
+    size_t iter = SIZE_T_C(0);
+#if defined(HAVE_SSE2)
+    __m128i needle = _mm_set1_epi16(M_STATIC_CAST(short, key));
+    for (; iter + SIZE_T_C(8) <= count; iter += SIZE_T_C(8))
+    {
+        __m128i elements = _mm_loadu_si128(M_REINTERPRET_CAST(const __m128i*, base + iter));
+        int     mask     = _mm_movemask_epi8(_mm_cmpeq_epi16(elements, needle));
+        if (mask != 0)
+        {
+            return iter + (count_trailing_zeros_ui(M_STATIC_CAST(unsigned int, mask)) / 2U);
+        }
+    }
+#elif defined(HAVE_NEON)
+    uint16x8_t needle = vdupq_n_u16(key);
+    for (; iter + SIZE_T_C(8) <= count; iter += SIZE_T_C(8))
+    {
+        if (neon_any_lane_set(vreinterpretq_u8_u16(vceqq_u16(vld1q_u16(base + iter), needle))))
+        {
+            break;
+        }
+    }
+#endif
+    for (; iter < count; ++iter)
+    {
+        if (base[iter] == key)
+        {
+            return iter;
+        }
+    }
+    return count;
+}
+
+static M_INLINE size_t lfind_uint32(uint32_t key, const uint32_t* M_NONNULL base, size_t count)
+{
+    size_t iter = SIZE_T_C(0);
+#if defined(HAVE_SSE2)
+    __m128i needle = _mm_set1_epi32(M_STATIC_CAST(int, key));
+    for (; iter + SIZE_T_C(4) <= count; iter += SIZE_T_C(4))
+    {
+        __m128i elements = _mm_loadu_si128(M_REINTERPRET_CAST(const __m128i*, base + iter));
+        int     mask     = _mm_movemask_epi8(_mm_cmpeq_epi32(elements, needle));
+        if (mask != 0)
+        {
+            return iter + (count_trailing_zeros_ui(M_STATIC_CAST(unsigned int, mask)) / 4U);
+        }
+    }
+#elif defined(HAVE_NEON)
+    uint32x4_t needle = vdupq_n_u32(key);
+    for (; iter + SIZE_T_C(4) <= count; iter += SIZE_T_C(4))
+    {
+        if (neon_any_lane_set(vreinterpretq_u8_u32(vceqq_u32(vld1q_u32(base + iter), needle))))
+        {
+            break;
+        }
+    }
+#endif
+    for (; iter < count; ++iter)
+    {
+        if (base[iter] == key)
+        {
+            return iter;
+        }
+    }
+    return count;
+}
+
+// Neither SSE2 nor 32bit NEON can compare 64bit lanes, so compare 32bit halves and require both halves of a lane to
+// match by ANDing the result with a copy that has the halves swapped.
+static M_INLINE size_t lfind_uint64(uint64_t key, const uint64_t* M_NONNULL base, size_t count)
+{
+    size_t iter = SIZE_T_C(0);
+#if defined(HAVE_SSE2)
+    int     keylow  = M_STATIC_CAST(int, M_STATIC_CAST(uint32_t, key));
+    int     keyhigh = M_STATIC_CAST(int, M_STATIC_CAST(uint32_t, key >> 32));
+    __m128i needle  = _mm_set_epi32(keyhigh, keylow, keyhigh, keylow);
+    for (; iter + SIZE_T_C(2) <= count; iter += SIZE_T_C(2))
+    {
+        __m128i elements = _mm_loadu_si128(M_REINTERPRET_CAST(const __m128i*, base + iter));
+        __m128i halves   = _mm_cmpeq_epi32(elements, needle);
+        __m128i lanes    = _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+        int     mask     = _mm_movemask_epi8(lanes);
+        if (mask != 0)
+        {
+            return iter + (count_trailing_zeros_ui(M_STATIC_CAST(unsigned int, mask)) / 8U);
+        }
+    }
+#elif defined(HAVE_NEON)
+    uint32x4_t needle = vreinterpretq_u32_u64(vdupq_n_u64(key));
+    for (; iter + SIZE_T_C(2) <= count; iter += SIZE_T_C(2))
+    {
+        uint32x4_t halves = vceqq_u32(vreinterpretq_u32_u64(vld1q_u64(base + iter)), needle);
+        if (neon_any_lane_set(vreinterpretq_u8_u32(vandq_u32(halves, vrev64q_u32(halves)))))
+        {
+            break;
+        }
+    }
+#endif
+    for (; iter < count; ++iter)
+    {
+        if (base[iter] == key)
+        {
+            return iter;
+        }
+    }
+    return count;
+}
+
+static errno_t validate_typed_lfind(const char* M_NONNULL  name,
+                                    const void* M_NULLABLE base,
+                                    rsize_t                count,
+                                    bool                   indexIsNull,
+                                    const char* M_NULLABLE file,
+                                    const char* M_NULLABLE function,
+                                    int                    line,
+                                    const char* M_NULLABLE expression)
+{
+    errno_t           error = 0;
+    const char*       msg   = M_NULLPTR;
+    char              fullmsg[64];
+    constraintEnvInfo envInfo;
+    if (indexIsNull)
+    {
+        error = EINVAL;
+        msg   = "index == NULL";
+    }
+    else if (count > RSIZE_T_C(0) && base == M_NULLPTR)
+    {
+        error = EINVAL;
+        msg   = "count > 0 && base == NULL";
+    }
+    else if (count > RSIZE_MAX)
+    {
+        error = ERANGE;
+        msg   = "count > RSIZE_MAX";
+    }
+    if (error != 0)
+    {
+        M_USE_UNUSED(snprintf(fullmsg, sizeof(fullmsg), "%s: %s", name, msg));
+        invoke_Constraint_Handler(fullmsg, set_Env_Info(&envInfo, file, function, expression, line), error);
+    }
+    errno = error;
+    return error;
+}
+
+M_PARAM_RO(2)
+M_PARAM_WO(4)
+CONSTRAINT_NO_DISCARD
+errno_t safe_lfind_uint16_impl(uint16_t                  key,
+                               const uint16_t* M_NONNULL base,
+                               rsize_t                   count,
+                               rsize_t* M_NONNULL        index,
+                               const char* M_NULLABLE    file,
+                               const char* M_NULLABLE    function,
+                               int                       line,
+                               const char* M_NULLABLE    expression)
+{
+    errno_t error =
+        validate_typed_lfind("safe_lfind_uint16", base, count, index == M_NULLPTR, file, function, line, expression);
+    if (error == 0)
+    {
+        *index = count > RSIZE_T_C(0) ? lfind_uint16(key, base, count) : RSIZE_T_C(0);
+    }
+    return error;
+}
+
+M_PARAM_RO(2)
+M_PARAM_WO(4)
+CONSTRAINT_NO_DISCARD
+errno_t safe_lfind_uint32_impl(uint32_t                  key,
+                               const uint32_t* M_NONNULL base,
+                               rsize_t                   count,
+                               rsize_t* M_NONNULL        index,
+                               const char* M_NULLABLE    file,
+                               const char* M_NULLABLE    function,
+                               int                       line,
+                               const char* M_NULLABLE    expression)
+{
+    errno_t error =
+        validate_typed_lfind("safe_lfind_uint32", base, count, index == M_NULLPTR, file, function, line, expression);
+    if (error == 0)
+    {
+        *index = count > RSIZE_T_C(0) ? lfind_uint32(key, base, count) : RSIZE_T_C(0);
+    }
+    return error;
+}
+
+M_PARAM_RO(2)
+M_PARAM_WO(4)
+CONSTRAINT_NO_DISCARD
+errno_t safe_lfind_uint64_impl(uint64_t                  key,
+                               const uint64_t* M_NONNULL base,
+                               rsize_t                   count,
+                               rsize_t* M_NONNULL        index,
+                               const char* M_NULLABLE    file,
+                               const char* M_NULLABLE    function,
+                               int                       line,
+                               const char* M_NULLABLE    expression)
+{
+    errno_t error =
+        validate_typed_lfind("safe_lfind_uint64", base, count, index == M_NULLPTR, file, function, line, expression);
+    if (error == 0)
+    {
+        *index = count > RSIZE_T_C(0) ? lfind_uint64(key, base, count) : RSIZE_T_C(0);
+    }
+    return error;
+}
+
+// safe_lfind and safe_lsearch use the typed searches above when the caller passed one of the library's integer
+// comparison functions with a matching width, since those can only ever report equality for identical values.
+// Returns false when the generic comparison loop must be used instead. The key may be unaligned so it is copied out.
+static bool lfind_plain_equality(const void* M_NONNULL key,
+                                 const void* M_NONNULL base,
+                                 rsize_t               count,
+                                 rsize_t               width,
+                                 comparefn M_NONNULL   compar,
+                                 rsize_t* M_NONNULL    index)
+{
+    bool handled = true;
+    if (count == RSIZE_T_C(0) || (M_REINTERPRET_CAST(uintptr_t, base) % width) != 0)
+    {
+        handled = false;
+    }
+    else if (compar == compare_uint16 && width == sizeof(uint16_t))
+    {
+        uint16_t value = UINT16_C(0);
+        memcpy(&value, key, sizeof(value));
+        *index = lfind_uint16(value, M_REINTERPRET_CAST(const uint16_t*, base), count);
+    }
+    else if (compar == compare_uint32 && width == sizeof(uint32_t))
+    {
+        uint32_t value = UINT32_C(0);
+        memcpy(&value, key, sizeof(value));
+        *index = lfind_uint32(value, M_REINTERPRET_CAST(const uint32_t*, base), count);
+    }
+    else if (compar == compare_uint64 && width == sizeof(uint64_t))
+    {
+        uint64_t value = UINT64_C(0);
+        memcpy(&value, key, sizeof(value));
+        *index = lfind_uint64(value, M_REINTERPRET_CAST(const uint64_t*, base), count);
+    }
+    else
+    {
+        handled = false;
+    }
+    return handled;
+}
+
 M_PARAM_RO(1)
 M_PARAM_RO(2)
 M_PARAM_RW(3)
@@ -223,9 +502,15 @@ static void* M_NULLABLE safe_lwork(const void* M_NONNULL  key,
     }
     else
     {
-        uint8_t* ep   = M_CONST_CAST(uint8_t*, M_REINTERPRET_CAST(const uint8_t*, base));
-        uint8_t* endp = M_NULLPTR;
-        for (endp = M_REINTERPRET_CAST(uint8_t*, ep + width * (*nelp)); ep < endp; ep += width)
+        uint8_t* ep         = M_CONST_CAST(uint8_t*, M_REINTERPRET_CAST(const uint8_t*, base));
+        uint8_t* endp       = M_REINTERPRET_CAST(uint8_t*, ep + width * (*nelp));
+        rsize_t  matchIndex = RSIZE_T_C(0);
+        if (lfind_plain_equality(key, base, *nelp, width, compar, &matchIndex))
+        {
+            // On no match this lands on endp so the loop below is skipped.
+            ep += matchIndex * width;
+        }
+        for (; ep < endp; ep += width)
         {
             if (compar(key, ep) == 0)
             {
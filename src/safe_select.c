@@ -0,0 +1,535 @@
+// SPDX-License-Identifier: MPL-2.0
+
+//! \file safe_select.c
+//! \brief Defines bounds checked selection functions: safe_nth_element, safe_partial_sort, and safe_top_k.
+//!
+//! \details These answer questions like "what is the median" or "which 100 commands were slowest" without paying for
+//! a full sort. safe_nth_element uses introselect (quickselect with a heapsort fallback), safe_partial_sort selects
+//! and then heapsorts only the requested prefix, and safe_top_k streams the input through a k element min-heap.
+//! \copyright
+//! Do NOT modify or remove this copyright and license
+//!
+//! Copyright (c) 2026 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//!
+//! This software is subject to the terms of the Mozilla Public License, v. 2.0.
+//! If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "bit_manip.h"
+#include "code_attributes.h"
+#include "common_types.h"
+#include "constraint_handling.h"
+#include "sort_and_search.h"
+#include "type_conversion.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define SELECT_MSG_LEN             96
+#define SELECT_INSERTION_THRESHOLD SIZE_T_C(16)
+
+// Holds whichever comparison function the caller provided so each algorithm only needs to be written once.
+typedef struct s_selectCompare
+{
+    comparefn M_NULLABLE    compare;
+    ctxcomparefn M_NULLABLE ctxcompare;
+    void* M_NULLABLE        context;
+} selectCompare;
+
+static M_INLINE int select_compare(const selectCompare* M_NONNULL cmp,
+                                   const void* M_NONNULL          a,
+                                   const void* M_NONNULL          b)
+{
+    if (cmp->compare != M_NULLPTR)
+    {
+        return cmp->compare(a, b);
+    }
+    else
+    {
+        return cmp->ctxcompare(a, b, cmp->context);
+    }
+}
+
+static M_INLINE void swap_elements(char* M_NONNULL a, char* M_NONNULL b, size_t size)
+{
+    if (a != b)
+    {
+        for (size_t iter = SIZE_T_C(0); iter < size; ++iter)
+        {
+            char temp = a[iter];
+            a[iter]   = b[iter];
+            b[iter]   = temp;
+        }
+    }
+}
+
+static void insertion_sort(char* M_NONNULL base, size_t count, size_t size, const selectCompare* M_NONNULL cmp)
+{
+    for (size_t outer = SIZE_T_C(1); outer < count; ++outer)
+    {
+        for (size_t inner = outer;
+             inner > SIZE_T_C(0) && select_compare(cmp, base + (inner - SIZE_T_C(1)) * size, base + inner * size) > 0;
+             --inner)
+        {
+            swap_elements(base + (inner - SIZE_T_C(1)) * size, base + inner * size, size);
+        }
+    }
+}
+
+// Restores the heap property below root. With minHeap false the largest element is kept at the root, otherwise the
+// smallest.
+static void sift_down(char* M_NONNULL                base,
+                      size_t                         root,
+                      size_t                         count,
+                      size_t                         size,
+                      const selectCompare* M_NONNULL cmp,
+                      bool                           minHeap)
+{
+    for (;;)
+    {
+        size_t child = root * SIZE_T_C(2) + SIZE_T_C(1);
+        if (child >= count)
+        {
+            break;
+        }
+        if (child + SIZE_T_C(1) < count)
+        {
+            int order = select_compare(cmp, base + (child + SIZE_T_C(1)) * size, base + child * size);
+            if (minHeap ? order < 0 : order > 0)
+            {
+                ++child;
+            }
+        }
+        int order = select_compare(cmp, base + child * size, base + root * size);
+        if (minHeap ? order >= 0 : order <= 0)
+        {
+            break;
+        }
+        swap_elements(base + root * size, base + child * size, size);
+        root = child;
+    }
+}
+
+static void build_heap(char* M_NONNULL                base,
+                       size_t                         count,
+                       size_t                         size,
+                       const selectCompare* M_NONNULL cmp,
+                       bool                           minHeap)
+{
+    for (size_t parent = count / SIZE_T_C(2); parent > SIZE_T_C(0); --parent)
+    {
+        sift_down(base, parent - SIZE_T_C(1), count, size, cmp, minHeap);
+    }
+}
+
+// Repeatedly moves the root to the end of the shrinking heap. A max heap ends up in ascending order and a min heap
+// ends up in descending order.
+static void sort_heap(char* M_NONNULL                base,
+                      size_t                         count,
+                      size_t                         size,
+                      const selectCompare* M_NONNULL cmp,
+                      bool                           minHeap)
+{
+    for (size_t end = count; end > SIZE_T_C(1); --end)
+    {
+        swap_elements(base, base + (end - SIZE_T_C(1)) * size, size);
+        sift_down(base, SIZE_T_C(0), end - SIZE_T_C(1), size, cmp, minHeap);
+    }
+}
+
+static M_INLINE char* M_NONNULL median_of_three(char* M_NONNULL                a,
+                                                char* M_NONNULL                b,
+                                                char* M_NONNULL                c,
+                                                const selectCompare* M_NONNULL cmp)
+{
+    if (select_compare(cmp, a, b) < 0)
+    {
+        if (select_compare(cmp, b, c) < 0)
+        {
+            return b;
+        }
+        return select_compare(cmp, a, c) < 0 ? c : a;
+    }
+    if (select_compare(cmp, b, c) > 0)
+    {
+        return b;
+    }
+    return select_compare(cmp, a, c) > 0 ? c : a;
+}
+
+// Introselect. Each pass partitions around a median of three (Tukey's ninther for larger ranges, same as safe_qsort)
+// and keeps only the side that holds nth. If the depth budget of 2 * log2(count) passes runs out, the remaining range
+// is heapsorted so the worst case stays O(count log count).
+static void introselect(char* M_NONNULL                base,
+                        size_t                         count,
+                        size_t                         size,
+                        size_t                         nth,
+                        const selectCompare* M_NONNULL cmp)
+{
+    size_t depth = SIZE_T_C(2) * (SIZE_T_C(63) - count_leading_zeros_ull(M_STATIC_CAST(unsigned long long, count)));
+    while (count > SELECT_INSERTION_THRESHOLD)
+    {
+        char*  pivot = M_NULLPTR;
+        size_t lo    = SIZE_T_C(0);
+        size_t hi    = count;
+        if (depth == SIZE_T_C(0))
+        {
+            build_heap(base, count, size, cmp, false);
+            sort_heap(base, count, size, cmp, false);
+            return;
+        }
+        --depth;
+        {
+            char* first  = base;
+            char* middle = base + (count / SIZE_T_C(2)) * size;
+            char* last   = base + (count - SIZE_T_C(1)) * size;
+            if (count > SIZE_T_C(40))
+            {
+                size_t step = (count / SIZE_T_C(8)) * size;
+                first       = median_of_three(first, first + step, first + SIZE_T_C(2) * step, cmp);
+                middle      = median_of_three(middle - step, middle, middle + step, cmp);
+                last        = median_of_three(last - SIZE_T_C(2) * step, last - step, last, cmp);
+            }
+            pivot = median_of_three(first, middle, last, cmp);
+        }
+        swap_elements(base, pivot, size);
+        // Hoare partition with the pivot at index 0. Both scans stop on elements equal to the pivot, which keeps the
+        // split balanced when there are many duplicates.
+        for (;;)
+        {
+            do
+            {
+                ++lo;
+            } while (lo < count && select_compare(cmp, base + lo * size, base) < 0);
+            do
+            {
+                --hi;
+            } while (select_compare(cmp, base + hi * size, base) > 0);
+            if (lo >= hi)
+            {
+                break;
+            }
+            swap_elements(base + lo * size, base + hi * size, size);
+        }
+        swap_elements(base, base + hi * size, size);
+        if (nth == hi)
+        {
+            return;
+        }
+        else if (nth < hi)
+        {
+            count = hi;
+        }
+        else
+        {
+            base += (hi + SIZE_T_C(1)) * size;
+            nth -= hi + SIZE_T_C(1);
+            count -= hi + SIZE_T_C(1);
+        }
+    }
+    insertion_sort(base, count, size, cmp);
+}
+
+static void partial_sort(char* M_NONNULL                base,
+                         size_t                         count,
+                         size_t                         size,
+                         size_t                         middle,
+                         const selectCompare* M_NONNULL cmp)
+{
+    if (middle == SIZE_T_C(0))
+    {
+        return;
+    }
+    if (middle < count)
+    {
+        // Element middle - 1 is now the largest of the prefix and already in place.
+        introselect(base, count, size, middle - SIZE_T_C(1), cmp);
+        --middle;
+    }
+    build_heap(base, middle, size, cmp, false);
+    sort_heap(base, middle, size, cmp, false);
+}
+
+static void top_k(char* M_NONNULL                dest,
+                  size_t                         k,
+                  const char* M_NONNULL          src,
+                  size_t                         count,
+                  size_t                         size,
+                  const selectCompare* M_NONNULL cmp)
+{
+    if (k == SIZE_T_C(0))
+    {
+        return;
+    }
+    memcpy(dest, src, k * size);
+    build_heap(dest, k, size, cmp, true);
+    for (size_t iter = k; iter < count; ++iter)
+    {
+        const char* element = src + iter * size;
+        // dest[0] is the smallest of the k largest so far. Anything larger replaces it.
+        if (select_compare(cmp, element, dest) > 0)
+        {
+            memcpy(dest, element, size);
+            sift_down(dest, SIZE_T_C(0), k, size, cmp, true);
+        }
+    }
+    sort_heap(dest, k, size, cmp, true);
+}
+
+// Common parameter validation for safe_nth_element and safe_partial_sort.
+// position is nth or middle and positionLimit is the largest allowed value for it.
+static errno_t validate_select(const char* M_NONNULL  name,
+                               const void* M_NULLABLE ptr,
+                               rsize_t                count,
+                               rsize_t                size,
+                               bool                   compareIsNull,
+                               rsize_t                position,
+                               rsize_t                positionLimit,
+                               const char* M_NONNULL  positionMsg,
+                               const char* M_NULLABLE file,
+                               const char* M_NULLABLE function,
+                               int                    line,
+                               const char* M_NULLABLE expression)
+{
+    errno_t           error = 0;
+    const char*       msg   = M_NULLPTR;
+    char              fullmsg[SELECT_MSG_LEN];
+    constraintEnvInfo envInfo;
+    if (count > RSIZE_T_C(0) && ptr == M_NULLPTR)
+    {
+        error = EINVAL;
+        msg   = "count > 0 && ptr == NULL";
+    }
+    else if (count > RSIZE_T_C(0) && compareIsNull)
+    {
+        error = EINVAL;
+        msg   = "count > 0 && compare == NULL";
+    }
+    else if (count > RSIZE_MAX)
+    {
+        error = ERANGE;
+        msg   = "count > RSIZE_MAX";
+    }
+    else if (size > RSIZE_MAX)
+    {
+        error = ERANGE;
+        msg   = "size > RSIZE_MAX";
+    }
+    else if (position > positionLimit)
+    {
+        error = ERANGE;
+        msg   = positionMsg;
+    }
+    if (error != 0)
+    {
+        M_USE_UNUSED(snprintf(fullmsg, SELECT_MSG_LEN, "%s: %s", name, msg));
+        invoke_Constraint_Handler(fullmsg, set_Env_Info(&envInfo, file, function, expression, line), error);
+    }
+    errno = error;
+    return error;
+}
+
+// dest is passed as an address since it is write-only and is only checked for null and overlap here.
+static errno_t validate_top_k(const char* M_NONNULL  name,
+                              uintptr_t              destStart,
+                              rsize_t                k,
+                              const void* M_NULLABLE ptr,
+                              rsize_t                count,
+                              rsize_t                size,
+                              bool                   compareIsNull,
+                              const char* M_NULLABLE file,
+                              const char* M_NULLABLE function,
+                              int                    line,
+                              const char* M_NULLABLE expression)
+{
+    errno_t           error = 0;
+    const char*       msg   = M_NULLPTR;
+    char              fullmsg[SELECT_MSG_LEN];
+    constraintEnvInfo envInfo;
+    if (k > RSIZE_T_C(0) && destStart == 0)
+    {
+        error = EINVAL;
+        msg   = "k > 0 && dest == NULL";
+    }
+    else if (k > RSIZE_T_C(0) && ptr == M_NULLPTR)
+    {
+        error = EINVAL;
+        msg   = "k > 0 && ptr == NULL";
+    }
+    else if (k > RSIZE_T_C(0) && compareIsNull)
+    {
+        error = EINVAL;
+        msg   = "k > 0 && compare == NULL";
+    }
+    else if (k > RSIZE_MAX || count > RSIZE_MAX || size > RSIZE_MAX ||
+             (size > RSIZE_T_C(0) && k > RSIZE_MAX / size))
+    {
+        error = ERANGE;
+        msg   = "k, count, or size > RSIZE_MAX";
+    }
+    else if (k > count)
+    {
+        error = ERANGE;
+        msg   = "k > count";
+    }
+    else if (k > RSIZE_T_C(0) && size > RSIZE_T_C(0))
+    {
+        uintptr_t srcStart = M_REINTERPRET_CAST(uintptr_t, ptr);
+        uintptr_t destLen  = M_STATIC_CAST(uintptr_t, k * size);
+        uintptr_t srcLen   = M_STATIC_CAST(uintptr_t, count * size);
+        if (destStart < srcStart + srcLen && srcStart < destStart + destLen)
+        {
+            error = EINVAL;
+            msg   = "dest and ptr overlap";
+        }
+    }
+    if (error != 0)
+    {
+        M_USE_UNUSED(snprintf(fullmsg, SELECT_MSG_LEN, "%s: %s", name, msg));
+        invoke_Constraint_Handler(fullmsg, set_Env_Info(&envInfo, file, function, expression, line), error);
+    }
+    errno = error;
+    return error;
+}
+
+M_PARAM_RW(1)
+CONSTRAINT_NO_DISCARD
+errno_t safe_nth_element_impl(void* M_NONNULL        ptr,
+                              rsize_t                count,
+                              rsize_t                size,
+                              rsize_t                nth,
+                              comparefn M_NONNULL    compare,
+                              const char* M_NULLABLE file,
+                              const char* M_NULLABLE function,
+                              int                    line,
+                              const char* M_NULLABLE expression)
+{
+    errno_t error =
+        validate_select("safe_nth_element", ptr, count, size, compare == M_NULLPTR, nth,
+                        count > RSIZE_T_C(0) ? count - RSIZE_T_C(1) : RSIZE_MAX, "nth >= count", file, function, line,
+                        expression);
+    if (error == 0 && count > RSIZE_T_C(1))
+    {
+        selectCompare cmp = {compare, M_NULLPTR, M_NULLPTR};
+        introselect(M_REINTERPRET_CAST(char*, ptr), count, size, nth, &cmp);
+    }
+    return error;
+}
+
+M_PARAM_RW(1)
+CONSTRAINT_NO_DISCARD
+errno_t safe_nth_element_context_impl(void* M_NONNULL        ptr,
+                                      rsize_t                count,
+                                      rsize_t                size,
+                                      rsize_t                nth,
+                                      ctxcomparefn M_NONNULL compare,
+                                      void* M_NULLABLE       context,
+                                      const char* M_NULLABLE file,
+                                      const char* M_NULLABLE function,
+                                      int                    line,
+                                      const char* M_NULLABLE expression)
+{
+    errno_t error =
+        validate_select("safe_nth_element_context", ptr, count, size, compare == M_NULLPTR, nth,
+                        count > RSIZE_T_C(0) ? count - RSIZE_T_C(1) : RSIZE_MAX, "nth >= count", file, function, line,
+                        expression);
+    if (error == 0 && count > RSIZE_T_C(1))
+    {
+        selectCompare cmp = {M_NULLPTR, compare, context};
+        introselect(M_REINTERPRET_CAST(char*, ptr), count, size, nth, &cmp);
+    }
+    return error;
+}
+
+M_PARAM_RW(1)
+CONSTRAINT_NO_DISCARD
+errno_t safe_partial_sort_impl(void* M_NONNULL        ptr,
+                               rsize_t                count,
+                               rsize_t                size,
+                               rsize_t                middle,
+                               comparefn M_NONNULL    compare,
+                               const char* M_NULLABLE file,
+                               const char* M_NULLABLE function,
+                               int                    line,
+                               const char* M_NULLABLE expression)
+{
+    errno_t error = validate_select("safe_partial_sort", ptr, count, size, compare == M_NULLPTR, middle, count,
+                                    "middle > count", file, function, line, expression);
+    if (error == 0 && count > RSIZE_T_C(1))
+    {
+        selectCompare cmp = {compare, M_NULLPTR, M_NULLPTR};
+        partial_sort(M_REINTERPRET_CAST(char*, ptr), count, size, middle, &cmp);
+    }
+    return error;
+}
+
+M_PARAM_RW(1)
+CONSTRAINT_NO_DISCARD
+errno_t safe_partial_sort_context_impl(void* M_NONNULL        ptr,
+                                       rsize_t                count,
+                                       rsize_t                size,
+                                       rsize_t                middle,
+                                       ctxcomparefn M_NONNULL compare,
+                                       void* M_NULLABLE       context,
+                                       const char* M_NULLABLE file,
+                                       const char* M_NULLABLE function,
+                                       int                    line,
+                                       const char* M_NULLABLE expression)
+{
+    errno_t error = validate_select("safe_partial_sort_context", ptr, count, size, compare == M_NULLPTR, middle,
+                                    count, "middle > count", file, function, line, expression);
+    if (error == 0 && count > RSIZE_T_C(1))
+    {
+        selectCompare cmp = {M_NULLPTR, compare, context};
+        partial_sort(M_REINTERPRET_CAST(char*, ptr), count, size, middle, &cmp);
+    }
+    return error;
+}
+
+M_PARAM_WO(1)
+M_PARAM_RO(3)
+CONSTRAINT_NO_DISCARD
+errno_t safe_top_k_impl(void* M_NONNULL        dest,
+                        rsize_t                k,
+                        const void* M_NONNULL  ptr,
+                        rsize_t                count,
+                        rsize_t                size,
+                        comparefn M_NONNULL    compare,
+                        const char* M_NULLABLE file,
+                        const char* M_NULLABLE function,
+                        int                    line,
+                        const char* M_NULLABLE expression)
+{
+    errno_t error = validate_top_k("safe_top_k", M_REINTERPRET_CAST(uintptr_t, dest), k, ptr, count, size,
+                                   compare == M_NULLPTR, file, function, line, expression);
+    if (error == 0)
+    {
+        selectCompare cmp = {compare, M_NULLPTR, M_NULLPTR};
+        top_k(M_REINTERPRET_CAST(char*, dest), k, M_REINTERPRET_CAST(const char*, ptr), count, size, &cmp);
+    }
+    return error;
+}
+
+M_PARAM_WO(1)
+M_PARAM_RO(3)
+CONSTRAINT_NO_DISCARD
+errno_t safe_top_k_context_impl(void* M_NONNULL        dest,
+                                rsize_t                k,
+                                const void* M_NONNULL  ptr,
+                                rsize_t                count,
+                                rsize_t                size,
+                                ctxcomparefn M_NONNULL compare,
+                                void* M_NULLABLE       context,
+                                const char* M_NULLABLE file,
+                                const char* M_NULLABLE function,
+                                int                    line,
+                                const char* M_NULLABLE expression)
+{
+    errno_t error = validate_top_k("safe_top_k_context", M_REINTERPRET_CAST(uintptr_t, dest), k, ptr, count, size,
+                                   compare == M_NULLPTR, file, function, line, expression);
+    if (error == 0)
+    {
+        selectCompare cmp = {M_NULLPTR, compare, context};
+        top_k(M_REINTERPRET_CAST(char*, dest), k, M_REINTERPRET_CAST(const char*, ptr), count, size, &cmp);
+    }
+    return error;
+}
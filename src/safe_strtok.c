@@ -17,6 +17,10 @@
 //! - added strmax parameter
 //!
 //! - call constraint handler for errors detected per C11 Annex K
+//!
+//! - delimiters are looked up in a 256bit map instead of rescanning \a delim for every character
+//!
+//! - added span_Tokenizer_Init and span_Tokenizer_Next for tokenizing read only buffers without modifying them
 //! \copyright
 //! Do NOT modify or remove this copyright and license
 //!
@@ -25,13 +29,17 @@
 //! This software is subject to the terms of the Mozilla Public License, v. 2.0.
 //! If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include "bit_manip.h"
 #include "code_attributes.h"
 #include "common_types.h"
 #include "constraint_handling.h"
+#include "impl_simd.h"
+#include "memory_safety.h"
 #include "sort_and_search.h"
 #include "string_utils.h"
 #include "type_conversion.h"
 
+#include <limits.h>
 #include <stdio.h>
 
 /*-
@@ -70,6 +78,27 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+// One bit per possible byte value. Looking a character up is a shift and mask regardless of how many delimiters there
+// are, where the original code rescanned the delimiter string for every character of the input.
+#define DELIMITER_MAP_WORDS SIZE_T_C(4)
+
+static M_INLINE void build_delimiter_map(uint64_t map[DELIMITER_MAP_WORDS], const char* M_NONNULL delim)
+{
+    map[0] = UINT64_C(0);
+    map[1] = UINT64_C(0);
+    map[2] = UINT64_C(0);
+    map[3] = UINT64_C(0);
+    for (const unsigned char* iter = M_REINTERPRET_CAST(const unsigned char*, delim); *iter != 0; ++iter)
+    {
+        map[*iter >> 6] |= UINT64_C(1) << (*iter & 63U);
+    }
+}
+
+static M_INLINE bool is_delimiter(const uint64_t map[DELIMITER_MAP_WORDS], unsigned char c)
+{
+    return ((map[c >> 6] >> (c & 63U)) & UINT64_C(1)) != UINT64_C(0);
+}
+
 M_PARAM_RW(1)
 M_PARAM_RW(2)
 M_PARAM_RO(3)
@@ -86,11 +115,10 @@ char* M_NULLABLE safe_strtok_impl(char* M_RESTRICT M_NULLABLE            str,
                                   int                                    line,
                                   const char* M_NULLABLE                 expression)
 {
-    char*             spanp = M_NULLPTR;
     char*             tok   = M_NULLPTR;
     int               c     = 0;
-    int               sc    = 0;
     errno_t           error = 0;
+    uint64_t          delimiters[DELIMITER_MAP_WORDS];
     constraintEnvInfo envInfo;
     if (strmax == M_NULLPTR)
     {
@@ -173,24 +201,13 @@ char* M_NULLABLE safe_strtok_impl(char* M_RESTRICT M_NULLABLE            str,
     // Seagate modification:
     // This code previously used a goto.
     // In order to stay within bounds of str, this was removed to check strmax > 0 each time through.
+    // The delimiters are looked up in a bitmap built once per call rather than rescanning delim for each character.
+    build_delimiter_map(delimiters, delim);
     while (*strmax > RSIZE_T_C(0))
     {
-        bool breakdelimloop = false;
-        c                   = C_CAST(unsigned char, *str++);
+        c = C_CAST(unsigned char, *str++);
         *strmax -= RSIZE_T_C(1); // Seagate modification
-        for (spanp = M_CONST_CAST(char*, delim); (sc = C_CAST(unsigned char, *spanp++)) != 0 && !breakdelimloop;)
-        {
-            if (c == sc)
-            {
-                breakdelimloop = true;
-                break;
-            }
-        }
-        if (breakdelimloop)
-        {
-            continue;
-        }
-        else
+        if (c == 0 || !is_delimiter(delimiters, C_CAST(unsigned char, c)))
         {
             break;
         }
@@ -229,23 +246,17 @@ char* M_NULLABLE safe_strtok_impl(char* M_RESTRICT M_NULLABLE            str,
     {
         c = C_CAST(unsigned char, *str++);
         *strmax -= RSIZE_T_C(1); // Seagate modification
-        spanp = M_CONST_CAST(char*, delim);
-        do
+        if (c == 0)
         {
-            if ((sc = C_CAST(unsigned char, *spanp++)) == c)
-            {
-                if (c == 0)
-                {
-                    str = M_NULLPTR;
-                }
-                else
-                {
-                    str[-1] = '\0';
-                }
-                *saveptr = str;
-                return (tok);
-            }
-        } while (sc != 0);
+            *saveptr = M_NULLPTR;
+            return (tok);
+        }
+        else if (is_delimiter(delimiters, C_CAST(unsigned char, c)))
+        {
+            str[-1]  = '\0';
+            *saveptr = str;
+            return (tok);
+        }
     }
     // Seagate modification
     // If this is reached then end of the string was reached without a null terminator then this is an error
@@ -259,3 +270,152 @@ char* M_NULLABLE safe_strtok_impl(char* M_RESTRICT M_NULLABLE            str,
     errno = error;
     return M_NULLPTR;
 }
+
+// Returns the offset of the first byte at or after offset that is a delimiter when wantDelimiter is true, or that is
+// not a delimiter when wantDelimiter is false. Returns the buffer length when there is no such byte.
+// Small delimiter sets, which covers whitespace, commas, colons, and newlines, are compared against 16 bytes at once.
+// SSE2 gives the exact position from a byte mask. NEON only reports that a block has a hit and the table lookup loop
+// finds it.
+static M_INLINE size_t span_scan(const spanTokenizer* M_NONNULL tokenizer, size_t offset, bool wantDelimiter)
+{
+    const unsigned char* data   = M_REINTERPRET_CAST(const unsigned char*, tokenizer->data);
+    size_t               length = tokenizer->length;
+    uint8_t              count  = tokenizer->vectorDelimiterCount;
+#if defined(HAVE_SSE2)
+    if (count > 0)
+    {
+        __m128i      needles[SPAN_TOKENIZER_VECTOR_DELIMITERS];
+        unsigned int flip = wantDelimiter ? 0U : 0xFFFFU;
+        for (uint8_t iter = UINT8_C(0); iter < count; ++iter)
+        {
+            needles[iter] = _mm_set1_epi8(tokenizer->vectorDelimiters[iter]);
+        }
+        for (; offset + SIZE_T_C(16) <= length; offset += SIZE_T_C(16))
+        {
+            __m128i block   = _mm_loadu_si128(M_REINTERPRET_CAST(const __m128i*, data + offset));
+            __m128i matched = _mm_cmpeq_epi8(block, needles[0]);
+            for (uint8_t iter = UINT8_C(1); iter < count; ++iter)
+            {
+                matched = _mm_or_si128(matched, _mm_cmpeq_epi8(block, needles[iter]));
+            }
+            unsigned int mask = M_STATIC_CAST(unsigned int, _mm_movemask_epi8(matched)) ^ flip;
+            if (mask != 0U)
+            {
+                return offset + M_STATIC_CAST(size_t, count_trailing_zeros_ui(mask));
+            }
+        }
+    }
+#elif defined(HAVE_NEON)
+    if (count > 0)
+    {
+        uint8x16_t needles[SPAN_TOKENIZER_VECTOR_DELIMITERS];
+        for (uint8_t iter = UINT8_C(0); iter < count; ++iter)
+        {
+            needles[iter] = vdupq_n_u8(M_STATIC_CAST(uint8_t, tokenizer->vectorDelimiters[iter]));
+        }
+        for (; offset + SIZE_T_C(16) <= length; offset += SIZE_T_C(16))
+        {
+            uint8x16_t block   = vld1q_u8(data + offset);
+            uint8x16_t matched = vceqq_u8(block, needles[0]);
+            for (uint8_t iter = UINT8_C(1); iter < count; ++iter)
+            {
+                matched = vorrq_u8(matched, vceqq_u8(block, needles[iter]));
+            }
+            if (!wantDelimiter)
+            {
+                matched = vmvnq_u8(matched);
+            }
+            if (neon_any_lane_set(matched))
+            {
+                break;
+            }
+        }
+    }
+#else
+    M_USE_UNUSED(count);
+#endif
+    for (; offset < length; ++offset)
+    {
+        if (is_delimiter(tokenizer->delimiterMap, data[offset]) == wantDelimiter)
+        {
+            return offset;
+        }
+    }
+    return length;
+}
+
+M_PARAM_WO(1)
+M_PARAM_RO_SIZE(2, 3)
+M_PARAM_RO(4)
+M_NULL_TERM_STRING(4)
+errno_t span_Tokenizer_Init(spanTokenizer* M_NONNULL tokenizer,
+                            const char* M_NULLABLE   data,
+                            size_t                   length,
+                            const char* M_NONNULL    delim,
+                            bool                     collapseDelimiters)
+{
+    if (tokenizer == M_NULLPTR || delim == M_NULLPTR || (data == M_NULLPTR && length != SIZE_T_C(0)))
+    {
+        return EINVAL;
+    }
+    tokenizer->data                 = data != M_NULLPTR ? data : "";
+    tokenizer->length               = length;
+    tokenizer->offset               = SIZE_T_C(0);
+    tokenizer->vectorDelimiterCount = UINT8_C(0);
+    tokenizer->collapseDelimiters   = collapseDelimiters;
+    tokenizer->finished             = false;
+    build_delimiter_map(tokenizer->delimiterMap, delim);
+    safe_memset(tokenizer->vectorDelimiters, sizeof(tokenizer->vectorDelimiters), 0,
+                sizeof(tokenizer->vectorDelimiters));
+    // Collect the distinct delimiters for the SIMD scan. Repeats in delim are skipped since the map already has them.
+    for (unsigned int value = 1U; value <= UCHAR_MAX; ++value)
+    {
+        if (is_delimiter(tokenizer->delimiterMap, M_STATIC_CAST(unsigned char, value)))
+        {
+            if (tokenizer->vectorDelimiterCount == SPAN_TOKENIZER_VECTOR_DELIMITERS)
+            {
+                tokenizer->vectorDelimiterCount = UINT8_C(0);
+                break;
+            }
+            tokenizer->vectorDelimiters[tokenizer->vectorDelimiterCount] =
+                M_STATIC_CAST(char, M_STATIC_CAST(unsigned char, value));
+            ++tokenizer->vectorDelimiterCount;
+        }
+    }
+    return 0;
+}
+
+M_PARAM_RW(1)
+M_PARAM_WO(2)
+bool span_Tokenizer_Next(spanTokenizer* M_NONNULL tokenizer, stringSpan* M_NONNULL token)
+{
+    if (tokenizer == M_NULLPTR || token == M_NULLPTR || tokenizer->data == M_NULLPTR || tokenizer->finished)
+    {
+        return false;
+    }
+    size_t start = tokenizer->offset;
+    if (tokenizer->collapseDelimiters)
+    {
+        start = span_scan(tokenizer, start, false);
+        if (start >= tokenizer->length)
+        {
+            tokenizer->offset   = tokenizer->length;
+            tokenizer->finished = true;
+            return false;
+        }
+    }
+    size_t end = span_scan(tokenizer, start, true);
+    token->ptr = tokenizer->data + start;
+    token->len = end - start;
+    if (end >= tokenizer->length)
+    {
+        tokenizer->offset   = tokenizer->length;
+        tokenizer->finished = true;
+    }
+    else
+    {
+        // step over the delimiter that ended this token
+        tokenizer->offset = end + SIZE_T_C(1);
+    }
+    return true;
+}
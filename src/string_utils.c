@@ -11,9 +11,11 @@
 //! If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include "string_utils.h"
+#include "bit_manip.h"
 #include "common_types.h"
 #include "constraint_handling.h"
 #include "env_detect.h"
+#include "impl_simd.h"
 #include "io_utils.h"
 #include "math_utils.h"
 #include "memory_safety.h"
@@ -58,6 +60,310 @@ static int is_valid_unsigned_char_range(int c)
     return (c >= 0 && c <= UCHAR_MAX);
 }
 
+// Byte range checks shared by the vectorized character class and case conversion code.
+// A byte is in [low, low + width) when subtracting low leaves a value below width.
+// SSE2 only has signed byte compares, so the subtraction is followed by adding 0x80 which moves the range to the
+// bottom of the signed range where a single compare against -128 + width finds it. NEON has unsigned compares so the
+// check is used as is.
+#if defined(HAVE_SSE2)
+static M_INLINE __m128i sse2_in_byte_range(__m128i value, char low, int width)
+{
+    __m128i shifted = _mm_add_epi8(_mm_sub_epi8(value, _mm_set1_epi8(low)), _mm_set1_epi8(M_STATIC_CAST(char, -128)));
+    return _mm_cmplt_epi8(shifted, _mm_set1_epi8(M_STATIC_CAST(char, width - 128)));
+}
+#elif defined(HAVE_NEON)
+static M_INLINE uint8x16_t neon_in_byte_range(uint8x16_t value, uint8_t low, uint8_t width)
+{
+    return vcltq_u8(vsubq_u8(value, vdupq_n_u8(low)), vdupq_n_u8(width));
+}
+#endif
+
+// Generated from the "C" locale is*() functions for 0-127. 128-255 are in no class.
+const uint16_t ascii_char_class_table[256] = {
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0007, 0x0003, 0x0003, 0x0003, 0x0003, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x000E, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038,
+    0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038,
+    0x08D8, 0x08D8, 0x08D8, 0x08D8, 0x08D8, 0x08D8, 0x08D8, 0x08D8,
+    0x08D8, 0x08D8, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038,
+    0x0038, 0x0D98, 0x0D98, 0x0D98, 0x0D98, 0x0D98, 0x0D98, 0x0D18,
+    0x0D18, 0x0D18, 0x0D18, 0x0D18, 0x0D18, 0x0D18, 0x0D18, 0x0D18,
+    0x0D18, 0x0D18, 0x0D18, 0x0D18, 0x0D18, 0x0D18, 0x0D18, 0x0D18,
+    0x0D18, 0x0D18, 0x0D18, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038,
+    0x0038, 0x0E98, 0x0E98, 0x0E98, 0x0E98, 0x0E98, 0x0E98, 0x0E18,
+    0x0E18, 0x0E18, 0x0E18, 0x0E18, 0x0E18, 0x0E18, 0x0E18, 0x0E18,
+    0x0E18, 0x0E18, 0x0E18, 0x0E18, 0x0E18, 0x0E18, 0x0E18, 0x0E18,
+    0x0E18, 0x0E18, 0x0E18, 0x0038, 0x0038, 0x0038, 0x0038, 0x0001,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+
+// Computes 0xFF for each lane of value that is in any of the requested classes using the same definitions as
+// ascii_char_class_table.
+#if defined(HAVE_SSE2)
+static M_INLINE __m128i sse2_char_class(__m128i value, uint16_t classes)
+{
+    __m128i matched = _mm_setzero_si128();
+    __m128i digit   = sse2_in_byte_range(value, '0', 10);
+    __m128i alpha   = sse2_in_byte_range(_mm_or_si128(value, _mm_set1_epi8(0x20)), 'a', 26);
+    __m128i graph   = sse2_in_byte_range(value, '!', 94);
+    if (classes & CHAR_CLASS_CNTRL)
+    {
+        matched = _mm_or_si128(matched, _mm_or_si128(sse2_in_byte_range(value, '\0', 32),
+                                                     _mm_cmpeq_epi8(value, _mm_set1_epi8(0x7F))));
+    }
+    if (classes & CHAR_CLASS_SPACE)
+    {
+        matched = _mm_or_si128(matched, _mm_or_si128(sse2_in_byte_range(value, '\t', 5),
+                                                     _mm_cmpeq_epi8(value, _mm_set1_epi8(' '))));
+    }
+    if (classes & CHAR_CLASS_BLANK)
+    {
+        matched = _mm_or_si128(matched, _mm_or_si128(_mm_cmpeq_epi8(value, _mm_set1_epi8('\t')),
+                                                     _mm_cmpeq_epi8(value, _mm_set1_epi8(' '))));
+    }
+    if (classes & CHAR_CLASS_PRINT)
+    {
+        matched = _mm_or_si128(matched, sse2_in_byte_range(value, ' ', 95));
+    }
+    if (classes & CHAR_CLASS_GRAPH)
+    {
+        matched = _mm_or_si128(matched, graph);
+    }
+    if (classes & CHAR_CLASS_PUNCT)
+    {
+        matched = _mm_or_si128(matched, _mm_andnot_si128(_mm_or_si128(alpha, digit), graph));
+    }
+    if (classes & (CHAR_CLASS_DIGIT | CHAR_CLASS_ALNUM))
+    {
+        matched = _mm_or_si128(matched, digit);
+    }
+    if (classes & CHAR_CLASS_XDIGIT)
+    {
+        matched = _mm_or_si128(
+            matched, _mm_or_si128(digit, sse2_in_byte_range(_mm_or_si128(value, _mm_set1_epi8(0x20)), 'a', 6)));
+    }
+    if (classes & CHAR_CLASS_UPPER)
+    {
+        matched = _mm_or_si128(matched, sse2_in_byte_range(value, 'A', 26));
+    }
+    if (classes & CHAR_CLASS_LOWER)
+    {
+        matched = _mm_or_si128(matched, sse2_in_byte_range(value, 'a', 26));
+    }
+    if (classes & (CHAR_CLASS_ALPHA | CHAR_CLASS_ALNUM))
+    {
+        matched = _mm_or_si128(matched, alpha);
+    }
+    return matched;
+}
+#elif defined(HAVE_NEON)
+static M_INLINE uint8x16_t neon_char_class(uint8x16_t value, uint16_t classes)
+{
+    uint8x16_t matched = vdupq_n_u8(0);
+    uint8x16_t digit   = neon_in_byte_range(value, '0', 10);
+    uint8x16_t alpha   = neon_in_byte_range(vorrq_u8(value, vdupq_n_u8(0x20)), 'a', 26);
+    uint8x16_t graph   = neon_in_byte_range(value, '!', 94);
+    if (classes & CHAR_CLASS_CNTRL)
+    {
+        matched = vorrq_u8(matched, vorrq_u8(vcltq_u8(value, vdupq_n_u8(32)), vceqq_u8(value, vdupq_n_u8(0x7F))));
+    }
+    if (classes & CHAR_CLASS_SPACE)
+    {
+        matched = vorrq_u8(matched, vorrq_u8(neon_in_byte_range(value, '\t', 5), vceqq_u8(value, vdupq_n_u8(' '))));
+    }
+    if (classes & CHAR_CLASS_BLANK)
+    {
+        matched = vorrq_u8(matched, vorrq_u8(vceqq_u8(value, vdupq_n_u8('\t')), vceqq_u8(value, vdupq_n_u8(' '))));
+    }
+    if (classes & CHAR_CLASS_PRINT)
+    {
+        matched = vorrq_u8(matched, neon_in_byte_range(value, ' ', 95));
+    }
+    if (classes & CHAR_CLASS_GRAPH)
+    {
+        matched = vorrq_u8(matched, graph);
+    }
+    if (classes & CHAR_CLASS_PUNCT)
+    {
+        matched = vorrq_u8(matched, vbicq_u8(graph, vorrq_u8(alpha, digit)));
+    }
+    if (classes & (CHAR_CLASS_DIGIT | CHAR_CLASS_ALNUM))
+    {
+        matched = vorrq_u8(matched, digit);
+    }
+    if (classes & CHAR_CLASS_XDIGIT)
+    {
+        matched = vorrq_u8(matched, vorrq_u8(digit, neon_in_byte_range(vorrq_u8(value, vdupq_n_u8(0x20)), 'a', 6)));
+    }
+    if (classes & CHAR_CLASS_UPPER)
+    {
+        matched = vorrq_u8(matched, neon_in_byte_range(value, 'A', 26));
+    }
+    if (classes & CHAR_CLASS_LOWER)
+    {
+        matched = vorrq_u8(matched, neon_in_byte_range(value, 'a', 26));
+    }
+    if (classes & (CHAR_CLASS_ALPHA | CHAR_CLASS_ALNUM))
+    {
+        matched = vorrq_u8(matched, alpha);
+    }
+    return matched;
+}
+#endif
+
+// Returns the offset of the first character whose membership in classes equals inClass, or len if there is none
+static size_t char_class_find(const char* M_NONNULL data, size_t len, uint16_t classes, bool inClass)
+{
+    size_t iter = SIZE_T_C(0);
+#if defined(HAVE_SSE2)
+    unsigned int flip = inClass ? 0U : 0xFFFFU;
+    for (; iter + SIZE_T_C(16) <= len; iter += SIZE_T_C(16))
+    {
+        __m128i      block = _mm_loadu_si128(M_REINTERPRET_CAST(const __m128i*, data + iter));
+        unsigned int mask  = M_STATIC_CAST(unsigned int, _mm_movemask_epi8(sse2_char_class(block, classes))) ^ flip;
+        if (mask != 0U)
+        {
+            return iter + M_STATIC_CAST(size_t, count_trailing_zeros_ui(mask));
+        }
+    }
+#elif defined(HAVE_NEON)
+    for (; iter + SIZE_T_C(16) <= len; iter += SIZE_T_C(16))
+    {
+        uint8x16_t matched = neon_char_class(vld1q_u8(M_REINTERPRET_CAST(const uint8_t*, data + iter)), classes);
+        if (neon_any_lane_set(inClass ? matched : vmvnq_u8(matched)))
+        {
+            break;
+        }
+    }
+#endif
+    for (; iter < len; ++iter)
+    {
+        if (char_class_is(data[iter], classes) == inClass)
+        {
+            break;
+        }
+    }
+    return iter;
+}
+
+M_NODISCARD M_PARAM_RO_SIZE(1, 2) size_t char_class_span(const char* M_NULLABLE data, size_t len, uint16_t classes)
+{
+    if (data == M_NULLPTR)
+    {
+        return SIZE_T_C(0);
+    }
+    return char_class_find(data, len, classes, false);
+}
+
+M_NODISCARD M_PARAM_RO_SIZE(1, 2) size_t char_class_cspan(const char* M_NULLABLE data, size_t len, uint16_t classes)
+{
+    if (data == M_NULLPTR)
+    {
+        return SIZE_T_C(0);
+    }
+    return char_class_find(data, len, classes, true);
+}
+
+M_NODISCARD M_PARAM_RO_SIZE(1, 2) size_t
+    char_class_span_reverse(const char* M_NULLABLE data, size_t len, uint16_t classes)
+{
+    if (data == M_NULLPTR)
+    {
+        return SIZE_T_C(0);
+    }
+    // end is one past the last character still known to be in the trailing run
+    size_t end = len;
+#if defined(HAVE_SSE2)
+    for (; end >= SIZE_T_C(16); end -= SIZE_T_C(16))
+    {
+        __m128i block = _mm_loadu_si128(M_REINTERPRET_CAST(const __m128i*, data + end - SIZE_T_C(16)));
+        if (_mm_movemask_epi8(sse2_char_class(block, classes)) != 0xFFFF)
+        {
+            break;
+        }
+    }
+#elif defined(HAVE_NEON)
+    for (; end >= SIZE_T_C(16); end -= SIZE_T_C(16))
+    {
+        uint8x16_t block = vld1q_u8(M_REINTERPRET_CAST(const uint8_t*, data + end - SIZE_T_C(16)));
+        if (neon_any_lane_set(vmvnq_u8(neon_char_class(block, classes))))
+        {
+            break;
+        }
+    }
+#endif
+    while (end > SIZE_T_C(0) && char_class_is(data[end - SIZE_T_C(1)], classes))
+    {
+        --end;
+    }
+    return len - end;
+}
+
+M_NODISCARD M_PARAM_RO_SIZE(1, 2) size_t char_class_count(const char* M_NULLABLE data, size_t len, uint16_t classes)
+{
+    size_t count = SIZE_T_C(0);
+    size_t iter  = SIZE_T_C(0);
+    if (data == M_NULLPTR)
+    {
+        return SIZE_T_C(0);
+    }
+    // Matching lanes are 0xFF (-1), so subtracting them counts per lane. A lane can count 255 blocks before it would
+    // wrap, after which the lanes are summed into count.
+#if defined(HAVE_SSE2)
+    while (iter + SIZE_T_C(16) <= len)
+    {
+        __m128i lanes  = _mm_setzero_si128();
+        size_t  blocks = M_Min((len - iter) / SIZE_T_C(16), SIZE_T_C(255));
+        for (size_t block = SIZE_T_C(0); block < blocks; ++block, iter += SIZE_T_C(16))
+        {
+            __m128i value = _mm_loadu_si128(M_REINTERPRET_CAST(const __m128i*, data + iter));
+            lanes         = _mm_sub_epi8(lanes, sse2_char_class(value, classes));
+        }
+        __m128i sums = _mm_sad_epu8(lanes, _mm_setzero_si128());
+        count += M_STATIC_CAST(size_t, _mm_cvtsi128_si32(sums)) +
+                 M_STATIC_CAST(size_t, _mm_cvtsi128_si32(_mm_srli_si128(sums, 8)));
+    }
+#elif defined(HAVE_NEON)
+    while (iter + SIZE_T_C(16) <= len)
+    {
+        uint8x16_t lanes  = vdupq_n_u8(0);
+        size_t     blocks = M_Min((len - iter) / SIZE_T_C(16), SIZE_T_C(255));
+        for (size_t block = SIZE_T_C(0); block < blocks; ++block, iter += SIZE_T_C(16))
+        {
+            uint8x16_t value = vld1q_u8(M_REINTERPRET_CAST(const uint8_t*, data + iter));
+            lanes            = vsubq_u8(lanes, neon_char_class(value, classes));
+        }
+        uint64x2_t sums = vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(lanes)));
+        count += M_STATIC_CAST(size_t, vgetq_lane_u64(sums, 0) + vgetq_lane_u64(sums, 1));
+    }
+#endif
+    for (; iter < len; ++iter)
+    {
+        if (char_class_is(data[iter], classes))
+        {
+            ++count;
+        }
+    }
+    return count;
+}
+
 int safe_isascii(int c)
 {
     if (handle_eof(c) == 0)
@@ -1066,6 +1372,54 @@ CONSTRAINT_NO_DISCARD errno_t safe_strncatmove_impl(char* M_NONNULL        dest,
     }
 }
 
+#if !defined(HAVE_C11_ANNEX_K) && !defined(HAVE_MSFT_SECURE_LIB) && !defined(POSIX_2008) && !defined(USING_SUS4) &&  \
+    !defined(HAVE_STRNLEN)
+// Fallback for libraries without strnlen. Once aligned, the vector loads never cross a page boundary so reading a
+// few bytes past the terminator cannot fault. Without SIMD this is memchr, which is already vectorized by most libcs.
+static size_t scan_strnlen(const char* M_NONNULL string, size_t n)
+{
+    size_t offset = SIZE_T_C(0);
+#    if defined(HAVE_SSE2) || defined(HAVE_NEON)
+    while (offset < n && (M_REINTERPRET_CAST(uintptr_t, string + offset) % 16U) != 0U)
+    {
+        if (string[offset] == '\0')
+        {
+            return offset;
+        }
+        ++offset;
+    }
+#        if defined(HAVE_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; offset < n; offset += SIZE_T_C(16))
+    {
+        __m128i      block = _mm_load_si128(M_REINTERPRET_CAST(const __m128i*, string + offset));
+        unsigned int mask  = M_STATIC_CAST(unsigned int, _mm_movemask_epi8(_mm_cmpeq_epi8(block, zero)));
+        if (mask != 0U)
+        {
+            return M_Min(offset + M_STATIC_CAST(size_t, count_trailing_zeros_ui(mask)), n);
+        }
+    }
+    return n;
+#        else
+    for (; offset < n; offset += SIZE_T_C(16))
+    {
+        if (neon_any_lane_set(vceqq_u8(vld1q_u8(M_REINTERPRET_CAST(const uint8_t*, string + offset)), vdupq_n_u8(0))))
+        {
+            break;
+        }
+    }
+    for (; offset < n && string[offset] != '\0'; ++offset)
+    {
+    }
+    return offset;
+#        endif
+#    else
+    const char* found = memchr(string, '\0', n);
+    return found != M_NULLPTR ? C_CAST(size_t, C_CAST(uintptr_t, found) - C_CAST(uintptr_t, string)) : n;
+#    endif
+}
+#endif
+
 M_NODISCARD size_t safe_strnlen_impl(const char* M_NULLABLE string, size_t n)
 {
 #if defined(HAVE_C11_ANNEX_K) || defined(HAVE_MSFT_SECURE_LIB)
@@ -1081,19 +1435,10 @@ M_NODISCARD size_t safe_strnlen_impl(const char* M_NULLABLE string, size_t n)
         return SIZE_T_C(0);
     }
 #else
-    // implement this ourselves with memchr after making sure string is not a
-    // null pointer
+    // implement this ourselves after making sure string is not a null pointer
     if (string != M_NULLPTR)
     {
-        const char* found = memchr(string, '\0', n);
-        if (found != M_NULLPTR)
-        {
-            return C_CAST(size_t, C_CAST(uintptr_t, found) - C_CAST(uintptr_t, string));
-        }
-        else
-        {
-            return n;
-        }
+        return scan_strnlen(string, n);
     }
     return SIZE_T_C(0);
 #endif
@@ -1274,6 +1619,65 @@ M_PARAM_RW(1) M_NULL_TERM_STRING(1) void remove_Whitespace_Left(char* M_NONNULL
     remove_Leading_Whitespace_Len(stringToChange, safe_strlen(stringToChange));
 }
 
+// Characters removed by the trimming functions: ASCII whitespace and control characters. Leading bytes above 0x7F
+// are kept, but trailing ones are removed as well, since that is what the trimming functions have always done and
+// padded device strings can end in 0xFF or other non-ASCII filler.
+#define STRING_TRIM_CLASSES (CHAR_CLASS_SPACE | CHAR_CLASS_CNTRL)
+
+// Same as char_class_span_reverse with STRING_TRIM_CLASSES, except bytes above 0x7F also count as part of the run
+static size_t trailing_trim_span(const char* M_NONNULL data, size_t len)
+{
+    // end is one past the last character still known to be in the trailing run
+    size_t end = len;
+#if defined(HAVE_SSE2)
+    for (; end >= SIZE_T_C(16); end -= SIZE_T_C(16))
+    {
+        __m128i block = _mm_loadu_si128(M_REINTERPRET_CAST(const __m128i*, data + end - SIZE_T_C(16)));
+        // the byte mask already has a bit for every lane with its top bit set
+        if ((_mm_movemask_epi8(sse2_char_class(block, STRING_TRIM_CLASSES)) | _mm_movemask_epi8(block)) != 0xFFFF)
+        {
+            break;
+        }
+    }
+#elif defined(HAVE_NEON)
+    for (; end >= SIZE_T_C(16); end -= SIZE_T_C(16))
+    {
+        uint8x16_t block   = vld1q_u8(M_REINTERPRET_CAST(const uint8_t*, data + end - SIZE_T_C(16)));
+        uint8x16_t trimmed = vorrq_u8(neon_char_class(block, STRING_TRIM_CLASSES), vcgeq_u8(block, vdupq_n_u8(0x80)));
+        if (neon_any_lane_set(vmvnq_u8(trimmed)))
+        {
+            break;
+        }
+    }
+#endif
+    while (end > SIZE_T_C(0) && (M_STATIC_CAST(unsigned char, data[end - SIZE_T_C(1)]) > 0x7FU ||
+                                 char_class_is(data[end - SIZE_T_C(1)], STRING_TRIM_CLASSES)))
+    {
+        --end;
+    }
+    return len - end;
+}
+
+M_PARAM_RO_SIZE(1, 2)
+stringSpan get_Whitespace_Trimmed_Span(const char* M_NULLABLE string, size_t stringlen)
+{
+    stringSpan trimmed;
+    trimmed.ptr = string;
+    trimmed.len = SIZE_T_C(0);
+    if (string != M_NULLPTR)
+    {
+        size_t start = char_class_span(string, stringlen, STRING_TRIM_CLASSES);
+        trimmed.ptr  = string + start;
+        trimmed.len  = stringlen - start;
+        // When everything is trimmed there is nothing left to scan from the end
+        if (trimmed.len > SIZE_T_C(0))
+        {
+            trimmed.len -= trailing_trim_span(trimmed.ptr, trimmed.len);
+        }
+    }
+    return trimmed;
+}
+
 M_PARAM_RW(1) M_NULL_TERM_STRING(1) void remove_Trailing_Whitespace(char* M_NONNULL stringToChange)
 {
     remove_Trailing_Whitespace_Len(stringToChange, safe_strlen(stringToChange));
@@ -1287,20 +1691,7 @@ void remove_Trailing_Whitespace_Len(char* M_NONNULL stringToChange, size_t strin
         return;
     }
 
-    size_t end = stringlen;
-
-    while (end > SIZE_T_C(0))
-    {
-        unsigned char currentEndChar = M_STATIC_CAST(unsigned char, stringToChange[end - SIZE_T_C(1)]);
-        if (currentEndChar <= 0x7F)
-        {
-            if (!(safe_isspace(currentEndChar) || safe_iscntrl(currentEndChar)))
-            {
-                break;
-            }
-        }
-        end--;
-    }
+    size_t end = stringlen - trailing_trim_span(stringToChange, stringlen);
 
     if (end == stringlen)
     {
@@ -1325,12 +1716,7 @@ void remove_Leading_Whitespace_Len(char* M_NONNULL stringToChange, size_t string
     {
         return;
     }
-    size_t iter = SIZE_T_C(0);
-    while (iter < stringlen && safe_isascii(stringToChange[iter]) &&
-           (safe_isspace(stringToChange[iter]) || safe_iscntrl(stringToChange[iter])))
-    {
-        iter++;
-    }
+    size_t iter = char_class_span(stringToChange, stringlen, STRING_TRIM_CLASSES);
 
     if (iter > SIZE_T_C(0))
     {
@@ -1338,8 +1724,8 @@ void remove_Leading_Whitespace_Len(char* M_NONNULL stringToChange, size_t string
         {
             return;
         }
-        if (0 != safe_memset(&stringToChange[stringlen - iter], stringlen - iter, 0,
-                             iter)) // Null-terminate the shifted string
+        // Null-terminate the shifted string. The space left after the shift is exactly iter bytes.
+        if (0 != safe_memset(&stringToChange[stringlen - iter], iter, 0, iter))
         {
             return;
         }
@@ -1358,31 +1744,12 @@ void remove_Leading_And_Trailing_Whitespace_Len(char* M_NONNULL stringToChange,
     {
         return;
     }
-    // Remove leading whitespace (calculate for memmove later)
-    size_t start = SIZE_T_C(0);
-    while (start < stringlen && safe_isascii(stringToChange[start]) &&
-           (safe_isspace(stringToChange[start]) || safe_iscntrl(stringToChange[start])))
-    {
-        start++;
-    }
-
-    // Remove trailing whitespace (and control characters). These should not be present in the strings in here anyways!
-    size_t end = stringlen;
-    while (end > start)
-    {
-        unsigned char currentEndChar = M_STATIC_CAST(unsigned char, stringToChange[end - SIZE_T_C(1)]);
-        if (currentEndChar <= 0x7F)
-        {
-            if (!(safe_isspace(currentEndChar) || safe_iscntrl(currentEndChar)))
-            {
-                break;
-            }
-        }
-        end--;
-    }
+    // Find the leading and trailing whitespace and control characters (calculate for memmove later)
+    stringSpan trimmed = get_Whitespace_Trimmed_Span(stringToChange, stringlen);
+    size_t     start   = C_CAST(size_t, C_CAST(uintptr_t, trimmed.ptr) - C_CAST(uintptr_t, stringToChange));
 
     // Calculate new length after removing whitespace
-    size_t newlen = end - start;
+    size_t newlen = trimmed.len;
 
     // If there's leading whitespace, shift the string to the start
     if (start > SIZE_T_C(0) && newlen > 0)
@@ -1422,16 +1789,127 @@ void remove_Leading_And_Trailing_Control_Char_Len(char* M_NONNULL stringToChange
     remove_Leading_And_Trailing_Whitespace_Len(stringToChange, stringlen);
 }
 
+// ASCII case conversion and comparison kernels.
+// These only change the letters A-Z and a-z, independent of the current locale, which is what is wanted when
+// normalizing model numbers, keywords, and other device strings. A byte is a letter in a given case when subtracting
+// the first letter of that case leaves a value below 26, and the case is changed by flipping bit 0x20.
+typedef enum eASCIICaseOpEnum
+{
+    ASCII_CASE_TO_LOWER,
+    ASCII_CASE_TO_UPPER,
+    ASCII_CASE_TO_INVERSE
+} eASCIICaseOp;
+
+static M_INLINE unsigned char ascii_fold_lower(unsigned char c)
+{
+    return M_STATIC_CAST(unsigned char, c - 'A') < 26U ? M_STATIC_CAST(unsigned char, c | 0x20U) : c;
+}
+
+static M_INLINE char ascii_case_change(char c, eASCIICaseOp op)
+{
+    unsigned char value = M_STATIC_CAST(unsigned char, c);
+    unsigned char first = op == ASCII_CASE_TO_LOWER ? 'A' : 'a';
+    unsigned char check = op == ASCII_CASE_TO_INVERSE ? M_STATIC_CAST(unsigned char, value | 0x20U) : value;
+    if (M_STATIC_CAST(unsigned char, check - first) < 26U)
+    {
+        value ^= 0x20U;
+    }
+    return M_STATIC_CAST(char, value);
+}
+
+#if defined(HAVE_SSE2)
+static M_INLINE __m128i sse2_ascii_fold_lower(__m128i value)
+{
+    return _mm_or_si128(value, _mm_and_si128(sse2_in_byte_range(value, 'A', 26), _mm_set1_epi8(0x20)));
+}
+#elif defined(HAVE_NEON)
+static M_INLINE uint8x16_t neon_ascii_fold_lower(uint8x16_t value)
+{
+    return vorrq_u8(value, vandq_u8(neon_in_byte_range(value, 'A', 26), vdupq_n_u8(0x20)));
+}
+#endif
+
+static void ascii_case_convert(char* M_NONNULL string, size_t len, eASCIICaseOp op)
+{
+    size_t iter = SIZE_T_C(0);
+#if defined(HAVE_SSE2)
+    char    first   = op == ASCII_CASE_TO_LOWER ? 'A' : 'a';
+    __m128i caseBit = _mm_set1_epi8(0x20);
+    __m128i checkOr = op == ASCII_CASE_TO_INVERSE ? caseBit : _mm_setzero_si128();
+    for (; iter + SIZE_T_C(16) <= len; iter += SIZE_T_C(16))
+    {
+        __m128i block = _mm_loadu_si128(M_REINTERPRET_CAST(const __m128i*, string + iter));
+        __m128i flip  = _mm_and_si128(sse2_in_byte_range(_mm_or_si128(block, checkOr), first, 26), caseBit);
+        _mm_storeu_si128(M_REINTERPRET_CAST(__m128i*, string + iter), _mm_xor_si128(block, flip));
+    }
+#elif defined(HAVE_NEON)
+    uint8_t    first   = op == ASCII_CASE_TO_LOWER ? 'A' : 'a';
+    uint8x16_t caseBit = vdupq_n_u8(0x20);
+    uint8x16_t checkOr = op == ASCII_CASE_TO_INVERSE ? caseBit : vdupq_n_u8(0);
+    for (; iter + SIZE_T_C(16) <= len; iter += SIZE_T_C(16))
+    {
+        uint8_t*   bytes = M_REINTERPRET_CAST(uint8_t*, string + iter);
+        uint8x16_t block = vld1q_u8(bytes);
+        uint8x16_t flip  = vandq_u8(neon_in_byte_range(vorrq_u8(block, checkOr), first, 26), caseBit);
+        vst1q_u8(bytes, veorq_u8(block, flip));
+    }
+#endif
+    for (; iter < len; ++iter)
+    {
+        string[iter] = ascii_case_change(string[iter], op);
+    }
+}
+
+// Returns the offset of the first byte that differs between the two buffers ignoring ASCII case, or len if they match
+static size_t ascii_case_mismatch(const char* M_NONNULL first, const char* M_NONNULL second, size_t len)
+{
+    size_t iter = SIZE_T_C(0);
+#if defined(HAVE_SSE2)
+    for (; iter + SIZE_T_C(16) <= len; iter += SIZE_T_C(16))
+    {
+        __m128i block1 = sse2_ascii_fold_lower(_mm_loadu_si128(M_REINTERPRET_CAST(const __m128i*, first + iter)));
+        __m128i block2 = sse2_ascii_fold_lower(_mm_loadu_si128(M_REINTERPRET_CAST(const __m128i*, second + iter)));
+        unsigned int mask = M_STATIC_CAST(unsigned int, _mm_movemask_epi8(_mm_cmpeq_epi8(block1, block2))) ^ 0xFFFFU;
+        if (mask != 0U)
+        {
+            return iter + M_STATIC_CAST(size_t, count_trailing_zeros_ui(mask));
+        }
+    }
+#elif defined(HAVE_NEON)
+    for (; iter + SIZE_T_C(16) <= len; iter += SIZE_T_C(16))
+    {
+        uint8x16_t block1 = neon_ascii_fold_lower(vld1q_u8(M_REINTERPRET_CAST(const uint8_t*, first + iter)));
+        uint8x16_t block2 = neon_ascii_fold_lower(vld1q_u8(M_REINTERPRET_CAST(const uint8_t*, second + iter)));
+#    if defined(HAVE_NEON_A64)
+        if (vminvq_u8(vceqq_u8(block1, block2)) == 0)
+#    else
+        uint8x16_t differ = vmvnq_u8(vceqq_u8(block1, block2));
+        uint8x8_t  folded = vorr_u8(vget_low_u8(differ), vget_high_u8(differ));
+        if (vget_lane_u64(vreinterpret_u64_u8(folded), 0) != 0)
+#    endif
+        {
+            break;
+        }
+    }
+#endif
+    for (; iter < len; ++iter)
+    {
+        if (ascii_fold_lower(M_STATIC_CAST(unsigned char, first[iter])) !=
+            ascii_fold_lower(M_STATIC_CAST(unsigned char, second[iter])))
+        {
+            break;
+        }
+    }
+    return iter;
+}
+
 M_PARAM_RW(1) M_NULL_TERM_STRING(1) void convert_String_To_Upper_Case(char* M_NONNULL stringToChange)
 {
     if (stringToChange == M_NULLPTR)
     {
         return;
     }
-    for (size_t iter = SIZE_T_C(0); stringToChange[iter] != '\0'; iter++)
-    {
-        stringToChange[iter] = C_CAST(char, safe_toupper(stringToChange[iter]));
-    }
+    ascii_case_convert(stringToChange, safe_strlen(stringToChange), ASCII_CASE_TO_UPPER);
 }
 
 M_PARAM_RW_SIZE(1, 2)
@@ -1441,10 +1919,7 @@ void convert_String_To_Upper_Case_Len(char* M_NONNULL stringToChange, size_t str
     {
         return;
     }
-    for (size_t iter = SIZE_T_C(0); iter < stringlen; iter++)
-    {
-        stringToChange[iter] = C_CAST(char, safe_toupper(stringToChange[iter]));
-    }
+    ascii_case_convert(stringToChange, stringlen, ASCII_CASE_TO_UPPER);
 }
 
 M_PARAM_RW(1) M_NULL_TERM_STRING(1) void convert_String_To_Lower_Case(char* M_NONNULL stringToChange)
@@ -1453,10 +1928,7 @@ M_PARAM_RW(1) M_NULL_TERM_STRING(1) void convert_String_To_Lower_Case(char* M_NO
     {
         return;
     }
-    for (size_t iter = SIZE_T_C(0); stringToChange[iter] != '\0'; iter++)
-    {
-        stringToChange[iter] = C_CAST(char, safe_tolower(stringToChange[iter]));
-    }
+    ascii_case_convert(stringToChange, safe_strlen(stringToChange), ASCII_CASE_TO_LOWER);
 }
 
 M_PARAM_RW_SIZE(1, 2)
@@ -1466,10 +1938,7 @@ void convert_String_To_Lower_Case_Len(char* M_NONNULL stringToChange, size_t str
     {
         return;
     }
-    for (size_t iter = SIZE_T_C(0); iter < stringlen; iter++)
-    {
-        stringToChange[iter] = C_CAST(char, safe_tolower(stringToChange[iter]));
-    }
+    ascii_case_convert(stringToChange, stringlen, ASCII_CASE_TO_LOWER);
 }
 
 M_PARAM_RW(1) M_NULL_TERM_STRING(1) void convert_String_To_Inverse_Case(char* M_NONNULL stringToChange)
@@ -1478,17 +1947,7 @@ M_PARAM_RW(1) M_NULL_TERM_STRING(1) void convert_String_To_Inverse_Case(char* M_
     {
         return;
     }
-    for (size_t iter = SIZE_T_C(0); stringToChange[iter] != '\0'; iter++)
-    {
-        if (safe_islower(stringToChange[iter]))
-        {
-            stringToChange[iter] = C_CAST(char, safe_toupper(stringToChange[iter]));
-        }
-        else if (safe_isupper(stringToChange[iter]))
-        {
-            stringToChange[iter] = C_CAST(char, safe_tolower(stringToChange[iter]));
-        }
-    }
+    ascii_case_convert(stringToChange, safe_strlen(stringToChange), ASCII_CASE_TO_INVERSE);
 }
 
 M_PARAM_RW_SIZE(1, 2)
@@ -1498,81 +1957,609 @@ void convert_String_To_Inverse_Case_Len(char* M_NONNULL stringToChange, size_t s
     {
         return;
     }
-    for (size_t iter = SIZE_T_C(0); iter < stringlen; iter++)
-    {
-        if (safe_islower(stringToChange[iter]))
-        {
-            stringToChange[iter] = C_CAST(char, safe_toupper(stringToChange[iter]));
-        }
-        else if (safe_isupper(stringToChange[iter]))
-        {
-            stringToChange[iter] = C_CAST(char, safe_tolower(stringToChange[iter]));
-        }
-    }
+    ascii_case_convert(stringToChange, stringlen, ASCII_CASE_TO_INVERSE);
 }
 
 M_PARAM_RO(1)
 M_PARAM_RO(2)
-size_t find_last_occurrence_in_string(const char* M_NONNULL originalString, const char* M_NONNULL stringToFind)
+int safe_strncasecmp(const char* M_NULLABLE string1, const char* M_NULLABLE string2, size_t count)
 {
-    if (originalString == M_NULLPTR || stringToFind == M_NULLPTR)
+    if (string1 == string2)
     {
-        return SIZE_MAX;
+        return 0;
     }
-    size_t last_occurrence = SIZE_MAX;
-    size_t stringToFindLen = safe_strlen(stringToFind);
-    if (stringToFindLen == SIZE_T_C(0))
+    else if (string1 == M_NULLPTR)
     {
-        return SIZE_MAX; // Searching for an empty string is undefined
+        return -1;
     }
-
-    const char* stringToCompare = originalString;
-    while ((stringToCompare = strstr(stringToCompare, stringToFind)) != M_NULLPTR)
+    else if (string2 == M_NULLPTR)
     {
-        last_occurrence = safe_strlen(stringToCompare);
-        stringToCompare += stringToFindLen; // Move past the current found substring
+        return 1;
     }
-
-    return (last_occurrence != SIZE_MAX) ? last_occurrence : safe_strlen(originalString);
+    // Measuring both strings first keeps the vector compare from reading past either null terminator
+    size_t len1     = safe_strnlen(string1, count);
+    size_t len2     = safe_strnlen(string2, count);
+    size_t shortest = M_Min(len1, len2);
+    size_t mismatch = ascii_case_mismatch(string1, string2, shortest);
+    // Past the end of the shorter string compares the null terminator against the longer string
+    int char1 = mismatch < len1 ? ascii_fold_lower(M_STATIC_CAST(unsigned char, string1[mismatch])) : 0;
+    int char2 = mismatch < len2 ? ascii_fold_lower(M_STATIC_CAST(unsigned char, string2[mismatch])) : 0;
+    return char1 - char2;
 }
 
 M_PARAM_RO(1)
 M_PARAM_RO(2)
 M_NULL_TERM_STRING(1)
 M_NULL_TERM_STRING(2)
-size_t find_first_occurrence_in_string(const char* M_NONNULL originalString, const char* M_NONNULL stringToFind)
+int safe_strcasecmp(const char* M_NULLABLE string1, const char* M_NULLABLE string2)
+{
+    return safe_strncasecmp(string1, string2, RSIZE_MAX);
+}
+
+M_PARAM_RO(1)
+M_PARAM_RO(2)
+M_NULL_TERM_STRING(1)
+M_NULL_TERM_STRING(2)
+bool safe_strcaseeq(const char* M_NULLABLE string1, const char* M_NULLABLE string2)
+{
+    if (string1 == string2)
+    {
+        return true;
+    }
+    else if (string1 == M_NULLPTR || string2 == M_NULLPTR)
+    {
+        return false;
+    }
+    size_t len1 = safe_strlen(string1);
+    return len1 == safe_strnlen(string2, len1 + SIZE_T_C(1)) && ascii_case_mismatch(string1, string2, len1) == len1;
+}
+
+M_PARAM_RO_SIZE(1, 3)
+void* M_NULLABLE safe_memchr(const void* M_NULLABLE ptr, int ch, size_t count)
+{
+    if (ptr == M_NULLPTR || count == SIZE_T_C(0))
+    {
+        return M_NULLPTR;
+    }
+    // The C library memchr is already vectorized on every platform this is built for
+    return M_CONST_CAST(void*, memchr(ptr, ch, count));
+}
+
+M_PARAM_RO_SIZE(1, 3)
+void* M_NULLABLE safe_memrchr(const void* M_NULLABLE ptr, int ch, size_t count)
+{
+    if (ptr == M_NULLPTR)
+    {
+        return M_NULLPTR;
+    }
+    const unsigned char* bytes = M_REINTERPRET_CAST(const unsigned char*, ptr);
+    unsigned char        value = M_STATIC_CAST(unsigned char, ch);
+    // end is one past the last byte that has not been checked yet
+    size_t end = count;
+#if defined(HAVE_SSE2)
+    __m128i needle = _mm_set1_epi8(M_STATIC_CAST(char, value));
+    for (; end >= SIZE_T_C(16); end -= SIZE_T_C(16))
+    {
+        __m128i block = _mm_loadu_si128(M_REINTERPRET_CAST(const __m128i*, bytes + end - SIZE_T_C(16)));
+        unsigned int mask = M_STATIC_CAST(unsigned int, _mm_movemask_epi8(_mm_cmpeq_epi8(block, needle)));
+        if (mask != 0U)
+        {
+            // highest set bit is the last match in the block
+            return M_CONST_CAST(unsigned char*,
+                                bytes + end - SIZE_T_C(16) + (SIZE_T_C(31) - count_leading_zeros_ui(mask)));
+        }
+    }
+#elif defined(HAVE_NEON)
+    uint8x16_t needle = vdupq_n_u8(value);
+    for (; end >= SIZE_T_C(16); end -= SIZE_T_C(16))
+    {
+        if (neon_any_lane_set(vceqq_u8(vld1q_u8(bytes + end - SIZE_T_C(16)), needle)))
+        {
+            break;
+        }
+    }
+#endif
+    while (end > SIZE_T_C(0))
+    {
+        --end;
+        if (bytes[end] == value)
+        {
+            return M_CONST_CAST(unsigned char*, bytes + end);
+        }
+    }
+    return M_NULLPTR;
+}
+
+// Substring search.
+// Two-Way string matching (Crochemore and Perrin) finds a needle in linear time with constant extra space no matter
+// how repetitive the text is. It is written here to run in either direction: when reverse is set every index into
+// the needle and haystack is mirrored, so searching the reversed text for the reversed needle finds the last match.
+static M_INLINE unsigned char two_way_at(const unsigned char* M_NONNULL text, size_t len, size_t index, bool reverse)
+{
+    return reverse ? text[len - SIZE_T_C(1) - index] : text[index];
+}
+
+// Computes one maximal suffix of the needle. When greater is set the suffix is maximal for the reversed alphabet
+// order. Returns the start of the suffix minus one (SIZE_MAX means the whole needle) and its period.
+static size_t two_way_maximal_suffix(const unsigned char* M_NONNULL needle,
+                                     size_t                         needleLen,
+                                     bool                           reverse,
+                                     bool                           greater,
+                                     size_t* M_NONNULL              period)
+{
+    size_t maxSuffix = SIZE_MAX;
+    size_t next      = SIZE_T_C(0);
+    size_t offset    = SIZE_T_C(1);
+    size_t p         = SIZE_T_C(1);
+    while (next + offset < needleLen)
+    {
+        unsigned char current   = two_way_at(needle, needleLen, next + offset, reverse);
+        unsigned char candidate = two_way_at(needle, needleLen, maxSuffix + offset, reverse);
+        if (greater ? current > candidate : current < candidate)
+        {
+            next += offset;
+            offset = SIZE_T_C(1);
+            p      = next - maxSuffix;
+        }
+        else if (current == candidate)
+        {
+            if (offset != p)
+            {
+                ++offset;
+            }
+            else
+            {
+                next += p;
+                offset = SIZE_T_C(1);
+            }
+        }
+        else
+        {
+            maxSuffix = next;
+            ++next;
+            offset = SIZE_T_C(1);
+            p      = SIZE_T_C(1);
+        }
+    }
+    *period = p;
+    return maxSuffix;
+}
+
+// Returns the match offset in the (possibly mirrored) haystack or SIZE_MAX. needleLen must be 1 to haystackLen.
+static size_t two_way_search(const unsigned char* M_NONNULL haystack,
+                             size_t                         haystackLen,
+                             const unsigned char* M_NONNULL needle,
+                             size_t                         needleLen,
+                             bool                           reverse)
+{
+    size_t lessPeriod    = SIZE_T_C(1);
+    size_t greaterPeriod = SIZE_T_C(1);
+    size_t lessSuffix    = two_way_maximal_suffix(needle, needleLen, reverse, false, &lessPeriod);
+    size_t greaterSuffix = two_way_maximal_suffix(needle, needleLen, reverse, true, &greaterPeriod);
+    // critical factorization: the later of the two maximal suffixes
+    size_t suffix = (lessSuffix + SIZE_T_C(1) > greaterSuffix + SIZE_T_C(1)) ? lessSuffix + SIZE_T_C(1)
+                                                                            : greaterSuffix + SIZE_T_C(1);
+    size_t period = (lessSuffix + SIZE_T_C(1) > greaterSuffix + SIZE_T_C(1)) ? lessPeriod : greaterPeriod;
+    bool   periodic = true;
+    for (size_t iter = SIZE_T_C(0); iter < suffix; ++iter)
+    {
+        if (period + iter >= needleLen || two_way_at(needle, needleLen, iter, reverse) !=
+                                              two_way_at(needle, needleLen, period + iter, reverse))
+        {
+            periodic = false;
+            break;
+        }
+    }
+    size_t pos    = SIZE_T_C(0);
+    size_t memory = SIZE_T_C(0);
+    if (!periodic)
+    {
+        period = M_Max(suffix, needleLen - suffix) + SIZE_T_C(1);
+    }
+    while (pos <= haystackLen - needleLen)
+    {
+        // match the right half of the needle first
+        size_t iter = periodic ? M_Max(suffix, memory) : suffix;
+        while (iter < needleLen &&
+               two_way_at(needle, needleLen, iter, reverse) == two_way_at(haystack, haystackLen, iter + pos, reverse))
+        {
+            ++iter;
+        }
+        if (iter < needleLen)
+        {
+            pos += iter - suffix + SIZE_T_C(1);
+            memory = SIZE_T_C(0);
+            continue;
+        }
+        // then the left half, right to left. In the periodic case the part already known to match is skipped.
+        size_t stop = periodic ? memory : SIZE_T_C(0);
+        iter        = suffix;
+        while (iter > stop && two_way_at(needle, needleLen, iter - SIZE_T_C(1), reverse) ==
+                                  two_way_at(haystack, haystackLen, iter - SIZE_T_C(1) + pos, reverse))
+        {
+            --iter;
+        }
+        if (iter <= stop)
+        {
+            return pos;
+        }
+        pos += period;
+        memory = periodic ? needleLen - period : SIZE_T_C(0);
+    }
+    return SIZE_MAX;
+}
+
+// Before falling back to Two-Way, candidates are filtered with SIMD by comparing the first and last needle bytes
+// against 16 haystack positions at a time, which skips over most text without a match in a couple of instructions.
+// Verifying false candidates can cost up to the needle length each, so once that work exceeds this many bytes plus
+// twice the distance scanned the rest of the search is handed to Two-Way to keep the total time linear.
+#define SUBSTRING_FILTER_BUDGET SIZE_T_C(1024)
+
+// Checks one candidate position found by the SIMD filter. NEON only reports that a block has candidates, so the first
+// and last bytes are checked again here before comparing the rest.
+static M_INLINE bool substring_candidate_matches(const unsigned char* M_NONNULL text,
+                                                 const unsigned char* M_NONNULL needle,
+                                                 size_t                         needleLen,
+                                                 size_t* M_NONNULL              work)
+{
+    if (text[0] != needle[0] || text[needleLen - SIZE_T_C(1)] != needle[needleLen - SIZE_T_C(1)])
+    {
+        return false;
+    }
+    *work += needleLen;
+    return memcmp(text + 1, needle + 1, needleLen - SIZE_T_C(2)) == 0;
+}
+
+#if defined(HAVE_SSE2)
+// Bit N is set when position N could start a match: its first byte and the byte needleLen - 1 after it both match.
+static M_INLINE unsigned int substring_filter_block(const unsigned char* M_NONNULL text,
+                                                    size_t                         needleLen,
+                                                    __m128i                        first,
+                                                    __m128i                        last)
+{
+    __m128i heads = _mm_cmpeq_epi8(_mm_loadu_si128(M_REINTERPRET_CAST(const __m128i*, text)), first);
+    __m128i tails =
+        _mm_cmpeq_epi8(_mm_loadu_si128(M_REINTERPRET_CAST(const __m128i*, text + needleLen - SIZE_T_C(1))), last);
+    return M_STATIC_CAST(unsigned int, _mm_movemask_epi8(_mm_and_si128(heads, tails)));
+}
+#elif defined(HAVE_NEON)
+// NEON has no movemask, so every position in a block with any candidate is returned for the scalar check
+static M_INLINE unsigned int substring_filter_block(const unsigned char* M_NONNULL text,
+                                                    size_t                         needleLen,
+                                                    uint8x16_t                     first,
+                                                    uint8x16_t                     last)
+{
+    uint8x16_t heads = vceqq_u8(vld1q_u8(text), first);
+    uint8x16_t tails = vceqq_u8(vld1q_u8(text + needleLen - SIZE_T_C(1)), last);
+    return neon_any_lane_set(vandq_u8(heads, tails)) ? 0xFFFFU : 0U;
+}
+#endif
+
+// needleLen must be 2 to haystackLen
+static size_t substring_search_forward(const unsigned char* M_NONNULL haystack,
+                                       size_t                         haystackLen,
+                                       const unsigned char* M_NONNULL needle,
+                                       size_t                         needleLen)
+{
+    size_t pos = SIZE_T_C(0);
+#if defined(HAVE_SSE2) || defined(HAVE_NEON)
+    size_t work = SIZE_T_C(0);
+#    if defined(HAVE_SSE2)
+    __m128i first = _mm_set1_epi8(M_STATIC_CAST(char, needle[0]));
+    __m128i last  = _mm_set1_epi8(M_STATIC_CAST(char, needle[needleLen - SIZE_T_C(1)]));
+#    else
+    uint8x16_t first = vdupq_n_u8(needle[0]);
+    uint8x16_t last  = vdupq_n_u8(needle[needleLen - SIZE_T_C(1)]);
+#    endif
+    // each block checks the 16 start positions pos to pos + 15
+    for (; pos + needleLen + SIZE_T_C(15) <= haystackLen && work <= SUBSTRING_FILTER_BUDGET + pos * SIZE_T_C(2);
+         pos += SIZE_T_C(16))
+    {
+        unsigned int mask = substring_filter_block(haystack + pos, needleLen, first, last);
+        while (mask != 0U)
+        {
+            size_t candidate = pos + M_STATIC_CAST(size_t, count_trailing_zeros_ui(mask));
+            mask &= mask - 1U;
+            if (substring_candidate_matches(haystack + candidate, needle, needleLen, &work))
+            {
+                return candidate;
+            }
+        }
+    }
+#endif
+    if (haystackLen - pos < needleLen)
+    {
+        return SIZE_MAX;
+    }
+    size_t found = two_way_search(haystack + pos, haystackLen - pos, needle, needleLen, false);
+    return found == SIZE_MAX ? SIZE_MAX : pos + found;
+}
+
+// needleLen must be 2 to haystackLen
+static size_t substring_search_reverse(const unsigned char* M_NONNULL haystack,
+                                       size_t                         haystackLen,
+                                       const unsigned char* M_NONNULL needle,
+                                       size_t                         needleLen)
+{
+    // start positions at or after end have been ruled out
+    size_t end = haystackLen - needleLen + SIZE_T_C(1);
+#if defined(HAVE_SSE2) || defined(HAVE_NEON)
+    size_t work = SIZE_T_C(0);
+#    if defined(HAVE_SSE2)
+    __m128i first = _mm_set1_epi8(M_STATIC_CAST(char, needle[0]));
+    __m128i last  = _mm_set1_epi8(M_STATIC_CAST(char, needle[needleLen - SIZE_T_C(1)]));
+#    else
+    uint8x16_t first = vdupq_n_u8(needle[0]);
+    uint8x16_t last  = vdupq_n_u8(needle[needleLen - SIZE_T_C(1)]);
+#    endif
+    size_t starts = end;
+    for (; end >= SIZE_T_C(16) && work <= SUBSTRING_FILTER_BUDGET + (starts - end) * SIZE_T_C(2);
+         end -= SIZE_T_C(16))
+    {
+        size_t       pos  = end - SIZE_T_C(16);
+        unsigned int mask = substring_filter_block(haystack + pos, needleLen, first, last);
+        while (mask != 0U)
+        {
+            unsigned int highest   = 31U - count_leading_zeros_ui(mask);
+            size_t       candidate = pos + M_STATIC_CAST(size_t, highest);
+            mask &= ~(1U << highest);
+            if (substring_candidate_matches(haystack + candidate, needle, needleLen, &work))
+            {
+                return candidate;
+            }
+        }
+    }
+#endif
+    if (end == SIZE_T_C(0))
+    {
+        return SIZE_MAX;
+    }
+    // search the mirrored text that holds the remaining start positions
+    size_t textLen = end + needleLen - SIZE_T_C(1);
+    size_t found   = two_way_search(haystack, textLen, needle, needleLen, true);
+    return found == SIZE_MAX ? SIZE_MAX : textLen - needleLen - found;
+}
+
+M_PARAM_RO_SIZE(1, 2)
+M_PARAM_RO_SIZE(3, 4)
+void* M_NULLABLE safe_memmem(const void* M_NULLABLE haystack,
+                             size_t                 haystackLen,
+                             const void* M_NULLABLE needle,
+                             size_t                 needleLen)
+{
+    if (haystack == M_NULLPTR || (needle == M_NULLPTR && needleLen != SIZE_T_C(0)) || needleLen > haystackLen)
+    {
+        return M_NULLPTR;
+    }
+    else if (needleLen == SIZE_T_C(0))
+    {
+        return M_CONST_CAST(void*, haystack);
+    }
+    else if (needleLen == SIZE_T_C(1))
+    {
+        return safe_memchr(haystack, *M_REINTERPRET_CAST(const unsigned char*, needle), haystackLen);
+    }
+    const unsigned char* text  = M_REINTERPRET_CAST(const unsigned char*, haystack);
+    size_t               found = substring_search_forward(text, haystackLen,
+                                                          M_REINTERPRET_CAST(const unsigned char*, needle), needleLen);
+    return found == SIZE_MAX ? M_NULLPTR : M_CONST_CAST(unsigned char*, text + found);
+}
+
+M_PARAM_RO_SIZE(1, 2)
+M_PARAM_RO_SIZE(3, 4)
+void* M_NULLABLE safe_memrmem(const void* M_NULLABLE haystack,
+                              size_t                 haystackLen,
+                              const void* M_NULLABLE needle,
+                              size_t                 needleLen)
+{
+    if (haystack == M_NULLPTR || (needle == M_NULLPTR && needleLen != SIZE_T_C(0)) || needleLen > haystackLen)
+    {
+        return M_NULLPTR;
+    }
+    const unsigned char* text = M_REINTERPRET_CAST(const unsigned char*, haystack);
+    if (needleLen == SIZE_T_C(0))
+    {
+        return M_CONST_CAST(unsigned char*, text + haystackLen);
+    }
+    else if (needleLen == SIZE_T_C(1))
+    {
+        return safe_memrchr(haystack, *M_REINTERPRET_CAST(const unsigned char*, needle), haystackLen);
+    }
+    size_t found = substring_search_reverse(text, haystackLen, M_REINTERPRET_CAST(const unsigned char*, needle),
+                                            needleLen);
+    return found == SIZE_MAX ? M_NULLPTR : M_CONST_CAST(unsigned char*, text + found);
+}
+
+M_PARAM_RO(1)
+M_PARAM_RO(2)
+size_t find_last_occurrence_in_string(const char* M_NONNULL originalString, const char* M_NONNULL stringToFind)
 {
     if (originalString == M_NULLPTR || stringToFind == M_NULLPTR)
     {
         return SIZE_MAX;
     }
-    const char* partialString = strstr(originalString, stringToFind);
+    size_t stringToFindLen = safe_strlen(stringToFind);
+    if (stringToFindLen == SIZE_T_C(0))
+    {
+        return SIZE_MAX; // Searching for an empty string is undefined
+    }
+    size_t      originalLen = safe_strlen(originalString);
+    const char* found       = safe_memrmem(originalString, originalLen, stringToFind, stringToFindLen);
+    // offset is measured from the end of the string. Not finding it is reported as the length of the whole string.
+    return (found != M_NULLPTR) ? originalLen - (C_CAST(uintptr_t, found) - C_CAST(uintptr_t, originalString))
+                                : originalLen;
+}
+
+M_PARAM_RO(1)
+M_PARAM_RO(2)
+M_NULL_TERM_STRING(1)
+M_NULL_TERM_STRING(2)
+size_t find_first_occurrence_in_string(const char* M_NONNULL originalString, const char* M_NONNULL stringToFind)
+{
+    if (originalString == M_NULLPTR || stringToFind == M_NULLPTR)
+    {
+        return SIZE_MAX;
+    }
+    const char* partialString =
+        safe_memmem(originalString, safe_strlen(originalString), stringToFind, safe_strlen(stringToFind));
     return (partialString != M_NULLPTR) ? (C_CAST(uintptr_t, partialString) - C_CAST(uintptr_t, originalString))
                                         : SIZE_MAX;
 }
 
-static M_INLINE bool wildcard_match_internal(const char* M_NULLABLE pattern,
-                                             const char* M_NULLABLE data,
-                                             bool                   caseInsensitive)
+static M_INLINE bool wildcard_char_match(char patternChar, char dataChar, bool caseInsensitive)
+{
+    if (patternChar == dataChar || patternChar == '?')
+    {
+        return true;
+    }
+    // folding both sides to lowercase compares the same as toupper in the C locale
+    return caseInsensitive && ascii_fold_lower(M_STATIC_CAST(unsigned char, patternChar)) ==
+                                  ascii_fold_lower(M_STATIC_CAST(unsigned char, dataChar));
+}
+
+// Matches a run of pattern characters that contains no '*' against the same number of data characters.
+static M_INLINE bool wildcard_match_fixed(const char* M_NONNULL pattern,
+                                          const char* M_NONNULL data,
+                                          size_t                len,
+                                          bool                  caseInsensitive)
+{
+    for (size_t offset = 0; offset < len; ++offset)
+    {
+        if (!wildcard_char_match(pattern[offset], data[offset], caseInsensitive))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Iterative glob matcher for pattern and data with known lengths.
+// When a mismatch is found after a '*', only the most recent '*' is retried with one more data character consumed.
+// Earlier '*'s never need to be revisited since the most recent one can absorb anything they could, so there is no
+// recursion and no exponential blow up on patterns such as "*a*a*a*b".
+static bool wildcard_match_span(const char* M_NONNULL pattern,
+                                size_t                patternLen,
+                                const char* M_NONNULL data,
+                                size_t                dataLen,
+                                bool                  caseInsensitive)
+{
+    size_t patternOffset = SIZE_T_C(0);
+    size_t dataOffset    = SIZE_T_C(0);
+    size_t starPattern   = SIZE_MAX;
+    size_t starData      = SIZE_T_C(0);
+    while (dataOffset < dataLen)
+    {
+        if (patternOffset < patternLen && pattern[patternOffset] == '*')
+        {
+            starPattern = patternOffset;
+            ++patternOffset;
+            starData = dataOffset;
+        }
+        else if (patternOffset < patternLen &&
+                 wildcard_char_match(pattern[patternOffset], data[dataOffset], caseInsensitive))
+        {
+            ++patternOffset;
+            ++dataOffset;
+        }
+        else if (starPattern != SIZE_MAX)
+        {
+            patternOffset = starPattern + SIZE_T_C(1);
+            ++starData;
+            dataOffset = starData;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    while (patternOffset < patternLen && pattern[patternOffset] == '*')
+    {
+        ++patternOffset;
+    }
+    return patternOffset == patternLen;
+}
+
+M_PARAM_RO(1)
+M_PARAM_WO(3)
+M_NULL_TERM_STRING(1)
+errno_t wildcard_compile(const char* M_NONNULL pattern, bool caseInsensitive, wildcardPattern* M_NONNULL compiled)
+{
+    if (pattern == M_NULLPTR || compiled == M_NULLPTR)
+    {
+        return EINVAL;
+    }
+    size_t patternLen = safe_strlen(pattern);
+    size_t firstStar  = SIZE_MAX;
+    size_t lastStar   = SIZE_MAX;
+    size_t starCount  = SIZE_T_C(0);
+    for (size_t offset = SIZE_T_C(0); offset < patternLen; ++offset)
+    {
+        if (pattern[offset] == '*')
+        {
+            if (firstStar == SIZE_MAX)
+            {
+                firstStar = offset;
+            }
+            lastStar = offset;
+            ++starCount;
+        }
+    }
+    compiled->pattern         = pattern;
+    compiled->patternLen      = patternLen;
+    compiled->caseInsensitive = caseInsensitive;
+    compiled->minDataLen      = patternLen - starCount;
+    if (starCount == SIZE_T_C(0))
+    {
+        compiled->hasStar   = false;
+        compiled->prefixLen = patternLen;
+        compiled->suffixLen = SIZE_T_C(0);
+    }
+    else
+    {
+        compiled->hasStar   = true;
+        compiled->prefixLen = firstStar;
+        compiled->suffixLen = patternLen - lastStar - SIZE_T_C(1);
+    }
+    return 0;
+}
+
+M_PARAM_RO(1)
+M_PARAM_RO(2)
+M_NULL_TERM_STRING(2)
+bool wildcard_exec(const wildcardPattern* M_NONNULL compiled, const char* M_NONNULL data)
 {
-    if (pattern == M_NULLPTR || data == M_NULLPTR)
+    if (compiled == M_NULLPTR || compiled->pattern == M_NULLPTR || data == M_NULLPTR)
     {
         return false;
     }
-    if (*pattern == '\0' && *data == '\0')
+    // Never read more of the data than the pattern could match so long strings that share no prefix are rejected
+    // without scanning to their end.
+    size_t prefixDataLen = safe_strnlen(data, compiled->prefixLen + SIZE_T_C(1));
+    if (!compiled->hasStar)
     {
-        return true;
+        return prefixDataLen == compiled->patternLen &&
+               wildcard_match_fixed(compiled->pattern, data, compiled->patternLen, compiled->caseInsensitive);
     }
-    if (*pattern == *data || *pattern == '?' || (caseInsensitive && safe_toupper(*pattern) == safe_toupper(*data)))
+    if (prefixDataLen < compiled->prefixLen ||
+        !wildcard_match_fixed(compiled->pattern, data, compiled->prefixLen, compiled->caseInsensitive))
     {
-        return *data != '\0' && wildcard_match_internal(pattern + 1, data + 1, caseInsensitive);
+        return false;
     }
-    if (*pattern == '*')
+    size_t dataLen = compiled->prefixLen + safe_strlen(data + compiled->prefixLen);
+    if (dataLen < compiled->minDataLen)
     {
-        return wildcard_match_internal(pattern + 1, data, caseInsensitive) ||
-               (*data != '\0' && wildcard_match_internal(pattern, data + 1, caseInsensitive));
+        return false;
+    }
+    if (!wildcard_match_fixed(compiled->pattern + compiled->patternLen - compiled->suffixLen,
+                              data + dataLen - compiled->suffixLen, compiled->suffixLen, compiled->caseInsensitive))
+    {
+        return false;
     }
-    return false;
+    // What remains starts and ends with '*' in the pattern
+    return wildcard_match_span(compiled->pattern + compiled->prefixLen,
+                               compiled->patternLen - compiled->prefixLen - compiled->suffixLen,
+                               data + compiled->prefixLen, dataLen - compiled->prefixLen - compiled->suffixLen,
+                               compiled->caseInsensitive);
 }
 
 M_PARAM_RO(1)
@@ -1580,7 +2567,12 @@ M_PARAM_RO(2)
 M_NULL_TERM_STRING(1)
 M_NULL_TERM_STRING(2) bool wildcard_case_match(const char* M_NONNULL pattern, const char* M_NONNULL data)
 {
-    return wildcard_match_internal(pattern, data, true);
+    wildcardPattern compiled;
+    if (wildcard_compile(pattern, true, &compiled) != 0)
+    {
+        return false;
+    }
+    return wildcard_exec(&compiled, data);
 }
 
 M_PARAM_RO(1)
@@ -1588,7 +2580,12 @@ M_PARAM_RO(2)
 M_NULL_TERM_STRING(1)
 M_NULL_TERM_STRING(2) bool wildcard_match(const char* M_NONNULL pattern, const char* M_NONNULL data)
 {
-    return wildcard_match_internal(pattern, data, false);
+    wildcardPattern compiled;
+    if (wildcard_compile(pattern, false, &compiled) != 0)
+    {
+        return false;
+    }
+    return wildcard_exec(&compiled, data);
 }
 
 // Note: Tried M_FORCEINLINE but no performance difference observed
@@ -1678,3 +2675,618 @@ int string_version_compare(const char* M_NONNULL string1, const char* M_NONNULL
     // Final fallback: which string ended first
     return (*string1 != '\0') - (*string2 != '\0'); // branchless end check
 }
+
+// Smallest heap allocation made by a string builder. Avoids several tiny reallocations while a string starts out.
+#define STRING_BUILDER_MIN_HEAP_CAPACITY SIZE_T_C(64)
+
+M_PARAM_WO(1)
+M_PARAM_WO_SIZE(2, 3)
+errno_t init_String_Builder(stringBuilder* M_NONNULL builder,
+                            char* M_NULLABLE         initialBuffer,
+                            size_t                   initialCapacity)
+{
+    if (builder == M_NULLPTR || (initialBuffer == M_NULLPTR && initialCapacity != SIZE_T_C(0)))
+    {
+        return EINVAL;
+    }
+    builder->initialBuffer   = initialCapacity > SIZE_T_C(0) ? initialBuffer : M_NULLPTR;
+    builder->initialCapacity = builder->initialBuffer != M_NULLPTR ? initialCapacity : SIZE_T_C(0);
+    builder->buffer          = builder->initialBuffer;
+    builder->capacity        = builder->initialCapacity;
+    builder->length          = SIZE_T_C(0);
+    if (builder->buffer != M_NULLPTR)
+    {
+        builder->buffer[0] = '\0';
+    }
+    return 0;
+}
+
+static M_INLINE bool string_builder_on_heap(const stringBuilder* M_NONNULL builder)
+{
+    return builder->buffer != M_NULLPTR && builder->buffer != builder->initialBuffer;
+}
+
+static M_INLINE void string_builder_reset(stringBuilder* M_NONNULL builder)
+{
+    builder->buffer   = builder->initialBuffer;
+    builder->capacity = builder->initialCapacity;
+    builder->length   = SIZE_T_C(0);
+    if (builder->buffer != M_NULLPTR)
+    {
+        builder->buffer[0] = '\0';
+    }
+}
+
+M_PARAM_RW(1) void free_String_Builder(stringBuilder* M_NULLABLE builder)
+{
+    if (builder != M_NULLPTR)
+    {
+        if (builder->buffer != M_NULLPTR)
+        {
+            explicit_zeroes(builder->buffer, builder->length);
+        }
+        if (string_builder_on_heap(builder))
+        {
+            safe_free(&builder->buffer);
+        }
+        string_builder_reset(builder);
+    }
+}
+
+M_PARAM_RW(1) errno_t string_Builder_Reserve(stringBuilder* M_NONNULL builder, size_t additional)
+{
+    if (builder == M_NULLPTR)
+    {
+        return EINVAL;
+    }
+    if (additional > RSIZE_MAX || builder->length + additional >= RSIZE_MAX)
+    {
+        return ERANGE;
+    }
+    size_t required = builder->length + additional + SIZE_T_C(1);
+    if (required <= builder->capacity)
+    {
+        return 0;
+    }
+    // Double the capacity so that appending one character at a time is amortized O(1)
+    size_t newCapacity = builder->capacity > STRING_BUILDER_MIN_HEAP_CAPACITY / SIZE_T_C(2)
+                             ? builder->capacity * SIZE_T_C(2)
+                             : STRING_BUILDER_MIN_HEAP_CAPACITY;
+    if (newCapacity < required || newCapacity > RSIZE_MAX)
+    {
+        newCapacity = required;
+    }
+    // Always move to a new block rather than using realloc, so the old text can be zeroed behind it. realloc may free
+    // the old block (or leave it on failure) without clearing it. The caller's buffer is zeroed the same way so
+    // nothing is left in two places.
+    char* grown = M_REINTERPRET_CAST(char*, safe_malloc(newCapacity));
+    if (grown == M_NULLPTR)
+    {
+        free_String_Builder(builder);
+        return ENOMEM;
+    }
+    if (builder->buffer != M_NULLPTR)
+    {
+        safe_memcpy(grown, newCapacity, builder->buffer, builder->length + SIZE_T_C(1));
+        explicit_zeroes(builder->buffer, builder->length);
+        if (string_builder_on_heap(builder))
+        {
+            safe_free(&builder->buffer);
+        }
+    }
+    else
+    {
+        grown[0] = '\0';
+    }
+    builder->buffer   = grown;
+    builder->capacity = newCapacity;
+    return 0;
+}
+
+M_PARAM_RW(1)
+M_PARAM_RO_SIZE(2, 3)
+errno_t string_Builder_Append_N(stringBuilder* M_NONNULL builder, const char* M_NONNULL str, size_t count)
+{
+    if (builder == M_NULLPTR || str == M_NULLPTR)
+    {
+        return EINVAL;
+    }
+    // Growing frees and zeroes the old storage, so when str is part of the builder's own text remember where it was
+    // and find it again in the new storage afterwards.
+    size_t    appendLen   = safe_strnlen(str, count);
+    uintptr_t source      = C_CAST(uintptr_t, str);
+    uintptr_t storage     = C_CAST(uintptr_t, builder->buffer);
+    bool      aliased     = builder->buffer != M_NULLPTR && source >= storage && source - storage < builder->capacity;
+    size_t    aliasOffset = aliased ? C_CAST(size_t, source - storage) : SIZE_T_C(0);
+    errno_t   error       = string_Builder_Reserve(builder, appendLen);
+    if (error == 0 && builder->buffer != M_NULLPTR)
+    {
+        if (aliased)
+        {
+            str = builder->buffer + aliasOffset;
+        }
+        safe_memcpy(builder->buffer + builder->length, builder->capacity - builder->length, str, appendLen);
+        builder->length += appendLen;
+        builder->buffer[builder->length] = '\0';
+    }
+    return error;
+}
+
+M_PARAM_RW(1)
+M_PARAM_RO(2)
+M_NULL_TERM_STRING(2)
+errno_t string_Builder_Append(stringBuilder* M_NONNULL builder, const char* M_NONNULL str)
+{
+    return string_Builder_Append_N(builder, str, RSIZE_MAX);
+}
+
+M_PARAM_RW(1) errno_t string_Builder_Append_Char(stringBuilder* M_NONNULL builder, char c)
+{
+    errno_t error = string_Builder_Reserve(builder, SIZE_T_C(1));
+    if (error == 0 && builder->buffer != M_NULLPTR)
+    {
+        builder->buffer[builder->length] = c;
+        builder->length += SIZE_T_C(1);
+        builder->buffer[builder->length] = '\0';
+    }
+    return error;
+}
+
+M_PARAM_RW(1)
+M_PARAM_RO(2)
+FUNC_ATTR_PRINTF(2, 0)
+errno_t string_Builder_Append_VFormat(stringBuilder* M_NONNULL builder, const char* M_NONNULL format, va_list args)
+{
+    if (builder == M_NULLPTR || format == M_NULLPTR)
+    {
+        return EINVAL;
+    }
+    va_list retryargs;
+#if defined(va_copy)
+    va_copy(retryargs, args);
+#elif defined(__va_copy)
+    __va_copy(retryargs, args);
+#else
+    retryargs = args;
+#endif
+    errno_t error = 0;
+    // First attempt formats straight into whatever spare capacity there is. When there is no storage yet, this only
+    // measures the output.
+    char*  spare     = builder->buffer != M_NULLPTR ? builder->buffer + builder->length : M_NULLPTR;
+    size_t spareSize = builder->buffer != M_NULLPTR ? builder->capacity - builder->length : SIZE_T_C(0);
+    int    written   = vsnprintf(spare, spareSize, format, args);
+    if (written < 0)
+    {
+        error = EINVAL;
+    }
+    else if (int_to_sizet(written) < spareSize)
+    {
+        builder->length += int_to_sizet(written);
+    }
+    else
+    {
+        if (spare != M_NULLPTR)
+        {
+            // remove the truncated text written above
+            explicit_zeroes(spare, spareSize);
+        }
+        error = string_Builder_Reserve(builder, int_to_sizet(written));
+        if (error == 0 && builder->buffer != M_NULLPTR)
+        {
+            written = vsnprintf(builder->buffer + builder->length, builder->capacity - builder->length, format,
+                                retryargs);
+            if (written < 0)
+            {
+                builder->buffer[builder->length] = '\0';
+                error                            = EINVAL;
+            }
+            else
+            {
+                builder->length += int_to_sizet(written);
+            }
+        }
+    }
+    va_end(retryargs);
+    return error;
+}
+
+M_PARAM_RW(1)
+M_PARAM_RO(2)
+FUNC_ATTR_PRINTF(2, 3)
+errno_t string_Builder_Append_Format(stringBuilder* M_NONNULL builder, const char* M_NONNULL format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    errno_t error = string_Builder_Append_VFormat(builder, format, args);
+    va_end(args);
+    return error;
+}
+
+M_PARAM_RW(1) void string_Builder_Clear(stringBuilder* M_NULLABLE builder)
+{
+    if (builder != M_NULLPTR && builder->buffer != M_NULLPTR)
+    {
+        explicit_zeroes(builder->buffer, builder->length);
+        builder->length    = SIZE_T_C(0);
+        builder->buffer[0] = '\0';
+    }
+}
+
+M_NODISCARD M_PARAM_RO(1) const char* M_NONNULL string_Builder_Str(const stringBuilder* M_NULLABLE builder)
+{
+    if (builder == M_NULLPTR || builder->buffer == M_NULLPTR)
+    {
+        return "";
+    }
+    return builder->buffer;
+}
+
+M_NODISCARD M_PARAM_RO(1) size_t string_Builder_Length(const stringBuilder* M_NULLABLE builder)
+{
+    if (builder == M_NULLPTR)
+    {
+        return SIZE_T_C(0);
+    }
+    return builder->length;
+}
+
+M_PARAM_RW(1) char* M_NULLABLE string_Builder_Detach(stringBuilder* M_NULLABLE builder)
+{
+    if (builder == M_NULLPTR)
+    {
+        return M_NULLPTR;
+    }
+    char* detached = M_NULLPTR;
+    if (string_builder_on_heap(builder))
+    {
+        detached        = builder->buffer;
+        builder->buffer = M_NULLPTR;
+    }
+    else
+    {
+        detached = M_REINTERPRET_CAST(char*, safe_malloc(builder->length + SIZE_T_C(1)));
+        if (detached != M_NULLPTR)
+        {
+            if (builder->buffer != M_NULLPTR)
+            {
+                safe_memcpy(detached, builder->length + SIZE_T_C(1), builder->buffer, builder->length + SIZE_T_C(1));
+                explicit_zeroes(builder->buffer, builder->length);
+            }
+            else
+            {
+                detached[0] = '\0';
+            }
+        }
+        else
+        {
+            return M_NULLPTR;
+        }
+    }
+    string_builder_reset(builder);
+    return detached;
+}
+
+// Marks the end of a list of patterns in multiPatternMatcher.firstPattern and nextPattern
+#define MULTI_PATTERN_NONE UINT32_MAX
+
+struct smultiPatternMatcher
+{
+    uint32_t* transitions;  /*!< next state for each state and byte class, stateCount rows of classCount entries */
+    uint32_t* failure;      /*!< longest proper suffix of each state that is also a state */
+    uint32_t* output;       /*!< nearest state along the failure chain, including itself, that ends a pattern */
+    uint32_t* firstPattern; /*!< first pattern ending at each state */
+    uint32_t* nextPattern;  /*!< next pattern ending at the same state, for repeated patterns */
+    size_t*   patternLengths;
+    size_t    patternCount;
+    uint32_t  stateCount;
+    uint32_t  stateCapacity;
+    uint32_t  classCount;
+    uint16_t  byteClass[256]; /*!< bytes that appear in no pattern share class 0 so the table stays small */
+};
+
+static M_INLINE size_t multi_pattern_length(const char* M_NONNULL const* M_NONNULL patterns,
+                                            const size_t* M_NULLABLE                lengths,
+                                            size_t                                  index)
+{
+    return lengths != M_NULLPTR ? lengths[index] : safe_strlen(patterns[index]);
+}
+
+static M_INLINE unsigned char multi_pattern_byte(unsigned char byte, bool caseInsensitive)
+{
+    return caseInsensitive ? ascii_fold_lower(byte) : byte;
+}
+
+// Numbers each byte used by a pattern. Case insensitive matchers give both cases of a letter the same class.
+static errno_t multi_pattern_assign_classes(multiPatternMatcher* M_NONNULL          matcher,
+                                            const char* M_NONNULL const* M_NONNULL patterns,
+                                            const size_t* M_NULLABLE                lengths,
+                                            bool                                    caseInsensitive,
+                                            size_t* M_NONNULL                       totalLength)
+{
+    *totalLength = SIZE_T_C(0);
+    for (size_t index = SIZE_T_C(0); index < matcher->patternCount; ++index)
+    {
+        if (patterns[index] == M_NULLPTR)
+        {
+            return EINVAL;
+        }
+        size_t length = multi_pattern_length(patterns, lengths, index);
+        if (length == SIZE_T_C(0) || length > UINT32_MAX - 1U - *totalLength)
+        {
+            return EINVAL;
+        }
+        *totalLength += length;
+        matcher->patternLengths[index] = length;
+        const unsigned char* bytes     = M_REINTERPRET_CAST(const unsigned char*, patterns[index]);
+        for (size_t offset = SIZE_T_C(0); offset < length; ++offset)
+        {
+            unsigned char byte = multi_pattern_byte(bytes[offset], caseInsensitive);
+            if (matcher->byteClass[byte] == 0U)
+            {
+                matcher->byteClass[byte] = M_STATIC_CAST(uint16_t, matcher->classCount);
+                ++matcher->classCount;
+            }
+        }
+    }
+    if (caseInsensitive)
+    {
+        for (unsigned int byte = 0U; byte < 256U; ++byte)
+        {
+            matcher->byteClass[byte] = matcher->byteClass[ascii_fold_lower(M_STATIC_CAST(unsigned char, byte))];
+        }
+    }
+    return 0;
+}
+
+// Grows the per state arrays. New rows of the transition table are zero, which means no edge while building the trie.
+static errno_t multi_pattern_grow_states(multiPatternMatcher* M_NONNULL matcher, uint32_t maxStates)
+{
+    uint32_t newCapacity = matcher->stateCapacity > maxStates / 2U ? maxStates : matcher->stateCapacity * 2U;
+    if (newCapacity < 64U)
+    {
+        newCapacity = M_Min(64U, maxStates);
+    }
+    if (M_STATIC_CAST(size_t, newCapacity) > SIZE_MAX / sizeof(uint32_t) / matcher->classCount)
+    {
+        return ERANGE;
+    }
+    size_t    rowBytes    = M_STATIC_CAST(size_t, matcher->classCount) * sizeof(uint32_t);
+    uint32_t* transitions = M_REINTERPRET_CAST(
+        uint32_t*, safe_reallocf(M_REINTERPRET_CAST(void**, &matcher->transitions), newCapacity * rowBytes));
+    uint32_t* firstPattern = M_REINTERPRET_CAST(
+        uint32_t*, safe_reallocf(M_REINTERPRET_CAST(void**, &matcher->firstPattern), newCapacity * sizeof(uint32_t)));
+    // safe_reallocf releases the old storage on failure, so the pointers can be stored either way
+    matcher->transitions  = transitions;
+    matcher->firstPattern = firstPattern;
+    if (transitions == M_NULLPTR || firstPattern == M_NULLPTR)
+    {
+        return ENOMEM;
+    }
+    size_t addedBytes = (newCapacity - matcher->stateCapacity) * rowBytes;
+    safe_memset(transitions + M_STATIC_CAST(size_t, matcher->stateCapacity) * matcher->classCount, addedBytes, 0,
+                addedBytes);
+    for (uint32_t state = matcher->stateCapacity; state < newCapacity; ++state)
+    {
+        firstPattern[state] = MULTI_PATTERN_NONE;
+    }
+    matcher->stateCapacity = newCapacity;
+    return 0;
+}
+
+static errno_t multi_pattern_build_trie(multiPatternMatcher* M_NONNULL          matcher,
+                                        const char* M_NONNULL const* M_NONNULL patterns,
+                                        bool                                    caseInsensitive,
+                                        uint32_t                                maxStates)
+{
+    errno_t error = multi_pattern_grow_states(matcher, maxStates);
+    if (error != 0)
+    {
+        return error;
+    }
+    matcher->stateCount = 1U;
+    // Adding the patterns in reverse leaves repeated patterns listed in ascending order
+    for (size_t index = matcher->patternCount; index > SIZE_T_C(0); --index)
+    {
+        size_t               patternID = index - SIZE_T_C(1);
+        const unsigned char* bytes     = M_REINTERPRET_CAST(const unsigned char*, patterns[patternID]);
+        uint32_t             state     = 0U;
+        for (size_t offset = SIZE_T_C(0); offset < matcher->patternLengths[patternID]; ++offset)
+        {
+            unsigned char byte  = multi_pattern_byte(bytes[offset], caseInsensitive);
+            size_t        entry = M_STATIC_CAST(size_t, state) * matcher->classCount + matcher->byteClass[byte];
+            if (matcher->transitions[entry] == 0U)
+            {
+                if (matcher->stateCount == matcher->stateCapacity &&
+                    (error = multi_pattern_grow_states(matcher, maxStates)) != 0)
+                {
+                    return error;
+                }
+                matcher->transitions[entry] = matcher->stateCount;
+                ++matcher->stateCount;
+            }
+            state = matcher->transitions[entry];
+        }
+        matcher->nextPattern[patternID] = matcher->firstPattern[state];
+        matcher->firstPattern[state]    = M_STATIC_CAST(uint32_t, patternID);
+    }
+    return 0;
+}
+
+// Visits states in breadth first order to fill in failure links, then replaces each missing edge with the edge
+// taken from the failure state so that searching never has to follow failure links.
+static errno_t multi_pattern_link_states(multiPatternMatcher* M_NONNULL matcher)
+{
+    size_t    classes = matcher->classCount;
+    uint32_t* queue   = M_REINTERPRET_CAST(uint32_t*, safe_malloc(matcher->stateCount * sizeof(uint32_t)));
+    matcher->failure  = M_REINTERPRET_CAST(uint32_t*, safe_calloc(matcher->stateCount, sizeof(uint32_t)));
+    matcher->output   = M_REINTERPRET_CAST(uint32_t*, safe_calloc(matcher->stateCount, sizeof(uint32_t)));
+    if (queue == M_NULLPTR || matcher->failure == M_NULLPTR || matcher->output == M_NULLPTR)
+    {
+        safe_free(&queue);
+        return ENOMEM;
+    }
+    uint32_t head = 0U;
+    uint32_t tail = 0U;
+    for (size_t byteClass = SIZE_T_C(0); byteClass < classes; ++byteClass)
+    {
+        if (matcher->transitions[byteClass] != 0U)
+        {
+            queue[tail++] = matcher->transitions[byteClass];
+        }
+    }
+    while (head < tail)
+    {
+        uint32_t  state     = queue[head++];
+        uint32_t* row       = matcher->transitions + M_STATIC_CAST(size_t, state) * classes;
+        uint32_t* failedRow = matcher->transitions + M_STATIC_CAST(size_t, matcher->failure[state]) * classes;
+        matcher->output[state] =
+            matcher->firstPattern[state] != MULTI_PATTERN_NONE ? state : matcher->output[matcher->failure[state]];
+        for (size_t byteClass = SIZE_T_C(0); byteClass < classes; ++byteClass)
+        {
+            if (row[byteClass] != 0U)
+            {
+                matcher->failure[row[byteClass]] = failedRow[byteClass];
+                queue[tail++]                    = row[byteClass];
+            }
+            else
+            {
+                row[byteClass] = failedRow[byteClass];
+            }
+        }
+    }
+    safe_free(&queue);
+    return 0;
+}
+
+M_PARAM_RO_SIZE(1, 3)
+M_PARAM_RO_SIZE(2, 3)
+multiPatternMatcher* M_NULLABLE create_Multi_Pattern_Matcher(const char* M_NONNULL const* M_NONNULL patterns,
+                                                             const size_t* M_NULLABLE lengths,
+                                                             size_t                   patternCount,
+                                                             bool                     caseInsensitive)
+{
+    if (patterns == M_NULLPTR || patternCount == SIZE_T_C(0) || patternCount >= UINT32_MAX)
+    {
+        return M_NULLPTR;
+    }
+    multiPatternMatcher* matcher =
+        M_REINTERPRET_CAST(multiPatternMatcher*, safe_calloc(SIZE_T_C(1), sizeof(multiPatternMatcher)));
+    if (matcher == M_NULLPTR)
+    {
+        return M_NULLPTR;
+    }
+    matcher->patternCount   = patternCount;
+    matcher->classCount     = 1U;
+    matcher->patternLengths = M_REINTERPRET_CAST(size_t*, safe_calloc(patternCount, sizeof(size_t)));
+    matcher->nextPattern    = M_REINTERPRET_CAST(uint32_t*, safe_calloc(patternCount, sizeof(uint32_t)));
+    size_t totalLength      = SIZE_T_C(0);
+    if (matcher->patternLengths == M_NULLPTR || matcher->nextPattern == M_NULLPTR ||
+        multi_pattern_assign_classes(matcher, patterns, lengths, caseInsensitive, &totalLength) != 0 ||
+        multi_pattern_build_trie(matcher, patterns, caseInsensitive, M_STATIC_CAST(uint32_t, totalLength + 1U)) != 0 ||
+        multi_pattern_link_states(matcher) != 0)
+    {
+        free_Multi_Pattern_Matcher(&matcher);
+    }
+    return matcher;
+}
+
+void free_Multi_Pattern_Matcher(multiPatternMatcher* M_NULLABLE* M_NULLABLE matcher)
+{
+    if (matcher != M_NULLPTR && *matcher != M_NULLPTR)
+    {
+        safe_free(&(*matcher)->transitions);
+        safe_free(&(*matcher)->failure);
+        safe_free(&(*matcher)->output);
+        safe_free(&(*matcher)->firstPattern);
+        safe_free(&(*matcher)->nextPattern);
+        safe_free_core(M_REINTERPRET_CAST(void**, &(*matcher)->patternLengths));
+        safe_free_core(M_REINTERPRET_CAST(void**, matcher));
+    }
+}
+
+M_PARAM_WO(1)
+M_PARAM_RO(2)
+errno_t init_Multi_Pattern_Stream(multiPatternStream* M_NONNULL stream, const multiPatternMatcher* M_NONNULL matcher)
+{
+    if (stream == M_NULLPTR || matcher == M_NULLPTR)
+    {
+        return EINVAL;
+    }
+    stream->matcher = matcher;
+    stream->offset  = UINT64_C(0);
+    stream->state   = 0U;
+    return 0;
+}
+
+// Reports every pattern ending at a state that has output. Returns false if the callback asked to stop.
+static bool multi_pattern_report(const multiPatternMatcher* M_NONNULL matcher,
+                                 uint32_t                             state,
+                                 uint64_t                             endOffset,
+                                 multipatternmatchfn M_NONNULL        onMatch,
+                                 void* M_NULLABLE                     context)
+{
+    for (uint32_t hit = matcher->output[state]; hit != 0U; hit = matcher->output[matcher->failure[hit]])
+    {
+        for (uint32_t patternID = matcher->firstPattern[hit]; patternID != MULTI_PATTERN_NONE;
+             patternID          = matcher->nextPattern[patternID])
+        {
+            size_t length = matcher->patternLengths[patternID];
+            if (!onMatch(patternID, endOffset - length, length, context))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+M_PARAM_RW(1)
+M_PARAM_RO_SIZE(2, 3)
+bool multi_Pattern_Stream_Feed(multiPatternStream* M_NONNULL stream,
+                               const void* M_NULLABLE        data,
+                               size_t                        length,
+                               multipatternmatchfn M_NONNULL onMatch,
+                               void* M_NULLABLE              context)
+{
+    if (stream == M_NULLPTR || stream->matcher == M_NULLPTR || onMatch == M_NULLPTR ||
+        (data == M_NULLPTR && length != SIZE_T_C(0)))
+    {
+        return false;
+    }
+    const multiPatternMatcher* matcher = stream->matcher;
+    const unsigned char*       bytes   = M_REINTERPRET_CAST(const unsigned char*, data);
+    const uint32_t*            output  = matcher->output;
+    const uint32_t*            next    = matcher->transitions;
+    size_t                     classes = matcher->classCount;
+    uint32_t                   state   = stream->state;
+    for (size_t offset = SIZE_T_C(0); offset < length; ++offset)
+    {
+        state = next[M_STATIC_CAST(size_t, state) * classes + matcher->byteClass[bytes[offset]]];
+        if (output[state] != 0U &&
+            !multi_pattern_report(matcher, state, stream->offset + offset + 1U, onMatch, context))
+        {
+            stream->state = state;
+            stream->offset += offset + 1U;
+            return false;
+        }
+    }
+    stream->state = state;
+    stream->offset += length;
+    return true;
+}
+
+M_PARAM_RO(1)
+M_PARAM_RO_SIZE(2, 3)
+bool multi_Pattern_Search(const multiPatternMatcher* M_NONNULL matcher,
+                          const void* M_NULLABLE               data,
+                          size_t                               length,
+                          multipatternmatchfn M_NONNULL        onMatch,
+                          void* M_NULLABLE                     context)
+{
+    multiPatternStream stream;
+    if (init_Multi_Pattern_Stream(&stream, matcher) != 0)
+    {
+        return false;
+    }
+    return multi_Pattern_Stream_Feed(&stream, data, length, onMatch, context);
+}
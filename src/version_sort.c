@@ -13,8 +13,13 @@
 //! If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include "version_sort.h"
+#include "math_utils.h"
+#include "memory_safety.h"
+#include "sort_and_search.h"
 #include "string_utils.h"
 
+#include <string.h>
+
 M_PARAM_RO(1)
 M_PARAM_RO(2)
 M_NODISCARD
@@ -37,3 +42,207 @@ int version_sort(const struct dirent* M_NONNULL* M_NONNULL ptr1, const struct di
     return string_version_compare((*ptr1)->d_name, (*ptr2)->d_name);
 }
 #endif // NEED_OLD_SCANDIR_CMP_FUNC_TYPE
+
+// Every run of digits starts with this byte. No other character compares between '/' and ':', so like a digit in
+// string_version_compare, a number sorts after '/' and before ':' when compared against any non-digit.
+#define VERSION_KEY_NUMBER_MARKER UINT8_C(0x30)
+
+// Counts below this take one byte. Larger counts take a prefix of this value plus the number of bytes that follow.
+#define VERSION_KEY_SHORT_COUNT_LIMIT UINT8_C(0xF0)
+
+static M_INLINE void version_key_put(uint8_t* M_NULLABLE key, size_t keySize, size_t offset, uint8_t value)
+{
+    if (offset < keySize)
+    {
+        key[offset] = value;
+    }
+}
+
+// Writes a count so that larger counts compare greater with memcmp and no encoding is a prefix of another. Inverting
+// every byte reverses the order while keeping that property.
+static size_t version_key_put_count(uint8_t* M_NULLABLE key,
+                                    size_t              keySize,
+                                    size_t              offset,
+                                    size_t              count,
+                                    bool                invert)
+{
+    uint8_t flip = invert ? UINT8_C(0xFF) : UINT8_C(0);
+    if (count < VERSION_KEY_SHORT_COUNT_LIMIT)
+    {
+        version_key_put(key, keySize, offset, M_STATIC_CAST(uint8_t, count) ^ flip);
+        return offset + SIZE_T_C(1);
+    }
+    uint8_t bytes = UINT8_C(1);
+    while (bytes < sizeof(size_t) && (count >> (bytes * 8U)) != SIZE_T_C(0))
+    {
+        ++bytes;
+    }
+    version_key_put(key, keySize, offset++, M_STATIC_CAST(uint8_t, VERSION_KEY_SHORT_COUNT_LIMIT + bytes) ^ flip);
+    while (bytes > UINT8_C(0))
+    {
+        --bytes;
+        version_key_put(key, keySize, offset++, M_STATIC_CAST(uint8_t, count >> (bytes * 8U)) ^ flip);
+    }
+    return offset;
+}
+
+M_NODISCARD
+M_PARAM_RO(1)
+M_NULL_TERM_STRING(1)
+M_PARAM_WO_SIZE(2, 3)
+size_t version_sort_key(const char* M_NONNULL string, uint8_t* M_NULLABLE key, size_t keySize)
+{
+    size_t offset = SIZE_T_C(0);
+    if (string == M_NULLPTR)
+    {
+        return offset;
+    }
+    if (key == M_NULLPTR)
+    {
+        keySize = SIZE_T_C(0);
+    }
+    while (*string != '\0')
+    {
+        if (!ascii_isdigit(*string))
+        {
+            version_key_put(key, keySize, offset++, M_STATIC_CAST(uint8_t, *string));
+            ++string;
+            continue;
+        }
+        size_t zeros = SIZE_T_C(0);
+        for (; *string == '0'; ++string)
+        {
+            ++zeros;
+        }
+        const char* digits = string;
+        for (; ascii_isdigit(*string); ++string)
+        {
+        }
+        // The number of significant digits orders numbers by magnitude before the digits themselves are compared
+        size_t significant = C_CAST(size_t, C_CAST(uintptr_t, string) - C_CAST(uintptr_t, digits));
+        version_key_put(key, keySize, offset++, VERSION_KEY_NUMBER_MARKER);
+        offset = version_key_put_count(key, keySize, offset, significant, false);
+        for (size_t index = SIZE_T_C(0); index < significant; ++index)
+        {
+            version_key_put(key, keySize, offset++, M_STATIC_CAST(uint8_t, digits[index]));
+        }
+        // equal numbers with more leading zeros sort first
+        offset = version_key_put_count(key, keySize, offset, zeros, true);
+    }
+    return offset;
+}
+
+M_NODISCARD
+M_PARAM_RO_SIZE(1, 2)
+M_PARAM_RO_SIZE(3, 4)
+int version_sort_key_compare(const uint8_t* M_NONNULL key1,
+                             size_t                   key1Length,
+                             const uint8_t* M_NONNULL key2,
+                             size_t                   key2Length)
+{
+    int result = memcmp(key1, key2, M_Min(key1Length, key2Length));
+    if (result != 0)
+    {
+        return result;
+    }
+    return (key1Length > key2Length) - (key1Length < key2Length);
+}
+
+typedef struct sversionSortEntry
+{
+    const uint8_t* key;
+    size_t         keyLength;
+    size_t         index; /*!< position of the element before sorting */
+} versionSortEntry;
+
+static int version_sort_entry_compare(const void* M_NONNULL entry1, const void* M_NONNULL entry2)
+{
+    const versionSortEntry* first  = M_REINTERPRET_CAST(const versionSortEntry*, entry1);
+    const versionSortEntry* second = M_REINTERPRET_CAST(const versionSortEntry*, entry2);
+    int result = version_sort_key_compare(first->key, first->keyLength, second->key, second->keyLength);
+    // equal keys come from equal strings, but keep the original order anyway so the result does not depend on qsort
+    return result != 0 ? result : (first->index > second->index) - (first->index < second->index);
+}
+
+// Moves the elements into sorted order by way of a copy of the array
+static errno_t version_sort_apply_order(uint8_t* M_NONNULL                elements,
+                                        size_t                            count,
+                                        size_t                            size,
+                                        const versionSortEntry* M_NONNULL entries)
+{
+    uint8_t* original = M_REINTERPRET_CAST(uint8_t*, safe_malloc(count * size));
+    if (original == M_NULLPTR)
+    {
+        return ENOMEM;
+    }
+    safe_memcpy(original, count * size, elements, count * size);
+    for (size_t position = SIZE_T_C(0); position < count; ++position)
+    {
+        safe_memcpy(elements + position * size, size, original + entries[position].index * size, size);
+    }
+    safe_free(&original);
+    return 0;
+}
+
+M_PARAM_RW(1)
+errno_t version_sort_array(void* M_NULLABLE base, size_t count, size_t size, versionsortnamefn M_NONNULL getName)
+{
+    if ((base == M_NULLPTR && count > SIZE_T_C(0)) || size == SIZE_T_C(0) || getName == M_NULLPTR)
+    {
+        return EINVAL;
+    }
+    if (count < SIZE_T_C(2))
+    {
+        return 0;
+    }
+    if (count > RSIZE_MAX / size || count > RSIZE_MAX / sizeof(versionSortEntry))
+    {
+        return ERANGE;
+    }
+    uint8_t* elements  = M_REINTERPRET_CAST(uint8_t*, base);
+    size_t   totalSize = SIZE_T_C(0);
+    for (size_t index = SIZE_T_C(0); index < count; ++index)
+    {
+        size_t keyLength = version_sort_key(getName(elements + index * size), M_NULLPTR, SIZE_T_C(0));
+        if (keyLength > RSIZE_MAX - totalSize)
+        {
+            return ERANGE;
+        }
+        totalSize += keyLength;
+    }
+    versionSortEntry* entries = M_REINTERPRET_CAST(versionSortEntry*, safe_calloc(count, sizeof(versionSortEntry)));
+    // one extra byte so that the allocation is never zero bytes when every string is empty
+    uint8_t* keys  = M_REINTERPRET_CAST(uint8_t*, safe_malloc(totalSize + SIZE_T_C(1)));
+    errno_t  error = ENOMEM;
+    if (entries != M_NULLPTR && keys != M_NULLPTR)
+    {
+        size_t used = SIZE_T_C(0);
+        for (size_t index = SIZE_T_C(0); index < count; ++index)
+        {
+            const char* name         = getName(elements + index * size);
+            entries[index].key       = keys + used;
+            entries[index].keyLength = version_sort_key(name, keys + used, totalSize - used);
+            entries[index].index     = index;
+            used += entries[index].keyLength;
+        }
+        error = safe_qsort(entries, count, sizeof(versionSortEntry), version_sort_entry_compare);
+        if (error == 0)
+        {
+            error = version_sort_apply_order(elements, count, size, entries);
+        }
+    }
+    safe_free(&keys);
+    safe_free_core(M_REINTERPRET_CAST(void**, &entries));
+    return error;
+}
+
+static const char* M_NONNULL version_sort_string_name(const void* M_NONNULL element)
+{
+    return *M_REINTERPRET_CAST(const char* const*, element);
+}
+
+M_PARAM_RW_SIZE(1, 2)
+errno_t version_sort_strings(const char* M_NONNULL* M_NULLABLE strings, size_t count)
+{
+    return version_sort_array(M_REINTERPRET_CAST(void*, strings), count, sizeof(const char*), version_sort_string_name);
+}